@@ -0,0 +1,182 @@
+package sensorcontrolled
+
+import (
+	"context"
+	"sync"
+	"time"
+
+	geo "github.com/kellydunn/golang-geo"
+)
+
+// sensorSample is one reading of the base's movement sensors, taken at time.
+type sensorSample struct {
+	time     time.Time
+	linVel   float64 // m/s
+	angVel   float64 // deg/s
+	heading  float64 // deg, from headingFunc
+	position *geo.Point
+}
+
+// sampleFields selects the readings to take in a sensorSample.
+type sampleFields struct {
+	linearVelocity, angularVelocity, heading, position bool
+}
+
+// sample reads each of the requested fields from the movement sensors once.
+func (sb *sensorBase) sample(ctx context.Context, fields sampleFields) (sensorSample, error) {
+	s := sensorSample{time: time.Now()}
+	if fields.linearVelocity {
+		linVel, err := sb.velocities.LinearVelocity(ctx, nil)
+		if err != nil {
+			return sensorSample{}, err
+		}
+		s.linVel = linVel.Y
+	}
+	if fields.angularVelocity {
+		angVel, err := sb.velocities.AngularVelocity(ctx, nil)
+		if err != nil {
+			return sensorSample{}, err
+		}
+		s.angVel = angVel.Z
+	}
+	if fields.heading {
+		heading, _, err := sb.headingFunc(ctx)
+		if err != nil {
+			return sensorSample{}, err
+		}
+		s.heading = heading
+	}
+	if fields.position {
+		pos, _, err := sb.position.Position(ctx, nil)
+		if err != nil {
+			return sensorSample{}, err
+		}
+		s.position = pos
+	}
+	return s, nil
+}
+
+// outerController is the position or heading controller of a MoveStraight or Spin. It sets the
+// velocities the inner velocity control loop tracks.
+type outerController interface {
+	// fields returns the readings step needs.
+	fields() sampleFields
+	// step returns the desired linear (mm/s) and angular (deg/s) velocities given the latest
+	// sample, or done once the goal is reached.
+	step(s sensorSample) (linVel, angVel float64, done bool)
+}
+
+// runOuterLoop runs the controller until it reaches its goal, ctx is done, or timeOut passes, and
+// then stops the base. If ctx is done first, its error is returned. With cascaded control the controller runs within the control loop's own tick
+// on the sample the inner loop uses, otherwise it runs on a ticker of its own at the same frequency.
+func (sb *sensorBase) runOuterLoop(ctx context.Context, c outerController, timeOut time.Duration, name string) error {
+	if sb.conf.CascadedControl {
+		return sb.runCascade(ctx, c, timeOut, name)
+	}
+
+	startTime := time.Now()
+	ticker := time.NewTicker(time.Duration(1000./sb.controlLoopConfig.Frequency) * time.Millisecond)
+	defer ticker.Stop()
+	for {
+		select {
+		case <-ctx.Done():
+			return ctx.Err()
+		case <-ticker.C:
+			s, err := sb.sample(ctx, c.fields())
+			if err != nil {
+				return err
+			}
+			linVel, angVel, done := c.step(s)
+			if done {
+				return sb.Stop(ctx, nil)
+			}
+
+			// update velocity controller
+			if err := sb.updateControlConfig(ctx, linVel/1000.0, angVel); err != nil {
+				return err
+			}
+
+			// exit if the movement takes too long
+			if time.Since(startTime) > timeOut {
+				sb.logger.CWarnf(ctx, "exceeded time for %s call, stopping base", name)
+				return sb.Stop(ctx, nil)
+			}
+		}
+	}
+}
+
+// cascade is an outer controller running within the control loop's tick. done is closed, with err
+// set, once it reaches its goal or fails.
+type cascade struct {
+	controller outerController
+	once       sync.Once
+	done       chan struct{}
+	err        error
+}
+
+func (c *cascade) finish(err error) {
+	c.once.Do(func() {
+		c.err = err
+		close(c.done)
+	})
+}
+
+// runCascade installs the controller for State to step on every tick of the control loop, and waits
+// for it to finish.
+func (sb *sensorBase) runCascade(ctx context.Context, c outerController, timeOut time.Duration, name string) error {
+	cas := &cascade{controller: c, done: make(chan struct{})}
+	sb.cascadeMu.Lock()
+	sb.cascade = cas
+	sb.cascadeMu.Unlock()
+	defer func() {
+		cas.finish(nil)
+		sb.cascadeMu.Lock()
+		defer sb.cascadeMu.Unlock()
+		if sb.cascade == cas {
+			sb.cascade = nil
+		}
+	}()
+
+	timer := time.NewTimer(timeOut)
+	defer timer.Stop()
+	select {
+	case <-ctx.Done():
+		return ctx.Err()
+	case <-cas.done:
+		if cas.err != nil {
+			return cas.err
+		}
+		return sb.Stop(ctx, nil)
+	case <-timer.C:
+		sb.logger.CWarnf(ctx, "exceeded time for %s call, stopping base", name)
+		return sb.Stop(ctx, nil)
+	}
+}
+
+// activeCascade returns the outer controller to step in this tick of the control loop, if any.
+func (sb *sensorBase) activeCascade() *cascade {
+	sb.cascadeMu.Lock()
+	defer sb.cascadeMu.Unlock()
+	if sb.cascade == nil {
+		return nil
+	}
+	select {
+	case <-sb.cascade.done:
+		return nil
+	default:
+		return sb.cascade
+	}
+}
+
+// stepCascade runs one step of the outer controller on this tick's sample, and hands its velocities
+// to the inner loop.
+func (sb *sensorBase) stepCascade(ctx context.Context, cas *cascade, s sensorSample) {
+	linVel, angVel, done := cas.controller.step(s)
+	if done {
+		cas.finish(nil)
+		return
+	}
+	if err := sb.updateControlConfig(ctx, linVel/1000.0, angVel); err != nil {
+		cas.finish(err)
+	}
+}
@@ -67,7 +67,6 @@ func (sb *sensorBase) MoveStraight(
 	sb.loop.Resume()
 
 	straightTimeEst := time.Duration(int(time.Second) * int(math.Abs(float64(distanceMm)/mmPerSec)))
-	startTime := time.Now()
 	timeOut := 5 * straightTimeEst
 	if timeOut < 10*time.Second {
 		timeOut = 10 * time.Second
@@ -80,106 +79,83 @@ func (sb *sensorBase) MoveStraight(
 	}
 
 	// initialize relevant parameters for moving straight
-	slowDownDist := calcSlowDownDist(distanceMm)
-
-	var initPos *geo.Point
-
+	c := &straightController{
+		distanceMm:     distanceMm,
+		mmPerSec:       mmPerSec,
+		slowDownDist:   calcSlowDownDist(distanceMm),
+		initialHeading: initialHeading,
+		prevTime:       time.Now(),
+	}
 	if sb.position != nil {
-		initPos, _, err = sb.position.Position(ctx, nil)
+		c.initPos, _, err = sb.position.Position(ctx, nil)
 		if err != nil {
 			return err
 		}
 	}
 
-	// this state is only used when no position sensor is configured
-	prevTime := startTime
-	currDistMm := 0.
-
-	ticker := time.NewTicker(time.Duration(1000./sb.controlLoopConfig.Frequency) * time.Millisecond)
-	defer ticker.Stop()
-	for {
-		select {
-		case <-ctx.Done():
-			// do not return context canceled errors, just log them
-			if errors.Is(ctx.Err(), context.Canceled) {
-				sb.logger.Error(ctx.Err())
-				return nil
-			}
-			return ctx.Err()
-		case <-ticker.C:
-			var errDist float64
-
-			angVelDes, err := sb.calcHeadingControl(ctx, initialHeading)
-			if err != nil {
-				return err
-			}
-
-			if sb.position != nil {
-				errDist, err = sb.calcPositionError(ctx, distanceMm, initPos)
-				if err != nil {
-					return err
-				}
-			} else {
-				currTime := time.Now()
-				vels, err := sb.velocities.LinearVelocity(ctx, nil)
-				if err != nil {
-					return err
-				}
-				deltaTime := currTime.Sub(prevTime).Seconds()
-				// calculate the estimated change in position based on the latest velocity
-				deltaPosMm := sign(mmPerSec) * vels.Y * deltaTime * 1000
-				currDistMm += deltaPosMm
-				errDist = float64(distanceMm) - currDistMm
-				prevTime = currTime
-			}
-
-			if errDist < moveStraightErrTarget {
-				return sb.Stop(ctx, nil)
-			}
-
-			linVelDes := calcLinVel(errDist, mmPerSec, slowDownDist)
-			if err != nil {
-				return err
-			}
-
-			// update velocity controller
-			if err := sb.updateControlConfig(ctx, linVelDes/1000.0, angVelDes); err != nil {
-				return err
-			}
-
-			// exit if the straight takes too long
-			if time.Since(startTime) > timeOut {
-				sb.logger.CWarn(ctx, "exceeded time for MoveStraight call, stopping base")
-				return sb.Stop(ctx, nil)
-			}
-		}
+	err = sb.runOuterLoop(ctx, c, timeOut, "MoveStraight")
+	// do not return context canceled errors, just log them
+	if errors.Is(err, context.Canceled) {
+		sb.logger.Error(err)
+		return nil
 	}
+	return err
 }
 
-// calculate the desired angular velocity to correct the heading of the base.
-func (sb *sensorBase) calcHeadingControl(ctx context.Context, initHeading float64) (float64, error) {
-	currHeading, _, err := sb.headingFunc(ctx)
-	if err != nil {
-		return 0, err
+// straightController is the outer controller of MoveStraight. It drives the base the requested
+// distance, holding the initial heading.
+type straightController struct {
+	distanceMm     int
+	mmPerSec       float64
+	slowDownDist   float64
+	initialHeading float64
+	// initPos is nil when no position sensor is configured, in which case the distance moved is
+	// estimated from the linear velocity since prevTime.
+	initPos    *geo.Point
+	prevTime   time.Time
+	currDistMm float64
+}
+
+func (c *straightController) fields() sampleFields {
+	return sampleFields{heading: true, position: c.initPos != nil, linearVelocity: c.initPos == nil}
+}
+
+func (c *straightController) step(s sensorSample) (float64, float64, bool) {
+	angVelDes := headingControl(c.initialHeading, s.heading)
+
+	var errDist float64
+	if c.initPos != nil {
+		errDist = positionError(c.distanceMm, c.initPos, s.position)
+	} else {
+		deltaTime := s.time.Sub(c.prevTime).Seconds()
+		// calculate the estimated change in position based on the latest velocity
+		deltaPosMm := sign(c.mmPerSec) * s.linVel * deltaTime * 1000
+		c.currDistMm += deltaPosMm
+		errDist = float64(c.distanceMm) - c.currDistMm
+		c.prevTime = s.time
+	}
+
+	if errDist < moveStraightErrTarget {
+		return 0, 0, true
 	}
+	return calcLinVel(errDist, c.mmPerSec, c.slowDownDist), angVelDes, false
+}
 
+// headingControl returns the desired angular velocity to turn the base from currHeading back to
+// initHeading.
+func headingControl(initHeading, currHeading float64) float64 {
 	headingErr := initHeading - currHeading
 	headingErrWrapped := headingErr - (math.Floor((headingErr+180.)/(2*180.)))*2*180. // [-180;180)
 
-	return headingErrWrapped * headingGain, nil
+	return headingErrWrapped * headingGain
 }
 
-// calcPositionError calculates the current error in position.
+// positionError calculates the current error in position.
 // This results in the distance the base needs to travel to reach the goal.
-func (sb *sensorBase) calcPositionError(ctx context.Context, distanceMm int, initPos *geo.Point) (float64, error) {
-	pos, _, err := sb.position.Position(ctx, nil)
-	if err != nil {
-		return 0, err
-	}
-
+func positionError(distanceMm int, initPos, pos *geo.Point) float64 {
 	// the currDist will always return as positive, so we need the goal distanceMm to be positive
 	currDist := initPos.GreatCircleDistance(pos) * 1000000.
-	return math.Abs(float64(distanceMm)) - currDist, nil
+	return math.Abs(float64(distanceMm)) - currDist
 }
 
 // calcLinVel computes the desired linear velocity based on how far the base is from reaching the goal.
@@ -38,6 +38,10 @@ type Config struct {
 	MovementSensor    []string            `json:"movement_sensor"`
 	Base              string              `json:"base"`
 	ControlParameters []control.PIDConfig `json:"control_parameters,omitempty"`
+	// CascadedControl runs the position and heading control of MoveStraight and Spin within the
+	// velocity control loop's tick, sharing its sample of the movement sensors, rather than in a
+	// separate loop of their own.
+	CascadedControl bool `json:"cascaded_control,omitempty"`
 }
 
 // Validate validates all parts of the sensor controlled base config.
@@ -76,6 +80,10 @@ type sensorBase struct {
 	controlLoopConfig control.Config
 	blockNames        map[string][]string
 	loop              *control.Loop
+
+	// cascade is the outer controller of the running MoveStraight or Spin with cascaded control.
+	cascadeMu sync.Mutex
+	cascade   *cascade
 }
 
 func init() {
@@ -476,28 +476,121 @@ func TestSensorBaseMoveStraight(t *testing.T) {
 		test.That(t, err, test.ShouldBeNil)
 	})
 	t.Run("Test heading error wraps", func(t *testing.T) {
-		// orientation configured, so update the value for testing
-		orientationValue = 179
-		headingOri, headingSupported, err := sb.headingFunc(context.Background())
-		test.That(t, err, test.ShouldBeNil)
-		test.That(t, headingSupported, test.ShouldBeTrue)
-		// validate the orientation updated
-		test.That(t, headingOri, test.ShouldEqual, 179)
-
 		// test -179 -> 179 results in a small error
-		headingErr, err := sb.calcHeadingControl(ctx, -179)
-		test.That(t, err, test.ShouldBeNil)
-		test.That(t, headingErr, test.ShouldEqual, 2)
+		test.That(t, headingControl(-179, 179), test.ShouldEqual, 2*headingGain)
 
 		// test full circle results in 0 error
-		headingErr2, err := sb.calcHeadingControl(ctx, 360+179)
-		test.That(t, err, test.ShouldBeNil)
-		test.That(t, headingErr2, test.ShouldEqual, 0)
+		test.That(t, headingControl(360+179, 179), test.ShouldEqual, 0)
 		for i := -720; i <= 720; i += 30 {
-			headingErr, err := sb.calcHeadingControl(ctx, float64(i))
-			test.That(t, err, test.ShouldBeNil)
-			test.That(t, headingErr, test.ShouldBeBetweenOrEqual, -180, 180)
+			test.That(t, headingControl(float64(i), 179), test.ShouldBeBetweenOrEqual, -180*headingGain, 180*headingGain)
+		}
+	})
+}
+
+func TestOuterControllers(t *testing.T) {
+	start := time.Unix(0, 0)
+
+	t.Run("MoveStraight with a position sensor", func(t *testing.T) {
+		initPos := geo.NewPoint(40, -74)
+		c := &straightController{
+			distanceMm: 1000, mmPerSec: 100, slowDownDist: calcSlowDownDist(1000), initialHeading: 10, initPos: initPos,
 		}
-		orientationValue = defaultOrientationValue
+		test.That(t, c.fields(), test.ShouldResemble, sampleFields{heading: true, position: true})
+
+		linVel, angVel, done := c.step(sensorSample{time: start, heading: 5, position: initPos})
+		test.That(t, done, test.ShouldBeFalse)
+		test.That(t, linVel, test.ShouldEqual, 100)
+		test.That(t, angVel, test.ShouldEqual, 5)
+
+		_, _, done = c.step(sensorSample{time: start, heading: 10, position: initPos.PointAtDistanceAndBearing(0.002, 0)})
+		test.That(t, done, test.ShouldBeTrue)
 	})
+
+	t.Run("MoveStraight from linear velocity", func(t *testing.T) {
+		c := &straightController{distanceMm: 100, mmPerSec: 100, slowDownDist: calcSlowDownDist(100), prevTime: start}
+		test.That(t, c.fields(), test.ShouldResemble, sampleFields{heading: true, linearVelocity: true})
+
+		_, _, done := c.step(sensorSample{time: start.Add(500 * time.Millisecond), linVel: 0.1})
+		test.That(t, done, test.ShouldBeFalse)
+		test.That(t, c.currDistMm, test.ShouldAlmostEqual, 50)
+		_, _, done = c.step(sensorSample{time: start.Add(1100 * time.Millisecond), linVel: 0.1})
+		test.That(t, done, test.ShouldBeTrue)
+	})
+
+	t.Run("Spin from heading", func(t *testing.T) {
+		c := &spinController{angleDeg: 90, degsPerSec: 10, slowDownAng: calcSlowDownAng(90), hasOrientation: true, prevAngle: 170}
+		test.That(t, c.fields(), test.ShouldResemble, sampleFields{heading: true})
+
+		// The heading wraps from 180 to -180 partway through.
+		linVel, angVel, done := c.step(sensorSample{time: start, heading: -150})
+		test.That(t, done, test.ShouldBeFalse)
+		test.That(t, linVel, test.ShouldEqual, 0)
+		test.That(t, angVel, test.ShouldEqual, 10)
+		test.That(t, c.angMoved, test.ShouldEqual, 40)
+
+		_, _, done = c.step(sensorSample{time: start, heading: -100})
+		test.That(t, done, test.ShouldBeTrue)
+	})
+}
+
+func TestCascadedState(t *testing.T) {
+	var mu sync.Mutex
+	calls := map[string]int{}
+	count := func(name string) {
+		mu.Lock()
+		defer mu.Unlock()
+		calls[name]++
+	}
+	ms := &inject.MovementSensor{
+		LinearVelocityFunc: func(ctx context.Context, extra map[string]interface{}) (r3.Vector, error) {
+			count("linear")
+			return r3.Vector{Y: 0.5}, nil
+		},
+		AngularVelocityFunc: func(ctx context.Context, extra map[string]interface{}) (spatialmath.AngularVelocity, error) {
+			count("angular")
+			return spatialmath.AngularVelocity{Z: 20}, nil
+		},
+		PositionFunc: func(ctx context.Context, extra map[string]interface{}) (*geo.Point, float64, error) {
+			count("position")
+			return geo.NewPoint(40, -74), 0, nil
+		},
+	}
+	sb := &sensorBase{
+		logger:     logging.NewTestLogger(t),
+		conf:       &Config{CascadedControl: true},
+		velocities: ms,
+		position:   ms,
+		headingFunc: func(ctx context.Context) (float64, bool, error) {
+			count("heading")
+			return 0, true, nil
+		},
+	}
+
+	// Without a MoveStraight or Spin running, only the velocities are read.
+	state, err := sb.State(context.Background())
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, state, test.ShouldResemble, []float64{0.5, 20})
+	test.That(t, calls, test.ShouldResemble, map[string]int{"linear": 1, "angular": 1})
+
+	// A running MoveStraight steps on the same sample, reading each sensor once.
+	initPos := geo.NewPoint(40, -74).PointAtDistanceAndBearing(0.001, 0)
+	cas := &cascade{
+		controller: &straightController{distanceMm: 0, mmPerSec: 100, initPos: initPos},
+		done:       make(chan struct{}),
+	}
+	sb.cascade = cas
+	calls = map[string]int{}
+	state, err = sb.State(context.Background())
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, state, test.ShouldResemble, []float64{0.5, 20})
+	test.That(t, calls, test.ShouldResemble, map[string]int{"linear": 1, "angular": 1, "heading": 1, "position": 1})
+	// It was already past its goal.
+	<-cas.done
+	test.That(t, cas.err, test.ShouldBeNil)
+
+	// Once it has finished, it is no longer stepped.
+	calls = map[string]int{}
+	_, err = sb.State(context.Background())
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, calls, test.ShouldResemble, map[string]int{"linear": 1, "angular": 1})
 }
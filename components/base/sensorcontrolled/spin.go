@@ -2,7 +2,6 @@ package sensorcontrolled
 
 import (
 	"context"
-	"errors"
 	"math"
 	"time"
 )
@@ -53,87 +52,71 @@ func (sb *sensorBase) Spin(ctx context.Context, angleDeg, degsPerSec float64, ex
 	// This prevents any residual signals in the control loop from "kicking" the robot
 	sb.loop.Pause()
 	sb.loop.Resume()
-	var angErr, angMoved float64
 
 	// to keep the signs simple, ensure degsPerSec is positive and let angleDeg handle the direction of the spin
 	if degsPerSec < 0 {
 		angleDeg = -angleDeg
 		degsPerSec = -degsPerSec
 	}
-	slowDownAng := calcSlowDownAng(angleDeg)
-
-	ticker := time.NewTicker(time.Duration(1000./sb.controlLoopConfig.Frequency) * time.Millisecond)
-	defer ticker.Stop()
 
 	// timeout duration is a multiplier times the expected time to perform a movement
 	spinTimeEst := time.Duration(int(time.Second) * int(math.Abs(angleDeg/degsPerSec)))
-	startTime := time.Now()
 	timeOut := 5 * spinTimeEst
 	if timeOut < 10*time.Second {
 		timeOut = 10 * time.Second
 	}
-	prevTime := startTime
 
-	for {
-		if err := ctx.Err(); err != nil {
-			ticker.Stop()
-			return err
-		}
+	c := &spinController{
+		angleDeg:       angleDeg,
+		degsPerSec:     degsPerSec,
+		slowDownAng:    calcSlowDownAng(angleDeg),
+		hasOrientation: hasOrientation,
+		prevAngle:      prevAngle,
+		prevTime:       time.Now(),
+	}
+	return sb.runOuterLoop(ctx, c, timeOut, "Spin")
+}
 
-		select {
-		case <-ctx.Done():
-			// do not return context canceled errors, just log them
-			if errors.Is(ctx.Err(), context.Canceled) {
-				sb.logger.Error(ctx.Err())
-				return nil
-			}
-			return err
-		case <-ticker.C:
-
-			if hasOrientation {
-				currYaw, _, err := sb.headingFunc(ctx)
-				if err != nil {
-					return err
-				}
-				// use initial angle to get the current angle the spin has moved
-				angMoved = getMovedAng(prevAngle, currYaw, angMoved)
-
-				// track the previous angle to compute how much we moved with each iteration
-				prevAngle = currYaw
-			} else {
-				currTime := time.Now()
-				angVels, err := sb.velocities.AngularVelocity(ctx, nil)
-				if err != nil {
-					return err
-				}
-				deltaTime := currTime.Sub(prevTime).Seconds()
-				// calculate the estimated change in angle based on the latest angular velocity
-				deltaAngDeg := angVels.Z * deltaTime
-				angMoved += deltaAngDeg
-
-				// track time for the velocity integration
-				prevTime = currTime
-			}
-
-			// compute the error
-			angErr = (angleDeg - angMoved)
-
-			if math.Abs(angErr) < boundCheckTarget {
-				return sb.Stop(ctx, nil)
-			}
-			angVel := calcAngVel(angErr, degsPerSec, slowDownAng)
-
-			if err := sb.updateControlConfig(ctx, 0, angVel); err != nil {
-				return err
-			}
-
-			// check if the duration of the spin exceeds the expected length of the spin
-			if time.Since(startTime) > timeOut {
-				sb.logger.CWarn(ctx, "exceeded time for Spin call, stopping base")
-				return sb.Stop(ctx, nil)
-			}
-		}
+// spinController is the outer controller of Spin. It turns the base the requested angle.
+type spinController struct {
+	angleDeg    float64
+	degsPerSec  float64
+	slowDownAng float64
+	// Without an orientation, the angle moved is estimated from the angular velocity since
+	// prevTime rather than from the change in heading since prevAngle.
+	hasOrientation bool
+	prevAngle      float64
+	prevTime       time.Time
+	angMoved       float64
+}
+
+func (c *spinController) fields() sampleFields {
+	return sampleFields{heading: c.hasOrientation, angularVelocity: !c.hasOrientation}
+}
+
+func (c *spinController) step(s sensorSample) (float64, float64, bool) {
+	if c.hasOrientation {
+		// use initial angle to get the current angle the spin has moved
+		c.angMoved = getMovedAng(c.prevAngle, s.heading, c.angMoved)
+
+		// track the previous angle to compute how much we moved with each iteration
+		c.prevAngle = s.heading
+	} else {
+		deltaTime := s.time.Sub(c.prevTime).Seconds()
+		// calculate the estimated change in angle based on the latest angular velocity
+		c.angMoved += s.angVel * deltaTime
+
+		// track time for the velocity integration
+		c.prevTime = s.time
+	}
+
+	// compute the error
+	angErr := c.angleDeg - c.angMoved
+
+	if math.Abs(angErr) < boundCheckTarget {
+		return 0, 0, true
 	}
+	return 0, calcAngVel(angErr, c.degsPerSec, c.slowDownAng), false
 }
 
 // calcSlowDownAng computes the angle at which the spin should begin to slow down.
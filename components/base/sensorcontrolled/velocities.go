@@ -131,16 +131,27 @@ func (sb *sensorBase) SetState(ctx context.Context, state []*control.Signal) err
 // instantiated in this file. It is a helper function to call the sensor-controlled base's
 // movementsensor and insert its LinearVelocity and AngularVelocity values
 // in the signal in the control loop's thread in the endpoint code.
+// With cascaded control, a running MoveStraight or Spin also takes its step here, from the same
+// sample of the sensors.
 func (sb *sensorBase) State(ctx context.Context) ([]float64, error) {
 	sb.logger.CDebug(ctx, "getting state")
-	linvel, err := sb.velocities.LinearVelocity(ctx, nil)
-	if err != nil {
-		return []float64{}, err
+	fields := sampleFields{linearVelocity: true, angularVelocity: true}
+	cas := sb.activeCascade()
+	if cas != nil {
+		outerFields := cas.controller.fields()
+		fields.heading = outerFields.heading
+		fields.position = outerFields.position
 	}
 
-	angvel, err := sb.velocities.AngularVelocity(ctx, nil)
+	s, err := sb.sample(ctx, fields)
 	if err != nil {
+		if cas != nil {
+			cas.finish(err)
+		}
 		return []float64{}, err
 	}
-	return []float64{linvel.Y, angvel.Z}, nil
+	if cas != nil {
+		sb.stepCascade(ctx, cas, s)
+	}
+	return []float64{s.linVel, s.angVel}, nil
 }
@@ -58,9 +58,14 @@ func NewBoard(
 		workers: utils.NewStoppableWorkers(),
 
 		analogReaders: map[string]*wrappedAnalogReader{},
+		spiBuses:      map[string]buses.SPI{},
+		mcp3008s:      map[mcp3008Key]*mcp3008helper.MCP3008{},
 		gpios:         map[string]*gpioPin{},
 		interrupts:    map[string]*digitalInterrupt{},
+		softwarePwm:   newSoftwarePwmScheduler(),
+		analogSampler: pinwrappers.NewAnalogSampler(logger),
 	}
+	b.workers.AddWorkers(b.softwarePwm.run)
 
 	if err := b.Reconfigure(ctx, nil, conf); err != nil {
 		return nil, err
@@ -193,6 +198,39 @@ func (b *Board) reconfigureGpios(newConf *LinuxBoardConfig) error {
 	return nil
 }
 
+// mcp3008 returns the ADC on the given bus and chip select. All channels of a chip share one
+// MCP3008 such that their reads can be batched, and all chips on a bus share the bus's open devices.
+// Both live as long as the board.
+func (b *Board) mcp3008(spiBus, chipSelect string) *mcp3008helper.MCP3008 {
+	key := mcp3008Key{spiBus: spiBus, chipSelect: chipSelect}
+	if dev, ok := b.mcp3008s[key]; ok {
+		return dev
+	}
+
+	bus, ok := b.spiBuses[spiBus]
+	if !ok {
+		bus = buses.NewSpiBus(spiBus)
+		b.spiBuses[spiBus] = bus
+	}
+	dev := mcp3008helper.NewMCP3008(bus, chipSelect)
+	b.mcp3008s[key] = dev
+	return dev
+}
+
+// smoothAnalogReader returns a smoother for the configured channel, sampled along with the other
+// channels of its chip.
+func (b *Board) smoothAnalogReader(c mcp3008helper.MCP3008AnalogConfig, channel int) *pinwrappers.AnalogSmoother {
+	dev := b.mcp3008(c.SPIBus, c.ChipSelect)
+	return b.analogSampler.SmoothAnalogReader(dev, dev.AnalogReader(channel), board.AnalogReaderConfig{
+		AverageOverMillis: c.AverageOverMillis, SamplesPerSecond: c.SamplesPerSecond,
+	})
+}
+
+type mcp3008Key struct {
+	spiBus     string
+	chipSelect string
+}
+
 func (b *Board) reconfigureAnalogReaders(ctx context.Context, newConf *LinuxBoardConfig) error {
 	stillExists := map[string]struct{}{}
 	for _, c := range newConf.AnalogReaders {
@@ -201,24 +239,14 @@ func (b *Board) reconfigureAnalogReaders(ctx context.Context, newConf *LinuxBoar
 			return errors.Errorf("bad analog pin (%s)", c.Pin)
 		}
 
-		bus := buses.NewSpiBus(c.SPIBus)
-
 		stillExists[c.Name] = struct{}{}
 		if curr, ok := b.analogReaders[c.Name]; ok {
 			if curr.chipSelect != c.ChipSelect {
-				ar := &mcp3008helper.MCP3008AnalogReader{channel, bus, c.ChipSelect}
-				curr.reset(ctx, curr.chipSelect,
-					pinwrappers.SmoothAnalogReader(ar, board.AnalogReaderConfig{
-						AverageOverMillis: c.AverageOverMillis, SamplesPerSecond: c.SamplesPerSecond,
-					}, b.logger))
+				curr.reset(ctx, curr.chipSelect, b.smoothAnalogReader(c, channel))
 			}
 			continue
 		}
-		ar := &mcp3008helper.MCP3008AnalogReader{channel, bus, c.ChipSelect}
-		b.analogReaders[c.Name] = newWrappedAnalogReader(ctx, c.ChipSelect,
-			pinwrappers.SmoothAnalogReader(ar, board.AnalogReaderConfig{
-				AverageOverMillis: c.AverageOverMillis, SamplesPerSecond: c.SamplesPerSecond,
-			}, b.logger))
+		b.analogReaders[c.Name] = newWrappedAnalogReader(ctx, c.ChipSelect, b.smoothAnalogReader(c, channel))
 	}
 
 	for name := range b.analogReaders {
@@ -337,9 +365,10 @@ func (b *Board) reconfigureInterrupts(newConf *LinuxBoardConfig) error {
 
 func (b *Board) createGpioPin(mapping GPIOBoardMapping) *gpioPin {
 	pin := gpioPin{
-		devicePath: mapping.GPIOChipDev,
-		offset:     uint32(mapping.GPIO),
-		logger:     b.logger,
+		devicePath:  mapping.GPIOChipDev,
+		offset:      uint32(mapping.GPIO),
+		softwarePwm: b.softwarePwm,
+		logger:      b.logger,
 	}
 	if mapping.HWPWMSupported {
 		pin.hwPwm = newPwmDevice(mapping.PWMSysFsDir, mapping.PWMID, b.logger)
@@ -355,10 +384,15 @@ type Board struct {
 
 	gpioMappings  map[string]GPIOBoardMapping
 	analogReaders map[string]*wrappedAnalogReader
+	spiBuses      map[string]buses.SPI
+	mcp3008s      map[mcp3008Key]*mcp3008helper.MCP3008
+	analogSampler *pinwrappers.AnalogSampler
 	logger        logging.Logger
 
 	gpios      map[string]*gpioPin
 	interrupts map[string]*digitalInterrupt
+	// softwarePwm outputs the PWM signals of every pin that doesn't use hardware PWM.
+	softwarePwm *softwarePwmScheduler
 
 	workers utils.StoppableWorkers
 }
@@ -504,5 +538,9 @@ func (b *Board) Close(ctx context.Context) error {
 	for _, reader := range b.analogReaders {
 		err = multierr.Combine(err, reader.Close(ctx))
 	}
+	b.analogSampler.Close()
+	for _, bus := range b.spiBuses {
+		err = multierr.Combine(err, bus.Close(ctx))
+	}
 	return err
 }
@@ -22,8 +22,10 @@ func init() {
 }
 
 // I2cBus represents an I2C bus. You can use it to create handles for devices at specific
-// addresses on the bus. Creating a handle locks the bus, and closing the handle unlocks the bus
-// again, so that you can only communicate with 1 device on the bus at a time.
+// addresses on the bus. Creating a handle locks the device's address, and closing the handle
+// unlocks it again, so that only one handle talks to a device at a time. The bus itself is only
+// held for the duration of each transaction, with waiting transactions from different devices
+// ordered by an i2cScheduler.
 type i2cBus struct {
 	// Despite the type name BusCloser, this is the I2C bus itself (plus a way to close itself when
 	// it's done, though we never use that because we want to keep it open until the entire process
@@ -31,15 +33,31 @@ type i2cBus struct {
 	closeableBus i2c.BusCloser
 	mu           sync.Mutex
 	deviceName   string
+	deviceLocks  map[byte]*sync.Mutex
+	*i2cScheduler
 }
 
+// sharedI2cBuses holds one i2cBus per device name, such that the transactions of every component
+// using a physical bus go through the same scheduler.
+var (
+	sharedI2cBusesMu sync.Mutex
+	sharedI2cBuses   = map[string]*i2cBus{}
+)
+
 // NewI2cBus creates a new I2C (the public interface) object (implemented as the private i2cBus
-// struct).
+// struct). All calls with the same device name share one i2cBus.
 func NewI2cBus(deviceName string) (I2C, error) {
-	b := &i2cBus{}
+	sharedI2cBusesMu.Lock()
+	defer sharedI2cBusesMu.Unlock()
+	if b, ok := sharedI2cBuses[deviceName]; ok {
+		return b, nil
+	}
+
+	b := &i2cBus{deviceLocks: map[byte]*sync.Mutex{}, i2cScheduler: newI2CScheduler()}
 	if err := b.reset(deviceName); err != nil {
 		return nil, err
 	}
+	sharedI2cBuses[deviceName] = b
 	return b, nil
 }
 
@@ -59,42 +77,69 @@ func (bus *i2cBus) reset(deviceName string) error {
 }
 
 // OpenHandle lets the i2cBus type implement the I2C interface. It returns a handle for
-// communicating with a device at a specific I2C handle. Opening a handle locks the I2C bus so
-// nothing else can use it, and closing the handle unlocks the bus again.
+// communicating with a device at a specific I2C handle. Opening a handle locks the device's
+// address so no other handle can use it, and closing the handle unlocks it again.
 func (bus *i2cBus) OpenHandle(addr byte) (I2CHandle, error) {
-	bus.mu.Lock() // Lock the bus so no other handle can use it until this handle is closed.
+	bus.mu.Lock()
+	deviceLock, ok := bus.deviceLocks[addr]
+	if !ok {
+		deviceLock = &sync.Mutex{}
+		bus.deviceLocks[addr] = deviceLock
+	}
+	bus.mu.Unlock()
+
+	deviceLock.Lock() // Lock the device so no other handle can use it until this handle is closed.
 
+	bus.mu.Lock()
+	defer bus.mu.Unlock()
 	// If we haven't yet connected to the bus itself, do so now.
 	if bus.closeableBus == nil {
 		newBus, err := i2creg.Open(bus.deviceName)
 		if err != nil {
-			bus.mu.Unlock() // We never created a handle, so unlock the bus for next time.
+			deviceLock.Unlock() // We never created a handle, so unlock the device for next time.
 			return nil, err
 		}
 		bus.closeableBus = newBus
 	}
 
-	return &I2cHandle{device: &i2c.Dev{Bus: bus.closeableBus, Addr: uint16(addr)}, parentBus: bus}, nil
+	return &I2cHandle{
+		device:     &i2c.Dev{Bus: bus.closeableBus, Addr: uint16(addr)},
+		addr:       addr,
+		parentBus:  bus,
+		deviceLock: deviceLock,
+	}, nil
 }
 
 // I2cHandle represents a way to talk to a specific device on the I2C bus. Creating a handle locks
-// the bus so nothing else can use it, and closing the handle unlocks it again.
+// the device so nothing else can talk to it, and closing the handle unlocks it again.
 type I2cHandle struct { // Implements the I2CHandle interface
-	device    *i2c.Dev // Will become nil if we Close() the handle
-	parentBus *i2cBus
+	device     *i2c.Dev // Will become nil if we Close() the handle
+	addr       byte
+	parentBus  *i2cBus
+	deviceLock *sync.Mutex
+}
+
+// tx performs a single transaction once the scheduler grants this device the bus.
+func (h *I2cHandle) tx(ctx context.Context, w, r []byte) error {
+	release, err := h.parentBus.acquire(ctx, h.addr)
+	if err != nil {
+		return err
+	}
+	defer release()
+	return h.device.Tx(w, r)
 }
 
 // Write writes the given bytes to the handle. For I2C devices that organize their data into
 // registers, prefer using WriteBlockData instead.
 func (h *I2cHandle) Write(ctx context.Context, tx []byte) error {
-	return h.device.Tx(tx, nil)
+	return h.tx(ctx, tx, nil)
 }
 
 // Read reads the given number of bytes from the handle. For I2C devices that organize their data
 // into registers, prefer using ReadBlockData instead.
 func (h *I2cHandle) Read(ctx context.Context, count int) ([]byte, error) {
 	buffer := make([]byte, count)
-	err := h.device.Tx(nil, buffer)
+	err := h.tx(ctx, nil, buffer)
 	if err != nil {
 		return nil, err
 	}
@@ -102,20 +147,20 @@ func (h *I2cHandle) Read(ctx context.Context, count int) ([]byte, error) {
 }
 
 // This is a private helper function, used to implement the rest of the I2CHandle interface.
-func (h *I2cHandle) transactAtRegister(register byte, w, r []byte) error {
+func (h *I2cHandle) transactAtRegister(ctx context.Context, register byte, w, r []byte) error {
 	if w == nil {
 		w = []byte{}
 	}
 	fullW := make([]byte, len(w)+1)
 	fullW[0] = register
 	copy(fullW[1:], w)
-	return h.device.Tx(fullW, r)
+	return h.tx(ctx, fullW, r)
 }
 
 // ReadByteData reads a single byte from the given register on this I2C device.
 func (h *I2cHandle) ReadByteData(ctx context.Context, register byte) (byte, error) {
 	result := make([]byte, 1)
-	err := h.transactAtRegister(register, nil, result)
+	err := h.transactAtRegister(ctx, register, nil, result)
 	if err != nil {
 		return 0, err
 	}
@@ -124,14 +169,14 @@ func (h *I2cHandle) ReadByteData(ctx context.Context, register byte) (byte, erro
 
 // WriteByteData writes a single byte to the given register on this I2C device.
 func (h *I2cHandle) WriteByteData(ctx context.Context, register, data byte) error {
-	return h.transactAtRegister(register, []byte{data}, nil)
+	return h.transactAtRegister(ctx, register, []byte{data}, nil)
 }
 
 // ReadBlockData reads the given number of bytes from the I2C device, starting at the given
 // register.
 func (h *I2cHandle) ReadBlockData(ctx context.Context, register byte, numBytes uint8) ([]byte, error) {
 	result := make([]byte, numBytes)
-	err := h.transactAtRegister(register, nil, result)
+	err := h.transactAtRegister(ctx, register, nil, result)
 	if err != nil {
 		return nil, err
 	}
@@ -140,12 +185,12 @@ func (h *I2cHandle) ReadBlockData(ctx context.Context, register byte, numBytes u
 
 // WriteBlockData writes the given bytes into the given register on the I2C device.
 func (h *I2cHandle) WriteBlockData(ctx context.Context, register byte, data []byte) error {
-	return h.transactAtRegister(register, data, nil)
+	return h.transactAtRegister(ctx, register, data, nil)
 }
 
-// Close closes the handle to the device, and unlocks the I2C bus.
+// Close closes the handle to the device, and unlocks the device.
 func (h *I2cHandle) Close() error {
-	defer h.parentBus.mu.Unlock() // Unlock the entire bus so someone else can use it
+	defer h.deviceLock.Unlock() // Unlock the device so another handle can use it
 	h.device = nil
 	// Don't close the bus itself: it should remain open for other handles to use
 	return nil
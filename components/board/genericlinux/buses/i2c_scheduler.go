@@ -0,0 +1,246 @@
+package buses
+
+import (
+	"container/heap"
+	"context"
+	"sync"
+	"time"
+)
+
+// I2CPriority is the scheduling class of the transactions of a device on a shared I2C bus.
+type I2CPriority int
+
+const (
+	// I2CPriorityNormal is the default class. Its transactions should start within 10ms.
+	I2CPriorityNormal I2CPriority = iota
+	// I2CPriorityRealtime is for devices polled at high rates, such as IMUs. Its transactions
+	// should start within 1ms.
+	I2CPriorityRealtime
+	// I2CPriorityBackground is for devices that are read continuously but are not latency
+	// sensitive, such as GPS receivers streaming NMEA data. Its transactions should start within
+	// 100ms.
+	I2CPriorityBackground
+)
+
+// latencyBudget is how long a transaction of the class may wait for the bus. Transactions are
+// granted the bus in order of their deadline, which is when they started waiting plus this budget.
+// A flood of transactions from one class thus only delays the others up to their budget.
+func (priority I2CPriority) latencyBudget() time.Duration {
+	switch priority {
+	case I2CPriorityRealtime:
+		return time.Millisecond
+	case I2CPriorityBackground:
+		return 100 * time.Millisecond
+	case I2CPriorityNormal:
+		fallthrough
+	default:
+		return 10 * time.Millisecond
+	}
+}
+
+// I2CLatencyStats describes how long the transactions of a device waited for and held the bus.
+type I2CLatencyStats struct {
+	Transactions int
+	// DeadlinesMissed counts transactions that started after their deadline.
+	DeadlinesMissed int
+	TotalWait       time.Duration
+	MaxWait         time.Duration
+	TotalHold       time.Duration
+	MaxHold         time.Duration
+}
+
+// I2CScheduler is implemented by I2C buses that schedule transactions of different devices.
+type I2CScheduler interface {
+	// SetDevicePriority sets the scheduling class for transactions with the device at `addr`.
+	SetDevicePriority(addr byte, priority I2CPriority)
+	// DeviceLatencies returns the latency stats of every device that has used the bus.
+	DeviceLatencies() map[byte]I2CLatencyStats
+}
+
+// SetI2CDevicePriority sets the priority of a device if the bus schedules transactions, and does
+// nothing otherwise.
+func SetI2CDevicePriority(bus I2C, addr byte, priority I2CPriority) {
+	if scheduler, ok := bus.(I2CScheduler); ok {
+		scheduler.SetDevicePriority(addr, priority)
+	}
+}
+
+type i2cWaiter struct {
+	addr     byte
+	priority I2CPriority
+	deadline time.Time
+	enqueued time.Time
+	seq      uint64
+	granted  chan struct{}
+	index    int
+}
+
+// i2cWaitQueue is a heap ordered by deadline, then priority, then arrival.
+type i2cWaitQueue []*i2cWaiter
+
+func (q i2cWaitQueue) Len() int { return len(q) }
+
+func (q i2cWaitQueue) Less(i, j int) bool {
+	if !q[i].deadline.Equal(q[j].deadline) {
+		return q[i].deadline.Before(q[j].deadline)
+	}
+	if q[i].priority != q[j].priority {
+		return q[i].priority.latencyBudget() < q[j].priority.latencyBudget()
+	}
+	return q[i].seq < q[j].seq
+}
+
+func (q i2cWaitQueue) Swap(i, j int) {
+	q[i], q[j] = q[j], q[i]
+	q[i].index = i
+	q[j].index = j
+}
+
+func (q *i2cWaitQueue) Push(x any) {
+	//nolint:forcetypeassert
+	waiter := x.(*i2cWaiter)
+	waiter.index = len(*q)
+	*q = append(*q, waiter)
+}
+
+func (q *i2cWaitQueue) Pop() any {
+	old := *q
+	waiter := old[len(old)-1]
+	old[len(old)-1] = nil
+	waiter.index = -1
+	*q = old[:len(old)-1]
+	return waiter
+}
+
+// i2cScheduler grants exclusive use of a bus one transaction at a time. Transactions that have to
+// wait are ordered by deadline rather than by whoever grabs a mutex first.
+type i2cScheduler struct {
+	mu         sync.Mutex
+	busy       bool
+	queue      i2cWaitQueue
+	nextSeq    uint64
+	priorities map[byte]I2CPriority
+	stats      map[byte]*I2CLatencyStats
+
+	// now is overridden in tests.
+	now func() time.Time
+}
+
+func newI2CScheduler() *i2cScheduler {
+	return &i2cScheduler{
+		priorities: map[byte]I2CPriority{},
+		stats:      map[byte]*I2CLatencyStats{},
+		now:        time.Now,
+	}
+}
+
+func (s *i2cScheduler) SetDevicePriority(addr byte, priority I2CPriority) {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+	s.priorities[addr] = priority
+}
+
+func (s *i2cScheduler) DeviceLatencies() map[byte]I2CLatencyStats {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+	ret := make(map[byte]I2CLatencyStats, len(s.stats))
+	for addr, stats := range s.stats {
+		ret[addr] = *stats
+	}
+	return ret
+}
+
+// acquire waits until the transaction with the device at `addr` may use the bus. The returned
+// function MUST be called once the transaction is done. The transaction's deadline is the earlier
+// of the context deadline and the device's latency budget.
+func (s *i2cScheduler) acquire(ctx context.Context, addr byte) (func(), error) {
+	s.mu.Lock()
+	enqueued := s.now()
+	priority := s.priorities[addr]
+	deadline := enqueued.Add(priority.latencyBudget())
+	if ctxDeadline, ok := ctx.Deadline(); ok && ctxDeadline.Before(deadline) {
+		deadline = ctxDeadline
+	}
+	waiter := &i2cWaiter{
+		addr:     addr,
+		priority: priority,
+		deadline: deadline,
+		enqueued: enqueued,
+		seq:      s.nextSeq,
+		granted:  make(chan struct{}),
+	}
+	s.nextSeq++
+
+	if !s.busy && len(s.queue) == 0 {
+		s.busy = true
+		s.mu.Unlock()
+		return s.granted(waiter), nil
+	}
+	heap.Push(&s.queue, waiter)
+	s.mu.Unlock()
+
+	select {
+	case <-waiter.granted:
+		return s.granted(waiter), nil
+	case <-ctx.Done():
+		s.mu.Lock()
+		if waiter.index >= 0 {
+			heap.Remove(&s.queue, waiter.index)
+			s.mu.Unlock()
+			return nil, ctx.Err()
+		}
+		s.mu.Unlock()
+		// We were granted the bus as the context was canceled. Pass it on.
+		s.release(waiter, s.now())
+		return nil, ctx.Err()
+	}
+}
+
+// granted records the wait of a transaction that now holds the bus and returns its release
+// function.
+func (s *i2cScheduler) granted(waiter *i2cWaiter) func() {
+	start := s.now()
+	s.mu.Lock()
+	stats, ok := s.stats[waiter.addr]
+	if !ok {
+		stats = &I2CLatencyStats{}
+		s.stats[waiter.addr] = stats
+	}
+	wait := start.Sub(waiter.enqueued)
+	stats.Transactions++
+	stats.TotalWait += wait
+	if wait > stats.MaxWait {
+		stats.MaxWait = wait
+	}
+	if start.After(waiter.deadline) {
+		stats.DeadlinesMissed++
+	}
+	s.mu.Unlock()
+
+	var once sync.Once
+	return func() {
+		once.Do(func() { s.release(waiter, start) })
+	}
+}
+
+// release hands the bus to the waiter with the earliest deadline, if any.
+func (s *i2cScheduler) release(waiter *i2cWaiter, start time.Time) {
+	hold := s.now().Sub(start)
+
+	s.mu.Lock()
+	defer s.mu.Unlock()
+	if stats, ok := s.stats[waiter.addr]; ok {
+		stats.TotalHold += hold
+		if hold > stats.MaxHold {
+			stats.MaxHold = hold
+		}
+	}
+
+	if len(s.queue) == 0 {
+		s.busy = false
+		return
+	}
+	//nolint:forcetypeassert
+	next := heap.Pop(&s.queue).(*i2cWaiter)
+	close(next.granted)
+}
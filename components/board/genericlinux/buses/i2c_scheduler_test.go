@@ -0,0 +1,135 @@
+package buses
+
+import (
+	"context"
+	"sync"
+	"testing"
+	"time"
+
+	"go.viam.com/test"
+	"go.viam.com/utils/testutils"
+)
+
+// simulatedI2CBus runs transactions through a scheduler and records the order devices got the bus.
+type simulatedI2CBus struct {
+	*i2cScheduler
+
+	clockMu sync.Mutex
+	clock   time.Time
+
+	orderMu sync.Mutex
+	order   []byte
+}
+
+func newSimulatedI2CBus() *simulatedI2CBus {
+	bus := &simulatedI2CBus{i2cScheduler: newI2CScheduler(), clock: time.Unix(0, 0)}
+	bus.i2cScheduler.now = func() time.Time {
+		bus.clockMu.Lock()
+		defer bus.clockMu.Unlock()
+		return bus.clock
+	}
+	return bus
+}
+
+func (bus *simulatedI2CBus) advance(d time.Duration) {
+	bus.clockMu.Lock()
+	defer bus.clockMu.Unlock()
+	bus.clock = bus.clock.Add(d)
+}
+
+// transact queues a transaction for `addr` in the background and waits until it is queued.
+func (bus *simulatedI2CBus) transact(t *testing.T, wg *sync.WaitGroup, addr byte) {
+	t.Helper()
+	bus.mu.Lock()
+	queued := len(bus.queue)
+	bus.mu.Unlock()
+
+	wg.Add(1)
+	go func() {
+		defer wg.Done()
+		release, err := bus.acquire(context.Background(), addr)
+		test.That(t, err, test.ShouldBeNil)
+		bus.orderMu.Lock()
+		bus.order = append(bus.order, addr)
+		bus.orderMu.Unlock()
+		release()
+	}()
+
+	testutils.WaitForAssertion(t, func(tb testing.TB) {
+		tb.Helper()
+		bus.mu.Lock()
+		defer bus.mu.Unlock()
+		test.That(tb, len(bus.queue), test.ShouldEqual, queued+1)
+	})
+}
+
+func TestI2CSchedulerOrdersByDeadline(t *testing.T) {
+	const gps, sensor, imu = 0x10, 0x20, 0x68
+
+	bus := newSimulatedI2CBus()
+	bus.SetDevicePriority(gps, I2CPriorityBackground)
+	bus.SetDevicePriority(imu, I2CPriorityRealtime)
+
+	// Hold the bus while transactions pile up behind it.
+	release, err := bus.acquire(context.Background(), sensor)
+	test.That(t, err, test.ShouldBeNil)
+
+	var wg sync.WaitGroup
+	bus.transact(t, &wg, gps)
+	bus.transact(t, &wg, sensor)
+	bus.transact(t, &wg, imu)
+	bus.advance(5 * time.Millisecond)
+	release()
+	wg.Wait()
+
+	// The IMU is served first even though it queued last.
+	test.That(t, bus.order, test.ShouldResemble, []byte{imu, sensor, gps})
+
+	stats := bus.DeviceLatencies()
+	test.That(t, stats[imu].Transactions, test.ShouldEqual, 1)
+	test.That(t, stats[imu].MaxWait, test.ShouldEqual, 5*time.Millisecond)
+	test.That(t, stats[imu].DeadlinesMissed, test.ShouldEqual, 1)
+	test.That(t, stats[sensor].Transactions, test.ShouldEqual, 2)
+	test.That(t, stats[sensor].MaxHold, test.ShouldEqual, 5*time.Millisecond)
+	test.That(t, stats[sensor].DeadlinesMissed, test.ShouldEqual, 0)
+	test.That(t, stats[gps].DeadlinesMissed, test.ShouldEqual, 0)
+}
+
+func TestI2CSchedulerDoesNotStarveBackground(t *testing.T) {
+	const gps, imu = 0x10, 0x68
+
+	bus := newSimulatedI2CBus()
+	bus.SetDevicePriority(gps, I2CPriorityBackground)
+	bus.SetDevicePriority(imu, I2CPriorityRealtime)
+
+	release, err := bus.acquire(context.Background(), imu)
+	test.That(t, err, test.ShouldBeNil)
+
+	// Once the GPS transaction has waited out its budget, it goes ahead of fresh IMU transactions.
+	var wg sync.WaitGroup
+	bus.transact(t, &wg, gps)
+	bus.advance(100 * time.Millisecond)
+	bus.transact(t, &wg, imu)
+	release()
+	wg.Wait()
+
+	test.That(t, bus.order, test.ShouldResemble, []byte{gps, imu})
+}
+
+func TestI2CSchedulerCanceledWaiter(t *testing.T) {
+	bus := newSimulatedI2CBus()
+	release, err := bus.acquire(context.Background(), 1)
+	test.That(t, err, test.ShouldBeNil)
+
+	ctx, cancel := context.WithCancel(context.Background())
+	cancel()
+	_, err = bus.acquire(ctx, 2)
+	test.That(t, err, test.ShouldEqual, context.Canceled)
+	test.That(t, len(bus.queue), test.ShouldEqual, 0)
+
+	// The bus is free again once the holder releases it.
+	release()
+	release, err = bus.acquire(context.Background(), 2)
+	test.That(t, err, test.ShouldBeNil)
+	release()
+}
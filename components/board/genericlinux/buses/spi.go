@@ -10,6 +10,7 @@ import (
 
 	"github.com/pkg/errors"
 	"go.uber.org/multierr"
+	"go.viam.com/utils"
 	"periph.io/x/conn/v3/physic"
 	"periph.io/x/conn/v3/spi"
 	"periph.io/x/conn/v3/spi/spireg"
@@ -17,9 +18,9 @@ import (
 
 // NewSpiBus creates a new SPI bus. The name passed in should be the bus number, such as "0" or
 // "1". We don't open this bus until you call spiHandle.Xfer(), so there are no errors to return
-// immediately here.
+// immediately here. Devices opened by Xfer() stay open until the bus is closed.
 func NewSpiBus(name string) SPI {
-	bus := spiBus{}
+	bus := spiBus{conns: map[spiConnKey]*spiConn{}}
 	bus.reset(name)
 	return &bus
 }
@@ -28,6 +29,22 @@ type spiBus struct {
 	mu         sync.Mutex
 	openHandle *spiHandle
 	bus        atomic.Pointer[string]
+	// conns caches connected devices such that transfers do not have to open and configure the
+	// device each time. It is only accessed while holding `mu`.
+	conns map[spiConnKey]*spiConn
+}
+
+// spiConnKey identifies a device on a bus along with the settings it was connected with.
+type spiConnKey struct {
+	bus        string
+	chipSelect string
+	baud       uint
+	mode       uint
+}
+
+type spiConn struct {
+	port spi.PortCloser
+	conn spi.Conn
 }
 
 type spiHandle struct {
@@ -41,37 +58,101 @@ func (sb *spiBus) OpenHandle() (SPIHandle, error) {
 	return sb.openHandle, nil
 }
 
+// Close closes every device opened on the bus. It waits for any open handle to be closed first.
 func (sb *spiBus) Close(ctx context.Context) error {
-	return nil
+	sb.mu.Lock()
+	defer sb.mu.Unlock()
+	var err error
+	for key, cached := range sb.conns {
+		err = multierr.Combine(err, cached.port.Close())
+		delete(sb.conns, key)
+	}
+	return err
 }
 
 func (sb *spiBus) reset(bus string) {
 	sb.bus.Store(&bus)
 }
 
-func (sh *spiHandle) Xfer(ctx context.Context, baud uint, chipSelect string, mode uint, tx []byte) (rx []byte, err error) {
-	if sh.isClosed {
-		return nil, errors.New("can't use Xfer() on an already closed SPIHandle")
-	}
-
-	busPtr := sh.bus.bus.Load()
+// conn returns a connection to the given device, opening and caching it if needed. The caller must
+// hold `sb.mu`.
+func (sb *spiBus) conn(baud uint, chipSelect string, mode uint) (spi.Conn, error) {
+	busPtr := sb.bus.Load()
 	if busPtr == nil {
 		return nil, errors.New("no bus selected")
 	}
 
+	key := spiConnKey{bus: *busPtr, chipSelect: chipSelect, baud: baud, mode: mode}
+	if cached, ok := sb.conns[key]; ok {
+		return cached.conn, nil
+	}
+
 	port, err := spireg.Open(fmt.Sprintf("SPI%s.%s", *busPtr, chipSelect))
 	if err != nil {
 		return nil, err
 	}
-	defer func() {
-		err = multierr.Combine(err, port.Close())
-	}()
 	conn, err := port.Connect(physic.Hertz*physic.Frequency(baud), spi.Mode(mode), 8)
 	if err != nil {
+		return nil, multierr.Combine(err, port.Close())
+	}
+	sb.conns[key] = &spiConn{port: port, conn: conn}
+	return conn, nil
+}
+
+// dropConn closes a cached connection after a failed transfer, such that the next transfer starts
+// from a freshly opened device. The caller must hold `sb.mu`.
+func (sb *spiBus) dropConn(baud uint, chipSelect string, mode uint) {
+	busPtr := sb.bus.Load()
+	if busPtr == nil {
+		return
+	}
+	key := spiConnKey{bus: *busPtr, chipSelect: chipSelect, baud: baud, mode: mode}
+	if cached, ok := sb.conns[key]; ok {
+		delete(sb.conns, key)
+		utils.UncheckedError(cached.port.Close())
+	}
+}
+
+func (sh *spiHandle) Xfer(ctx context.Context, baud uint, chipSelect string, mode uint, tx []byte) ([]byte, error) {
+	if sh.isClosed {
+		return nil, errors.New("can't use Xfer() on an already closed SPIHandle")
+	}
+
+	conn, err := sh.bus.conn(baud, chipSelect, mode)
+	if err != nil {
+		return nil, err
+	}
+	rx := make([]byte, len(tx))
+	if err := conn.Tx(tx, rx); err != nil {
+		sh.bus.dropConn(baud, chipSelect, mode)
+		return nil, err
+	}
+	return rx, nil
+}
+
+// XferBatch submits all transfers to the kernel in a single SPI_IOC_MESSAGE call. The chip select
+// is released between transfers.
+func (sh *spiHandle) XferBatch(ctx context.Context, baud uint, chipSelect string, mode uint, txs [][]byte) ([][]byte, error) {
+	if sh.isClosed {
+		return nil, errors.New("can't use XferBatch() on an already closed SPIHandle")
+	}
+
+	conn, err := sh.bus.conn(baud, chipSelect, mode)
+	if err != nil {
+		return nil, err
+	}
+
+	rxs := make([][]byte, len(txs))
+	packets := make([]spi.Packet, len(txs))
+	for i, tx := range txs {
+		rxs[i] = make([]byte, len(tx))
+		packets[i] = spi.Packet{W: tx, R: rxs[i], KeepCS: false}
+	}
+	if err := conn.TxPackets(packets); err != nil {
+		sh.bus.dropConn(baud, chipSelect, mode)
 		return nil, err
 	}
-	rx = make([]byte, len(tx))
-	return rx, conn.Tx(tx, rx)
+	return rxs, nil
 }
 
 func (sh *spiHandle) Close() error {
@@ -31,3 +31,44 @@ type SPIHandle interface {
 	// Close closes the handle and releases the lock on the bus.
 	Close() error
 }
+
+// SPIBatchHandle is an SPIHandle that can submit several transfers to the same device at once.
+type SPIBatchHandle interface {
+	SPIHandle
+
+	// XferBatch performs each of the transfers in order, as if by consecutive calls to Xfer, but
+	// without returning to the caller in between. The i'th returned slice holds the bytes received
+	// during the i'th transfer.
+	XferBatch(
+		ctx context.Context,
+		baud uint,
+		chipSelect string,
+		mode uint,
+		txs [][]byte,
+	) ([][]byte, error)
+}
+
+// XferBatch performs several transfers on the handle. It uses a single batched submission when the
+// handle supports it, and otherwise falls back to one Xfer per transfer.
+func XferBatch(
+	ctx context.Context,
+	handle SPIHandle,
+	baud uint,
+	chipSelect string,
+	mode uint,
+	txs [][]byte,
+) ([][]byte, error) {
+	if batchHandle, ok := handle.(SPIBatchHandle); ok {
+		return batchHandle.XferBatch(ctx, baud, chipSelect, mode, txs)
+	}
+
+	rxs := make([][]byte, 0, len(txs))
+	for _, tx := range txs {
+		rx, err := handle.Xfer(ctx, baud, chipSelect, mode, tx)
+		if err != nil {
+			return nil, err
+		}
+		rxs = append(rxs, rx)
+	}
+	return rxs, nil
+}
@@ -7,14 +7,12 @@ package genericlinux
 import (
 	"context"
 	"sync"
-	"time"
 
 	"github.com/mkch/gpio"
 	"github.com/pkg/errors"
 	"go.viam.com/utils"
 
 	"go.viam.com/rdk/logging"
-	rdkutils "go.viam.com/rdk/utils"
 )
 
 const noPin = 0xFFFFFFFF // noPin is the uint32 version of -1. A pin with this offset has no GPIO
@@ -30,7 +28,10 @@ type gpioPin struct {
 	hwPwm           *pwmDevice // Defined in hw_pwm.go, will be nil for pins that don't support it.
 	pwmFreqHz       uint
 	pwmDutyCyclePct float64
-	softwarePwm     rdkutils.StoppableWorkers
+	// softwarePwm is shared by every pin on the board. softwarePwmRunning is whether it is
+	// currently outputting a signal on this pin.
+	softwarePwm        *softwarePwmScheduler
+	softwarePwmRunning bool
 
 	mu     sync.Mutex
 	logger logging.Logger
@@ -110,11 +111,8 @@ func (pin *gpioPin) Set(ctx context.Context, isHigh bool,
 	pin.mu.Lock()
 	defer pin.mu.Unlock()
 
-	// Shut down any software PWM loop that might be running.
-	if pin.softwarePwm != nil {
-		pin.softwarePwm.Stop()
-		pin.softwarePwm = nil
-	}
+	// Shut down any software PWM signal that might be running.
+	pin.stopSoftwarePWM()
 
 	return pin.setInternal(isHigh)
 }
@@ -168,20 +166,18 @@ func (pin *gpioPin) Get(
 	return (value != 0), nil
 }
 
-// Lock the mutex before calling this! We'll spin up a background goroutine to create a PWM signal
-// in software, if we're supposed to and one isn't already running.
+// Lock the mutex before calling this! We'll have the board's software PWM scheduler create a PWM
+// signal in software, if we're supposed to.
 func (pin *gpioPin) startSoftwarePWM() error {
 	if pin.pwmDutyCyclePct == 0 || pin.pwmFreqHz == 0 {
-		// We don't have both parameters set up. Stop any PWM loop we might have started previously.
-		if pin.softwarePwm != nil {
-			pin.softwarePwm.Stop()
-			pin.softwarePwm = nil
-		}
+		// We don't have both parameters set up. Stop any PWM signal we might have started
+		// previously.
+		pin.stopSoftwarePWM()
 		if pin.hwPwm != nil {
 			return pin.hwPwm.Close()
 		}
-		// If we used to have a software PWM loop, we might have stopped the loop while the pin was
-		// on. Remember to turn it off!
+		// If we used to have a software PWM signal, we might have stopped it while the pin was on.
+		// Remember to turn it off!
 		return pin.setInternal(false)
 	}
 
@@ -191,112 +187,47 @@ func (pin *gpioPin) startSoftwarePWM() error {
 			if err := pin.closeGpioFd(); err != nil {
 				return err
 			}
-			// Shut down any software PWM loop that might be running.
-			if pin.softwarePwm != nil {
-				pin.softwarePwm.Stop()
-				pin.softwarePwm = nil
-			}
+			// Shut down any software PWM signal that might be running.
+			pin.stopSoftwarePWM()
 			return pin.hwPwm.SetPwm(pin.pwmFreqHz, pin.pwmDutyCyclePct)
 		}
 		// Although this pin has hardware PWM support, many PWM chips cannot output signals at
 		// frequencies this low. Stop any hardware PWM, and fall through to using a software PWM
-		// loop below.
+		// signal below.
 		if err := pin.hwPwm.Close(); err != nil {
 			return err
 		}
 	}
 
-	// If we get here, we need a software loop to drive the PWM signal, either because this pin
-	// doesn't have hardware support or because we want to drive it at such a low frequency that
-	// the hardware chip can't do it.
-	if pin.softwarePwm != nil {
-		// We already have a software PWM loop running. It will pick up the changes on its own.
-		return nil
-	}
-
-	pin.softwarePwm = rdkutils.NewStoppableWorkers(pin.softwarePwmLoop)
+	// If we get here, we need to drive the PWM signal in software, either because this pin doesn't
+	// have hardware support or because we want to drive it at such a low frequency that the
+	// hardware chip can't do it. If the signal is already running, this updates its parameters.
+	pin.softwarePwm.setSignal(pin, pin.pwmFreqHz, pin.pwmDutyCyclePct)
+	pin.softwarePwmRunning = true
 	return nil
 }
 
-// accurateSleep is intended to be a replacement for utils.SelectContextOrWait which wakes up
-// closer to when it's supposed to. We return whether the context is still valid (not yet
-// cancelled).
-func accurateSleep(ctx context.Context, duration time.Duration) bool {
-	// If we use utils.SelectContextOrWait(), we will wake up sometime after when we're supposed
-	// to, which can be hundreds of microseconds later (because the process scheduler in the OS only
-	// schedules things every millisecond or two). For use cases like a web server responding to a
-	// query, that's fine. but when outputting a PWM signal, hundreds of microseconds can be a big
-	// deal. To avoid this, we sleep for less time than we're supposed to, and then busy-wait until
-	// the right time. Inspiration for this approach was taken from
-	// https://blog.bearcats.nl/accurate-sleep-function/
-	// On a raspberry pi 4, naively calling utils.SelectContextOrWait tended to have an error of
-	// about 140-300 microseconds, while this version had an error of 0.3-0.6 microseconds.
-	startTime := time.Now()
-	maxBusyWaitTime := 1500 * time.Microsecond
-	if duration > maxBusyWaitTime {
-		shorterDuration := duration - maxBusyWaitTime
-		if !utils.SelectContextOrWait(ctx, shorterDuration) {
-			return false
-		}
+// Lock the mutex before calling this! It stops outputting any software PWM signal on this pin.
+func (pin *gpioPin) stopSoftwarePWM() {
+	if !pin.softwarePwmRunning {
+		return
 	}
-
-	for time.Since(startTime) < duration {
-		if err := ctx.Err(); err != nil {
-			return false
-		}
-		// Otherwise, busy-wait some more
-	}
-	return true
+	pin.softwarePwm.removeSignal(pin)
+	pin.softwarePwmRunning = false
 }
 
-// We turn the pin either on or off, and then wait until it's time to turn it off or on again (or
-// until we're supposed to shut down). We return whether we should continue the software PWM cycle.
-func (pin *gpioPin) halfPwmCycle(ctx context.Context, shouldBeOn bool) bool {
-	// Make local copies of these, then release the mutex
-	var dutyCycle float64
-	var freqHz uint
-
-	// We encapsulate some of this code into its own function, to ensure that the mutex is unlocked
-	// at the appropriate time even if we return early.
-	shouldContinue := func() bool {
-		pin.mu.Lock()
-		defer pin.mu.Unlock()
-		// Before we modify the pin, check if we should stop running
-		if ctx.Err() != nil {
-			return false
-		}
-
-		dutyCycle = pin.pwmDutyCyclePct
-		freqHz = pin.pwmFreqHz
-
-		// If there's an error turning the pin on or off, don't stop the whole loop. Hopefully we
-		// can toggle it next time. However, log any errors so that we notice if there are a bunch
-		// of them.
-		utils.UncheckedErrorFunc(func() error { return pin.setInternal(shouldBeOn) })
-		return true
-	}()
-
-	if !shouldContinue {
-		return false
-	}
-
-	if !shouldBeOn {
-		dutyCycle = 1 - dutyCycle
-	}
-	duration := time.Duration(float64(time.Second) * dutyCycle / float64(freqHz))
-
-	return accurateSleep(ctx, duration)
-}
-
-func (pin *gpioPin) softwarePwmLoop(ctx context.Context) {
-	for {
-		if !pin.halfPwmCycle(ctx, true) {
-			return
-		}
-		if !pin.halfPwmCycle(ctx, false) {
-			return
-		}
+// setPwmEdge is called by the board's software PWM scheduler to output an edge of this pin's
+// signal.
+func (pin *gpioPin) setPwmEdge(isHigh bool) {
+	pin.mu.Lock()
+	defer pin.mu.Unlock()
+	// The signal might have been stopped while this edge was on its way.
+	if !pin.softwarePwmRunning {
+		return
 	}
+	// If there's an error turning the pin on or off, don't stop the whole signal. Hopefully we can
+	// toggle it next time. However, log any errors so that we notice if there are a bunch of them.
+	utils.UncheckedErrorFunc(func() error { return pin.setInternal(isHigh) })
 }
 
 // This helps implement the board.GPIOPin interface for gpioPin.
@@ -340,10 +271,7 @@ func (pin *gpioPin) Close() error {
 	pin.mu.Lock()
 	defer pin.mu.Unlock()
 
-	if pin.softwarePwm != nil {
-		pin.softwarePwm.Stop()
-		pin.softwarePwm = nil
-	}
+	pin.stopSoftwarePWM()
 
 	if pin.hwPwm != nil {
 		if err := pin.hwPwm.Close(); err != nil {
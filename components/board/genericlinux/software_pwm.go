@@ -0,0 +1,189 @@
+//go:build linux
+
+// Package genericlinux is for Linux boards. This file is for outputting PWM signals in software on
+// GPIO pins that have no hardware PWM, or that need frequencies too low for the hardware.
+package genericlinux
+
+import (
+	"context"
+	"sync"
+	"time"
+)
+
+const (
+	// The OS wakes up sleeping goroutines hundreds of microseconds late, because the process
+	// scheduler only runs every millisecond or two. That is a big deal for a PWM signal, so we sleep
+	// until this long before an edge and then busy-wait. Inspiration for this approach was taken
+	// from https://blog.bearcats.nl/accurate-sleep-function/
+	// On a raspberry pi 4, naively sleeping tended to have an error of about 140-300 microseconds,
+	// while busy-waiting the end had an error of 0.3-0.6 microseconds.
+	pwmSpinBudget = 1500 * time.Microsecond
+	// Edges due within this long of each other are output in the same pass.
+	pwmEdgeCoalesceWindow = 10 * time.Microsecond
+)
+
+// softwarePwmOutput is a pin whose signal is driven by a softwarePwmScheduler.
+type softwarePwmOutput interface {
+	// setPwmEdge sets the pin high or low, unless it has stopped outputting a software PWM signal
+	// since the edge was computed.
+	setPwmEdge(isHigh bool)
+}
+
+type softwarePwmSignal struct {
+	freqHz       uint
+	dutyCyclePct float64
+	isHigh       bool
+	nextEdge     time.Time
+	// The pin's level is unknown until the first edge is output.
+	outputAnyEdge bool
+}
+
+type pwmEdge struct {
+	pin    softwarePwmOutput
+	isHigh bool
+}
+
+// softwarePwmScheduler outputs the software PWM signals of every pin on a board from a single
+// goroutine. It keeps the time of the next edge of every signal, sleeps until shortly before the
+// earliest one, and busy-waits the rest of the way. Edges that are due at the same time are output
+// together, so only one goroutine ever busy-waits no matter how many pins output PWM.
+type softwarePwmScheduler struct {
+	mu      sync.Mutex
+	signals map[softwarePwmOutput]*softwarePwmSignal
+	// changed wakes up the scheduler when a signal is added, as it might have the earliest edge.
+	changed chan struct{}
+}
+
+func newSoftwarePwmScheduler() *softwarePwmScheduler {
+	return &softwarePwmScheduler{
+		signals: map[softwarePwmOutput]*softwarePwmSignal{},
+		changed: make(chan struct{}, 1),
+	}
+}
+
+// setSignal starts outputting a signal on `pin`, starting with a rising edge right away. If the pin
+// is already outputting a signal, the new frequency and duty cycle take effect at its next edge.
+func (s *softwarePwmScheduler) setSignal(pin softwarePwmOutput, freqHz uint, dutyCyclePct float64) {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
+	if signal, ok := s.signals[pin]; ok {
+		signal.freqHz = freqHz
+		signal.dutyCyclePct = dutyCyclePct
+		return
+	}
+	s.signals[pin] = &softwarePwmSignal{
+		freqHz:       freqHz,
+		dutyCyclePct: dutyCyclePct,
+		nextEdge:     time.Now(),
+	}
+	select {
+	case s.changed <- struct{}{}:
+	default:
+	}
+}
+
+// removeSignal stops outputting the signal on `pin`. The pin is left at whatever level it was.
+func (s *softwarePwmScheduler) removeSignal(pin softwarePwmOutput) {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+	delete(s.signals, pin)
+}
+
+// run outputs the signals until the context is done.
+func (s *softwarePwmScheduler) run(ctx context.Context) {
+	for {
+		s.mu.Lock()
+		next, ok := s.nextEdgeLocked()
+		s.mu.Unlock()
+
+		if !ok {
+			select {
+			case <-ctx.Done():
+				return
+			case <-s.changed:
+				continue
+			}
+		}
+
+		if wait := time.Until(next) - pwmSpinBudget; wait > 0 {
+			timer := time.NewTimer(wait)
+			select {
+			case <-ctx.Done():
+				timer.Stop()
+				return
+			case <-s.changed:
+				timer.Stop()
+				continue
+			case <-timer.C:
+			}
+		}
+		for time.Now().Before(next) {
+			if ctx.Err() != nil {
+				return
+			}
+			// Otherwise, busy-wait some more
+		}
+
+		// Don't hold the mutex while setting pins: pins lock their own mutex to set their value,
+		// and hold it while adding or removing their signal.
+		for _, edge := range s.dueEdges(time.Now()) {
+			edge.pin.setPwmEdge(edge.isHigh)
+		}
+	}
+}
+
+// nextEdgeLocked returns the time of the earliest edge. Lock the mutex before calling this.
+func (s *softwarePwmScheduler) nextEdgeLocked() (time.Time, bool) {
+	var next time.Time
+	found := false
+	for _, signal := range s.signals {
+		if !found || signal.nextEdge.Before(next) {
+			next = signal.nextEdge
+			found = true
+		}
+	}
+	return next, found
+}
+
+// dueEdges advances every signal with an edge due by `now` and returns the edges to output.
+func (s *softwarePwmScheduler) dueEdges(now time.Time) []pwmEdge {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
+	var edges []pwmEdge
+	cutoff := now.Add(pwmEdgeCoalesceWindow)
+	for pin, signal := range s.signals {
+		if signal.nextEdge.After(cutoff) {
+			continue
+		}
+
+		period := time.Duration(float64(time.Second) / float64(signal.freqHz))
+		highTime := time.Duration(float64(period) * signal.dutyCyclePct)
+		isHigh := !signal.isHigh
+		halfCycle := period - highTime
+		if isHigh {
+			halfCycle = highTime
+		}
+		if halfCycle <= 0 {
+			// The signal spends no time at the new level (e.g., a 100% duty cycle). Stay at the
+			// current level for a whole period instead.
+			isHigh = signal.isHigh
+			halfCycle = period
+		}
+
+		// Schedule edges relative to when they were due rather than when they were output, so
+		// that the signal doesn't drift. If we've fallen more than a cycle behind, though, start
+		// over from now.
+		signal.nextEdge = signal.nextEdge.Add(halfCycle)
+		if signal.nextEdge.Before(now) {
+			signal.nextEdge = now.Add(halfCycle)
+		}
+		if isHigh != signal.isHigh || !signal.outputAnyEdge {
+			edges = append(edges, pwmEdge{pin: pin, isHigh: isHigh})
+		}
+		signal.isHigh = isHigh
+		signal.outputAnyEdge = true
+	}
+	return edges
+}
@@ -0,0 +1,112 @@
+//go:build linux
+
+package genericlinux
+
+import (
+	"context"
+	"sync"
+	"testing"
+	"time"
+
+	"go.viam.com/test"
+	"go.viam.com/utils/testutils"
+)
+
+// recordingPwmOutput records the levels it was set to.
+type recordingPwmOutput struct {
+	mu     sync.Mutex
+	levels []bool
+}
+
+func (out *recordingPwmOutput) setPwmEdge(isHigh bool) {
+	out.mu.Lock()
+	defer out.mu.Unlock()
+	out.levels = append(out.levels, isHigh)
+}
+
+func (out *recordingPwmOutput) edges() []bool {
+	out.mu.Lock()
+	defer out.mu.Unlock()
+	return append([]bool{}, out.levels...)
+}
+
+func TestSoftwarePwmDueEdges(t *testing.T) {
+	s := newSoftwarePwmScheduler()
+	start := time.Unix(0, 0)
+	fast, slow, alwaysOn := &recordingPwmOutput{}, &recordingPwmOutput{}, &recordingPwmOutput{}
+	s.setSignal(fast, 100, 0.25)
+	s.setSignal(slow, 50, 0.5)
+	s.setSignal(alwaysOn, 100, 1)
+	for _, signal := range s.signals {
+		signal.nextEdge = start
+	}
+
+	// Every signal starts with a rising edge, output in the same pass.
+	edges := s.dueEdges(start)
+	test.That(t, len(edges), test.ShouldEqual, 3)
+	for _, edge := range edges {
+		test.That(t, edge.isHigh, test.ShouldBeTrue)
+	}
+	test.That(t, s.signals[fast].nextEdge, test.ShouldEqual, start.Add(2500*time.Microsecond))
+	test.That(t, s.signals[slow].nextEdge, test.ShouldEqual, start.Add(10*time.Millisecond))
+	test.That(t, s.signals[alwaysOn].nextEdge, test.ShouldEqual, start.Add(10*time.Millisecond))
+
+	edges = s.dueEdges(start.Add(2500 * time.Microsecond))
+	test.That(t, edges, test.ShouldResemble, []pwmEdge{{pin: fast, isHigh: false}})
+	test.That(t, s.signals[fast].nextEdge, test.ShouldEqual, start.Add(10*time.Millisecond))
+
+	// A 100% duty cycle never outputs a falling edge.
+	edges = s.dueEdges(start.Add(10 * time.Millisecond))
+	test.That(t, len(edges), test.ShouldEqual, 2)
+	for _, edge := range edges {
+		test.That(t, edge.pin, test.ShouldNotEqual, alwaysOn)
+	}
+	test.That(t, s.signals[alwaysOn].isHigh, test.ShouldBeTrue)
+	test.That(t, s.signals[alwaysOn].nextEdge, test.ShouldEqual, start.Add(20*time.Millisecond))
+
+	// Once a signal has fallen a cycle behind, it starts over from now rather than catching up.
+	edges = s.dueEdges(start.Add(time.Second))
+	test.That(t, len(edges), test.ShouldEqual, 2)
+	test.That(t, s.signals[fast].nextEdge, test.ShouldEqual, start.Add(time.Second+7500*time.Microsecond))
+}
+
+func TestSoftwarePwmScheduler(t *testing.T) {
+	s := newSoftwarePwmScheduler()
+	ctx, cancel := context.WithCancel(context.Background())
+	done := make(chan struct{})
+	go func() {
+		defer close(done)
+		s.run(ctx)
+	}()
+	defer func() {
+		cancel()
+		<-done
+	}()
+
+	pins := []*recordingPwmOutput{{}, {}, {}}
+	for _, pin := range pins {
+		s.setSignal(pin, 200, 0.5)
+	}
+	testutils.WaitForAssertion(t, func(tb testing.TB) {
+		tb.Helper()
+		for _, pin := range pins {
+			test.That(tb, len(pin.edges()), test.ShouldBeGreaterThanOrEqualTo, 4)
+		}
+	})
+
+	// Every pin alternates between high and low, starting high.
+	for _, pin := range pins {
+		for i, isHigh := range pin.edges() {
+			test.That(t, isHigh, test.ShouldEqual, i%2 == 0)
+		}
+	}
+
+	s.removeSignal(pins[0])
+	stopped := len(pins[0].edges())
+	testutils.WaitForAssertion(t, func(tb testing.TB) {
+		tb.Helper()
+		test.That(tb, len(pins[1].edges()), test.ShouldBeGreaterThanOrEqualTo, stopped+4)
+	})
+	// At most an edge computed before the signal was removed was output after it.
+	test.That(t, len(pins[0].edges()), test.ShouldBeLessThanOrEqualTo, stopped+1)
+}
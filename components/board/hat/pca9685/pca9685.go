@@ -75,6 +75,13 @@ type PCA9685 struct {
 	bus                 buses.I2C
 	gpioPins            [16]gpioPin
 	logger              logging.Logger
+
+	// channelsMu is held across each update of the channels. shadow holds the values last written
+	// to each channel's registers, for the channels where shadowValid is set, so that writing a
+	// channel's current values again can be skipped.
+	channelsMu  sync.Mutex
+	shadow      [16][4]byte
+	shadowValid [16]bool
 }
 
 const (
@@ -82,6 +89,17 @@ const (
 
 	mode1Reg    = 0x00
 	prescaleReg = 0xFE
+	// Each channel's LEDn_ON_L, LEDn_ON_H, LEDn_OFF_L and LEDn_OFF_H registers directly follow the
+	// previous channel's, starting from channel 0's. ALL_LED sets all of the channels at once.
+	led0Reg   = 0x06
+	allLedReg = 0xFA
+
+	mode1Restart       = 0x80
+	mode1AutoIncrement = 0x20
+	mode1Sleep         = 0x10
+
+	// oscillatorStartupTime is how long the oscillator needs to stabilize after leaving sleep mode.
+	oscillatorStartupTime = 500 * time.Microsecond
 )
 
 // This should be considered const, except you cannot take the address of a const value.
@@ -94,13 +112,9 @@ func New(ctx context.Context, deps resource.Dependencies, conf resource.Config,
 		referenceClockSpeed: defaultReferenceClockSpeed,
 		logger:              logger,
 	}
-	// each PWM combination spans 4 bytes
-	startAddr := byte(0x06)
-
 	for chanIdx := 0; chanIdx < len(pca.gpioPins); chanIdx++ {
 		pca.gpioPins[chanIdx].pca = &pca
-		pca.gpioPins[chanIdx].startAddr = startAddr
-		startAddr += 4
+		pca.gpioPins[chanIdx].channel = chanIdx
 	}
 
 	if err := pca.Reconfigure(ctx, deps, conf); err != nil {
@@ -174,7 +188,13 @@ func (pca *PCA9685) openHandle() (buses.I2CHandle, error) {
 	return pca.bus.OpenHandle(pca.address)
 }
 
+// reset wakes the chip up with auto-increment enabled, so that all the registers of one or more
+// channels can be written in a single transaction.
 func (pca *PCA9685) reset(ctx context.Context) error {
+	pca.channelsMu.Lock()
+	defer pca.channelsMu.Unlock()
+	pca.shadowValid = [16]bool{}
+
 	handle, err := pca.openHandle()
 	if err != nil {
 		return err
@@ -182,7 +202,7 @@ func (pca *PCA9685) reset(ctx context.Context) error {
 	defer func() {
 		utils.UncheckedError(handle.Close())
 	}()
-	return handle.WriteByteData(ctx, mode1Reg, 0x00)
+	return handle.WriteByteData(ctx, mode1Reg, mode1AutoIncrement)
 }
 
 func (pca *PCA9685) frequency(ctx context.Context) (float64, error) {
@@ -227,12 +247,21 @@ func (pca *PCA9685) SetFrequency(ctx context.Context, frequency float64) error {
 		utils.UncheckedError(handle.Close())
 	}()
 
+	oldPrescale, err := handle.ReadByteData(ctx, prescaleReg)
+	if err != nil {
+		return err
+	}
 	oldMode1, err := handle.ReadByteData(ctx, mode1Reg)
 	if err != nil {
 		return err
 	}
+	if oldPrescale == prescale {
+		// The chip is already set to this frequency.
+		return nil
+	}
 
-	if err := handle.WriteByteData(ctx, mode1Reg, (oldMode1&0x7F)|0x10); err != nil {
+	// The prescaler can only be written while the chip is asleep.
+	if err := handle.WriteByteData(ctx, mode1Reg, (oldMode1&^mode1Restart)|mode1Sleep); err != nil {
 		return err
 	}
 	if err := handle.WriteByteData(ctx, prescaleReg, prescale); err != nil {
@@ -241,8 +270,8 @@ func (pca *PCA9685) SetFrequency(ctx context.Context, frequency float64) error {
 	if err := handle.WriteByteData(ctx, mode1Reg, oldMode1); err != nil {
 		return err
 	}
-	time.Sleep(5 * time.Millisecond)
-	if err := handle.WriteByteData(ctx, mode1Reg, oldMode1|0xA0); err != nil {
+	time.Sleep(oscillatorStartupTime)
+	if err := handle.WriteByteData(ctx, mode1Reg, oldMode1|mode1Restart|mode1AutoIncrement); err != nil {
 		return err
 	}
 	return nil
@@ -268,11 +297,181 @@ func (pca *PCA9685) DigitalInterruptByName(name string) (board.DigitalInterrupt,
 	return nil, grpc.UnimplementedError
 }
 
+// SetPWMs sets the duty cycles of several channels, keyed by pin name, in as few I2C
+// transactions as possible: every channel that changed is written in a single burst, or through
+// the ALL_LED registers if every channel is set to the same duty cycle. Channels whose duty cycle
+// did not change are not written at all.
+func (pca *PCA9685) SetPWMs(ctx context.Context, dutyCyclePcts map[string]float64) error {
+	channels := make(map[int]float64, len(dutyCyclePcts))
+	for pin, dutyCyclePct := range dutyCyclePcts {
+		channel, err := pca.parsePin(pin)
+		if err != nil {
+			return err
+		}
+		channels[channel] = dutyCyclePct
+	}
+
+	pca.mu.RLock()
+	defer pca.mu.RUnlock()
+	return pca.setChannels(ctx, channels)
+}
+
+// DoCommand supports "set_pwms", which takes a map from pin name to duty cycle and sets them all
+// with SetPWMs.
+func (pca *PCA9685) DoCommand(ctx context.Context, cmd map[string]interface{}) (map[string]interface{}, error) {
+	raw, ok := cmd["set_pwms"]
+	if !ok {
+		return nil, resource.ErrDoUnimplemented
+	}
+	rawPcts, ok := raw.(map[string]interface{})
+	if !ok {
+		return nil, errors.New("set_pwms must be a map from pin name to duty cycle")
+	}
+	dutyCyclePcts := make(map[string]float64, len(rawPcts))
+	for pin, rawPct := range rawPcts {
+		dutyCyclePct, ok := rawPct.(float64)
+		if !ok {
+			return nil, errors.Errorf("duty cycle of pin %s must be a number", pin)
+		}
+		dutyCyclePcts[pin] = dutyCyclePct
+	}
+	return map[string]interface{}{}, pca.SetPWMs(ctx, dutyCyclePcts)
+}
+
+// channelRegisters returns the values of a channel's registers that output the duty cycle.
+func channelRegisters(dutyCyclePct float64) [4]byte {
+	dutyCycle := uint16(dutyCyclePct * float64(0xffff))
+	if dutyCycle == 0xffff {
+		// On takes up all steps, and off takes up zero steps
+		return [4]byte{0x00, 0x10, 0x00, 0x00}
+	}
+	// On takes up zero steps, and off takes up "dutyCycle" steps
+	dutyCycle >>= 4
+	return [4]byte{0x00, 0x00, byte(dutyCycle & 0xff), byte(dutyCycle >> 8)}
+}
+
+// setChannels sets the duty cycles of the given channels. Lock the mutex before calling this.
+func (pca *PCA9685) setChannels(ctx context.Context, dutyCyclePcts map[int]float64) error {
+	pca.channelsMu.Lock()
+	defer pca.channelsMu.Unlock()
+
+	var regs [16][4]byte
+	var set [16]bool
+	var changed []int
+	for channel := range pca.gpioPins {
+		dutyCyclePct, ok := dutyCyclePcts[channel]
+		if !ok {
+			continue
+		}
+		regs[channel] = channelRegisters(dutyCyclePct)
+		set[channel] = true
+		if !pca.shadowValid[channel] || pca.shadow[channel] != regs[channel] {
+			changed = append(changed, channel)
+		}
+	}
+	if len(changed) == 0 {
+		return nil
+	}
+
+	handle, err := pca.openHandle()
+	if err != nil {
+		return err
+	}
+	defer func() {
+		utils.UncheckedError(handle.Close())
+	}()
+
+	// Until the writes succeed, we don't know what the changed channels are set to.
+	for _, channel := range changed {
+		pca.shadowValid[channel] = false
+	}
+
+	if len(dutyCyclePcts) == len(pca.gpioPins) && allEqual(regs[:]) {
+		if err := handle.WriteBlockData(ctx, allLedReg, regs[0][:]); err != nil {
+			return err
+		}
+		for channel := range pca.gpioPins {
+			pca.shadow[channel] = regs[0]
+			pca.shadowValid[channel] = true
+		}
+		return nil
+	}
+
+	// Write every changed channel in one burst, filling in the channels in between from the
+	// shadow registers. If some channel in between has unknown values, write each run of
+	// consecutive changed channels separately instead.
+	first, last := changed[0], changed[len(changed)-1]
+	for channel := first; channel <= last; channel++ {
+		if !set[channel] {
+			if !pca.shadowValid[channel] {
+				return pca.writeChannelRuns(ctx, handle, changed, regs)
+			}
+			regs[channel] = pca.shadow[channel]
+		}
+	}
+	return pca.writeChannels(ctx, handle, first, regs[first:last+1])
+}
+
+// writeChannelRuns writes each run of consecutive channels in changed with its own transaction.
+func (pca *PCA9685) writeChannelRuns(ctx context.Context, handle buses.I2CHandle, changed []int, regs [16][4]byte) error {
+	for start := 0; start < len(changed); {
+		end := start + 1
+		for end < len(changed) && changed[end] == changed[end-1]+1 {
+			end++
+		}
+		first, last := changed[start], changed[end-1]
+		if err := pca.writeChannels(ctx, handle, first, regs[first:last+1]); err != nil {
+			return err
+		}
+		start = end
+	}
+	return nil
+}
+
+// maxChannelsPerWrite bounds a block write to 32 bytes, the most that some I2C handles, such as the
+// pigpio one on a Pi, accept at once.
+const maxChannelsPerWrite = 8
+
+// writeChannels writes the registers of consecutive channels starting at first, relying on
+// auto-increment to write up to maxChannelsPerWrite of them per transaction, and records them in
+// the shadow registers.
+func (pca *PCA9685) writeChannels(ctx context.Context, handle buses.I2CHandle, first int, regs [][4]byte) error {
+	for len(regs) > 0 {
+		n := len(regs)
+		if n > maxChannelsPerWrite {
+			n = maxChannelsPerWrite
+		}
+		data := make([]byte, 0, 4*n)
+		for _, r := range regs[:n] {
+			data = append(data, r[:]...)
+		}
+		if err := handle.WriteBlockData(ctx, led0Reg+byte(4*first), data); err != nil {
+			return err
+		}
+		for i, r := range regs[:n] {
+			pca.shadow[first+i] = r
+			pca.shadowValid[first+i] = true
+		}
+		first += n
+		regs = regs[n:]
+	}
+	return nil
+}
+
+func allEqual(regs [][4]byte) bool {
+	for _, r := range regs[1:] {
+		if r != regs[0] {
+			return false
+		}
+	}
+	return true
+}
+
 // A gpioPin in PCA9685 is the combination of a PWM's T_on and T_off
 // represented as two 12-bit (4096 step) values.
 type gpioPin struct {
-	pca       *PCA9685
-	startAddr byte
+	pca     *PCA9685
+	channel int
 }
 
 func (gp *gpioPin) Get(ctx context.Context, extra map[string]interface{}) (bool, error) {
@@ -304,34 +503,18 @@ func (gp *gpioPin) PWM(ctx context.Context, extra map[string]interface{}) (float
 		utils.UncheckedError(handle.Close())
 	}()
 
-	regOnLow := buses.I2CRegister{handle, gp.startAddr}
-	regOnHigh := buses.I2CRegister{handle, gp.startAddr + 1}
-	regOffLow := buses.I2CRegister{handle, gp.startAddr + 2}
-	regOffHigh := buses.I2CRegister{handle, gp.startAddr + 3}
-
-	onLow, err := regOnLow.ReadByteData(ctx)
+	// With auto-increment, all 4 registers are read in one transaction.
+	regs, err := handle.ReadBlockData(ctx, led0Reg+byte(4*gp.channel), 4)
 	if err != nil {
 		return 0, err
 	}
-	onHigh, err := regOnHigh.ReadByteData(ctx)
-	if err != nil {
-		return 0, err
-	}
-	onVal := uint16(onLow) | (uint16(onHigh) << 8)
+	onVal := uint16(regs[0]) | (uint16(regs[1]) << 8)
 	if onVal == 0x1000 {
 		return 1, nil
 	}
 
 	// Off takes up zero steps
-	offLow, err := regOffLow.ReadByteData(ctx)
-	if err != nil {
-		return 0, err
-	}
-	offHigh, err := regOffHigh.ReadByteData(ctx)
-	if err != nil {
-		return 0, err
-	}
-	offVal := uint16(offLow) | (uint16(offHigh) << 8)
+	offVal := uint16(regs[2]) | (uint16(regs[3]) << 8)
 	return float64(offVal<<4) / 0xffff, nil
 }
 
@@ -339,58 +522,7 @@ func (gp *gpioPin) SetPWM(ctx context.Context, dutyCyclePct float64, extra map[s
 	gp.pca.mu.RLock()
 	defer gp.pca.mu.RUnlock()
 
-	dutyCycle := uint16(dutyCyclePct * float64(0xffff))
-
-	handle, err := gp.pca.openHandle()
-	if err != nil {
-		return err
-	}
-	defer func() {
-		utils.UncheckedError(handle.Close())
-	}()
-
-	regOnLow := buses.I2CRegister{handle, gp.startAddr}
-	regOnHigh := buses.I2CRegister{handle, gp.startAddr + 1}
-	regOffLow := buses.I2CRegister{handle, gp.startAddr + 2}
-	regOffHigh := buses.I2CRegister{handle, gp.startAddr + 3}
-
-	if dutyCycle == 0xffff {
-		// On takes up all steps
-		if err := regOnLow.WriteByteData(ctx, 0x00); err != nil {
-			return err
-		}
-		if err := regOnHigh.WriteByteData(ctx, 0x10); err != nil {
-			return err
-		}
-
-		// Off takes up zero steps
-		if err := regOffLow.WriteByteData(ctx, 0x00); err != nil {
-			return err
-		}
-		if err := regOffHigh.WriteByteData(ctx, 0x00); err != nil {
-			return err
-		}
-		return nil
-	}
-
-	// On takes up zero steps
-	if err := regOnLow.WriteByteData(ctx, 0x00); err != nil {
-		return err
-	}
-	if err := regOnHigh.WriteByteData(ctx, 0x00); err != nil {
-		return err
-	}
-
-	// Off takes up "dutyCycle" steps
-	dutyCycle >>= 4
-
-	if err := regOffLow.WriteByteData(ctx, byte(dutyCycle&0xff)); err != nil {
-		return err
-	}
-	if err := regOffHigh.WriteByteData(ctx, byte(dutyCycle>>8)); err != nil {
-		return err
-	}
-	return nil
+	return gp.pca.setChannels(ctx, map[int]float64{gp.channel: dutyCyclePct})
 }
 
 func (gp *gpioPin) PWMFreq(ctx context.Context, extra map[string]interface{}) (uint, error) {
@@ -0,0 +1,126 @@
+//go:build linux
+
+package pca9685
+
+import (
+	"context"
+	"errors"
+	"strconv"
+	"testing"
+
+	"go.viam.com/test"
+
+	"go.viam.com/rdk/components/board/genericlinux/buses"
+	"go.viam.com/rdk/testutils/inject"
+)
+
+type blockWrite struct {
+	register byte
+	data     []byte
+}
+
+func newTestPCA9685() (*PCA9685, *[]blockWrite) {
+	var writes []blockWrite
+	handle := &inject.I2CHandle{}
+	handle.WriteBlockDataFunc = func(ctx context.Context, register byte, data []byte) error {
+		// like the pigpio I2C handle on a Pi
+		if len(data) > 32 {
+			return errors.New("cannot write more than 32 bytes")
+		}
+		writes = append(writes, blockWrite{register, append([]byte{}, data...)})
+		return nil
+	}
+	handle.CloseFunc = func() error { return nil }
+	bus := &inject.I2C{}
+	bus.OpenHandleFunc = func(addr byte) (buses.I2CHandle, error) { return handle, nil }
+
+	pca := &PCA9685{bus: bus, address: byte(defaultAddr)}
+	for chanIdx := range pca.gpioPins {
+		pca.gpioPins[chanIdx].pca = pca
+		pca.gpioPins[chanIdx].channel = chanIdx
+	}
+	return pca, &writes
+}
+
+func TestSetPWMs(t *testing.T) {
+	ctx := context.Background()
+	pca, writes := newTestPCA9685()
+
+	// Setting every channel to the same duty cycle uses the ALL_LED registers.
+	all := map[string]float64{}
+	for chanIdx := range pca.gpioPins {
+		all[strconv.Itoa(chanIdx)] = 1
+	}
+	test.That(t, pca.SetPWMs(ctx, all), test.ShouldBeNil)
+	test.That(t, *writes, test.ShouldResemble, []blockWrite{{allLedReg, []byte{0, 0x10, 0, 0}}})
+
+	// Unchanged channels are skipped, and the channels in between the changed ones are filled in
+	// from the shadow registers so that they are written in one burst.
+	*writes = nil
+	test.That(t, pca.SetPWMs(ctx, map[string]float64{"2": 0, "3": 1, "4": 0}), test.ShouldBeNil)
+	test.That(t, *writes, test.ShouldResemble, []blockWrite{{
+		led0Reg + 4*2,
+		[]byte{0, 0, 0, 0, 0, 0x10, 0, 0, 0, 0, 0, 0},
+	}})
+
+	*writes = nil
+	test.That(t, pca.SetPWMs(ctx, map[string]float64{"2": 0, "3": 1, "4": 0}), test.ShouldBeNil)
+	test.That(t, *writes, test.ShouldBeEmpty)
+
+	test.That(t, pca.SetPWMs(ctx, map[string]float64{"16": 0}), test.ShouldNotBeNil)
+}
+
+func TestSetPWMsSplitsBursts(t *testing.T) {
+	ctx := context.Background()
+	pca, writes := newTestPCA9685()
+
+	// Sixteen different channels are written as two blocks of 32 bytes.
+	pcts := map[string]float64{}
+	for chanIdx := range pca.gpioPins {
+		pcts[strconv.Itoa(chanIdx)] = float64(chanIdx % 2)
+	}
+	test.That(t, pca.SetPWMs(ctx, pcts), test.ShouldBeNil)
+	test.That(t, len(*writes), test.ShouldEqual, 2)
+	test.That(t, (*writes)[0].register, test.ShouldEqual, led0Reg)
+	test.That(t, (*writes)[1].register, test.ShouldEqual, led0Reg+4*8)
+	for _, w := range *writes {
+		test.That(t, w.data, test.ShouldResemble, []byte{
+			0, 0, 0, 0, 0, 0x10, 0, 0, 0, 0, 0, 0, 0, 0x10, 0, 0,
+			0, 0, 0, 0, 0, 0x10, 0, 0, 0, 0, 0, 0, 0, 0x10, 0, 0,
+		})
+	}
+	for chanIdx := range pca.gpioPins {
+		test.That(t, pca.shadowValid[chanIdx], test.ShouldBeTrue)
+	}
+}
+
+func TestSetPWMsUnknownShadow(t *testing.T) {
+	ctx := context.Background()
+	pca, writes := newTestPCA9685()
+
+	// Channel 1's registers are unknown, so channels 0 and 2 are written separately rather than
+	// overwriting it.
+	test.That(t, pca.SetPWMs(ctx, map[string]float64{"0": 0, "2": 0}), test.ShouldBeNil)
+	test.That(t, *writes, test.ShouldResemble, []blockWrite{
+		{led0Reg, []byte{0, 0, 0, 0}},
+		{led0Reg + 4*2, []byte{0, 0, 0, 0}},
+	})
+
+	pin, err := pca.GPIOPinByName("1")
+	test.That(t, err, test.ShouldBeNil)
+	*writes = nil
+	test.That(t, pin.SetPWM(ctx, 0.5, nil), test.ShouldBeNil)
+	test.That(t, *writes, test.ShouldResemble, []blockWrite{{led0Reg + 4, []byte{0, 0, 0xff, 0x07}}})
+}
+
+func TestDoCommandSetPWMs(t *testing.T) {
+	ctx := context.Background()
+	pca, writes := newTestPCA9685()
+
+	_, err := pca.DoCommand(ctx, map[string]interface{}{"set_pwms": map[string]interface{}{"5": 1.0}})
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, *writes, test.ShouldResemble, []blockWrite{{led0Reg + 4*5, []byte{0, 0x10, 0, 0}}})
+
+	_, err = pca.DoCommand(ctx, map[string]interface{}{"set_pwms": map[string]interface{}{"5": "on"}})
+	test.That(t, err, test.ShouldNotBeNil)
+}
@@ -4,7 +4,9 @@ package mcp3008helper
 
 import (
 	"context"
+	"sync"
 
+	"github.com/pkg/errors"
 	"go.uber.org/multierr"
 
 	"go.viam.com/rdk/components/board"
@@ -13,11 +15,194 @@ import (
 	"go.viam.com/rdk/resource"
 )
 
+// maxBatchesPerCaller is how many batches of transfers one caller performs before handing the
+// remaining queued reads off to a caller waiting on them.
+const maxBatchesPerCaller = 4
+
+// MCP3008 is an MCP3008 ADC on an SPI bus. It is shared by the analog readers of all the channels
+// on the chip. Reads that arrive while a transfer to the chip is in progress are queued up and
+// submitted together as a single batch of transfers once it finishes.
+type MCP3008 struct {
+	bus        buses.SPI
+	chipSelect string
+
+	mu      sync.Mutex
+	pending []*channelRead
+	reading bool
+	// handoff holds a token when the caller performing transfers stopped with reads still queued;
+	// whichever waiting caller takes it performs the transfers from then on.
+	handoff chan struct{}
+}
+
+type channelRead struct {
+	channel int
+	value   int
+	err     error
+	done    chan struct{}
+}
+
+// NewMCP3008 returns the MCP3008 on `bus` selected by `chipSelect`.
+func NewMCP3008(bus buses.SPI, chipSelect string) *MCP3008 {
+	return &MCP3008{bus: bus, chipSelect: chipSelect, handoff: make(chan struct{}, 1)}
+}
+
+// AnalogReader returns a reader for one channel of the ADC.
+func (dev *MCP3008) AnalogReader(channel int) *MCP3008AnalogReader {
+	return &MCP3008AnalogReader{Channel: channel, Bus: dev.bus, Chip: dev.chipSelect, dev: dev}
+}
+
+// ReadBurst samples each of `readers`, which must be channels of this chip, in one batch of
+// transfers.
+func (dev *MCP3008) ReadBurst(ctx context.Context, readers []board.Analog) ([]board.AnalogValue, error) {
+	channels := make([]int, 0, len(readers))
+	for _, reader := range readers {
+		mar, ok := reader.(*MCP3008AnalogReader)
+		if !ok || mar.dev != dev {
+			return nil, errors.New("analog reader is not a channel of this MCP3008")
+		}
+		channels = append(channels, mar.Channel)
+	}
+
+	values, err := dev.readChannels(ctx, channels)
+	if err != nil {
+		return nil, err
+	}
+	readings := make([]board.AnalogValue, 0, len(values))
+	for _, value := range values {
+		readings = append(readings, board.AnalogValue{Value: value})
+	}
+	return readings, nil
+}
+
+// readChannel returns a sample of `channel`.
+func (dev *MCP3008) readChannel(ctx context.Context, channel int) (int, error) {
+	values, err := dev.readChannels(ctx, []int{channel})
+	if err != nil {
+		return 0, err
+	}
+	return values[0], nil
+}
+
+// readChannels returns a sample of each of `channels`. If no transfer is in progress, the caller
+// performs the transfers for the reads queued up. Otherwise it waits for its reads to be handled
+// by the caller already performing transfers, or for that caller to hand the queue off to it.
+func (dev *MCP3008) readChannels(ctx context.Context, channels []int) ([]int, error) {
+	reads := make([]*channelRead, 0, len(channels))
+	for _, channel := range channels {
+		reads = append(reads, &channelRead{channel: channel, done: make(chan struct{})})
+	}
+
+	dev.mu.Lock()
+	dev.pending = append(dev.pending, reads...)
+	if dev.reading {
+		dev.mu.Unlock()
+	} else {
+		dev.reading = true
+		dev.drainPending(ctx)
+	}
+
+	for _, read := range reads {
+		for done := false; !done; {
+			select {
+			case <-read.done:
+				done = true
+			case <-dev.handoff:
+				dev.mu.Lock()
+				dev.drainPending(ctx)
+			case <-ctx.Done():
+				return nil, ctx.Err()
+			}
+		}
+	}
+	return channelValues(reads)
+}
+
+// drainPending performs transfers for the queued reads until there are none left, or until it has
+// performed maxBatchesPerCaller batches, in which case it hands the rest off to a waiting caller.
+// Reads queued by other callers must not fail because this caller is cancelled, so the transfers
+// are not cancelled with `ctx`. It must be called with `dev.mu` held and `dev.reading` set, and it
+// releases `dev.mu`.
+func (dev *MCP3008) drainPending(ctx context.Context) {
+	ctx = context.WithoutCancel(ctx)
+	for batches := 0; len(dev.pending) > 0; batches++ {
+		if batches == maxBatchesPerCaller {
+			dev.handoff <- struct{}{}
+			dev.mu.Unlock()
+			return
+		}
+		batch := dev.pending
+		dev.pending = nil
+		dev.mu.Unlock()
+		dev.transfer(ctx, batch)
+		dev.mu.Lock()
+	}
+	dev.reading = false
+	dev.mu.Unlock()
+}
+
+func channelValues(reads []*channelRead) ([]int, error) {
+	values := make([]int, 0, len(reads))
+	for _, read := range reads {
+		if read.err != nil {
+			return nil, read.err
+		}
+		values = append(values, read.value)
+	}
+	return values, nil
+}
+
+// transfer samples every distinct channel in `batch` with one batched transfer and completes the
+// reads.
+func (dev *MCP3008) transfer(ctx context.Context, batch []*channelRead) {
+	txIndex := map[int]int{}
+	txs := [][]byte{}
+	for _, read := range batch {
+		if _, ok := txIndex[read.channel]; ok {
+			continue
+		}
+		txIndex[read.channel] = len(txs)
+		txs = append(txs, []byte{
+			1,                             // start bit
+			byte((8 + read.channel) << 4), // single-ended
+			0,                             // extra clocks to receive full 10 bits of data
+		})
+	}
+
+	rxs, err := dev.xfer(ctx, txs)
+	for _, read := range batch {
+		if err != nil {
+			read.err = err
+		} else {
+			rx := rxs[txIndex[read.channel]]
+			// Reassemble the 10-bit value. Do not include bits before the final 10, because they
+			// contain garbage and might be non-zero.
+			read.value = 0x03FF & ((int(rx[1]) << 8) | int(rx[2]))
+		}
+		close(read.done)
+	}
+}
+
+func (dev *MCP3008) xfer(ctx context.Context, txs [][]byte) (rxs [][]byte, err error) {
+	handle, err := dev.bus.OpenHandle()
+	if err != nil {
+		return nil, err
+	}
+	defer func() {
+		err = multierr.Combine(err, handle.Close())
+	}()
+
+	return buses.XferBatch(ctx, handle, 1000000, dev.chipSelect, 0, txs)
+}
+
 // MCP3008AnalogReader implements a board.AnalogReader using an MCP3008 ADC via SPI.
 type MCP3008AnalogReader struct {
 	Channel int
 	Bus     buses.SPI
 	Chip    string
+
+	// dev is set for readers created with MCP3008.AnalogReader. Reads by readers constructed
+	// directly are not batched with other channels.
+	dev *MCP3008
 }
 
 // MCP3008AnalogConfig describes the configuration of a MCP3008 analog reader on a board.
@@ -38,29 +223,15 @@ func (config *MCP3008AnalogConfig) Validate(path string) error {
 	return nil
 }
 
-func (mar *MCP3008AnalogReader) Read(ctx context.Context, extra map[string]interface{}) (
-	analogVal board.AnalogValue, err error,
-) {
-	var tx [3]byte
-	tx[0] = 1                            // start bit
-	tx[1] = byte((8 + mar.Channel) << 4) // single-ended
-	tx[2] = 0                            // extra clocks to receive full 10 bits of data
-
-	bus, err := mar.Bus.OpenHandle()
-	if err != nil {
-		return board.AnalogValue{}, err
+func (mar *MCP3008AnalogReader) Read(ctx context.Context, extra map[string]interface{}) (board.AnalogValue, error) {
+	dev := mar.dev
+	if dev == nil {
+		dev = NewMCP3008(mar.Bus, mar.Chip)
 	}
-	defer func() {
-		err = multierr.Combine(err, bus.Close())
-	}()
-
-	rx, err := bus.Xfer(ctx, 1000000, mar.Chip, 0, tx[:])
+	val, err := dev.readChannel(ctx, mar.Channel)
 	if err != nil {
 		return board.AnalogValue{}, err
 	}
-	// Reassemble the 10-bit value. Do not include bits before the final 10, because they contain
-	// garbage and might be non-zero.
-	val := 0x03FF & ((int(rx[1]) << 8) | int(rx[2]))
 
 	// returning no analog range since mcp3008 will be removed soon.
 	return board.AnalogValue{Value: val}, nil
@@ -0,0 +1,179 @@
+package mcp3008helper
+
+import (
+	"context"
+	"sync"
+	"testing"
+
+	"go.viam.com/test"
+	"go.viam.com/utils/testutils"
+
+	"go.viam.com/rdk/components/board/genericlinux/buses"
+	"go.viam.com/rdk/testutils/inject"
+)
+
+// batchSpiHandle answers every transfer with the channel it requested and records the number of
+// transfers in each batch. Each batch blocks until it receives from `release`, and fails if its
+// context is cancelled by then.
+type batchSpiHandle struct {
+	mu         sync.Mutex
+	release    chan struct{}
+	batchSizes []int
+}
+
+func (h *batchSpiHandle) Xfer(ctx context.Context, baud uint, chipSelect string, mode uint, tx []byte) ([]byte, error) {
+	rxs, err := h.XferBatch(ctx, baud, chipSelect, mode, [][]byte{tx})
+	if err != nil {
+		return nil, err
+	}
+	return rxs[0], nil
+}
+
+func (h *batchSpiHandle) XferBatch(ctx context.Context, baud uint, chipSelect string, mode uint, txs [][]byte) ([][]byte, error) {
+	h.mu.Lock()
+	h.batchSizes = append(h.batchSizes, len(txs))
+	h.mu.Unlock()
+	<-h.release
+	if err := ctx.Err(); err != nil {
+		return nil, err
+	}
+
+	rxs := [][]byte{}
+	for _, tx := range txs {
+		channel := int(tx[1]>>4) - 8
+		rxs = append(rxs, []byte{0xFF, 0xFC | byte(channel>>8), byte(channel)})
+	}
+	return rxs, nil
+}
+
+func (h *batchSpiHandle) Close() error {
+	return nil
+}
+
+func TestMCP3008BatchesConcurrentReads(t *testing.T) {
+	ctx := context.Background()
+	handle := &batchSpiHandle{release: make(chan struct{})}
+	bus := &inject.SPI{OpenHandleFunc: func() (buses.SPIHandle, error) { return handle, nil }}
+	dev := NewMCP3008(bus, "1")
+
+	var wg sync.WaitGroup
+	values := make([]int, 4)
+	read := func(channel int) {
+		defer wg.Done()
+		val, err := dev.AnalogReader(channel).Read(ctx, nil)
+		test.That(t, err, test.ShouldBeNil)
+		values[channel] = val.Value
+	}
+
+	// The first read holds up the transfer while the others queue up behind it.
+	wg.Add(1)
+	go read(0)
+	testutils.WaitForAssertion(t, func(tb testing.TB) {
+		tb.Helper()
+		handle.mu.Lock()
+		defer handle.mu.Unlock()
+		test.That(tb, handle.batchSizes, test.ShouldResemble, []int{1})
+	})
+	for channel := 1; channel < 4; channel++ {
+		wg.Add(1)
+		go read(channel)
+	}
+	testutils.WaitForAssertion(t, func(tb testing.TB) {
+		tb.Helper()
+		dev.mu.Lock()
+		defer dev.mu.Unlock()
+		test.That(tb, len(dev.pending), test.ShouldEqual, 3)
+	})
+
+	close(handle.release)
+	wg.Wait()
+	test.That(t, handle.batchSizes, test.ShouldResemble, []int{1, 3})
+	test.That(t, values, test.ShouldResemble, []int{0, 1, 2, 3})
+}
+
+func TestMCP3008CancelledCallerDoesNotFailQueuedReads(t *testing.T) {
+	handle := &batchSpiHandle{release: make(chan struct{})}
+	bus := &inject.SPI{OpenHandleFunc: func() (buses.SPIHandle, error) { return handle, nil }}
+	dev := NewMCP3008(bus, "1")
+
+	// The first caller performs the transfers, and is cancelled while the others are queued up.
+	cancelCtx, cancel := context.WithCancel(context.Background())
+	firstDone := make(chan struct{})
+	go func() {
+		defer close(firstDone)
+		_, _ = dev.AnalogReader(0).Read(cancelCtx, nil)
+	}()
+	testutils.WaitForAssertion(t, func(tb testing.TB) {
+		tb.Helper()
+		handle.mu.Lock()
+		defer handle.mu.Unlock()
+		test.That(tb, handle.batchSizes, test.ShouldResemble, []int{1})
+	})
+
+	var wg sync.WaitGroup
+	for channel := 1; channel < 4; channel++ {
+		wg.Add(1)
+		go func(channel int) {
+			defer wg.Done()
+			val, err := dev.AnalogReader(channel).Read(context.Background(), nil)
+			test.That(t, err, test.ShouldBeNil)
+			test.That(t, val.Value, test.ShouldEqual, channel)
+		}(channel)
+	}
+	testutils.WaitForAssertion(t, func(tb testing.TB) {
+		tb.Helper()
+		dev.mu.Lock()
+		defer dev.mu.Unlock()
+		test.That(tb, len(dev.pending), test.ShouldEqual, 3)
+	})
+
+	cancel()
+	close(handle.release)
+	wg.Wait()
+	<-firstDone
+	test.That(t, handle.batchSizes, test.ShouldResemble, []int{1, 3})
+}
+
+func TestMCP3008HandsOffAfterMaxBatches(t *testing.T) {
+	ctx := context.Background()
+	handle := &batchSpiHandle{release: make(chan struct{})}
+	bus := &inject.SPI{OpenHandleFunc: func() (buses.SPIHandle, error) { return handle, nil }}
+	dev := NewMCP3008(bus, "1")
+
+	firstErr := make(chan error, 1)
+	go func() {
+		_, err := dev.AnalogReader(0).Read(ctx, nil)
+		firstErr <- err
+	}()
+
+	// Queue up one more read during each batch, so the first caller always has more to transfer.
+	var wg sync.WaitGroup
+	for batch := 1; batch <= maxBatchesPerCaller; batch++ {
+		testutils.WaitForAssertion(t, func(tb testing.TB) {
+			tb.Helper()
+			handle.mu.Lock()
+			defer handle.mu.Unlock()
+			test.That(tb, len(handle.batchSizes), test.ShouldEqual, batch)
+		})
+		wg.Add(1)
+		go func(channel int) {
+			defer wg.Done()
+			val, err := dev.AnalogReader(channel).Read(ctx, nil)
+			test.That(t, err, test.ShouldBeNil)
+			test.That(t, val.Value, test.ShouldEqual, channel)
+		}(batch % 8)
+		testutils.WaitForAssertion(t, func(tb testing.TB) {
+			tb.Helper()
+			dev.mu.Lock()
+			defer dev.mu.Unlock()
+			test.That(tb, len(dev.pending), test.ShouldEqual, 1)
+		})
+		handle.release <- struct{}{}
+	}
+
+	// The first caller returns with a read still queued, which its own caller then transfers.
+	test.That(t, <-firstErr, test.ShouldBeNil)
+	handle.release <- struct{}{}
+	wg.Wait()
+	test.That(t, len(handle.batchSizes), test.ShouldEqual, maxBatchesPerCaller+1)
+}
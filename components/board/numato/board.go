@@ -104,8 +104,9 @@ func (m *mask) set(bit int) {
 type numatoBoard struct {
 	resource.Named
 	resource.AlwaysRebuild
-	pins    int
-	analogs map[string]*pinwrappers.AnalogSmoother
+	pins          int
+	analogs       map[string]*pinwrappers.AnalogSmoother
+	analogSampler *pinwrappers.AnalogSampler
 
 	port   io.ReadWriteCloser
 	closed int32
@@ -332,6 +333,7 @@ func (b *numatoBoard) Close(ctx context.Context) error {
 			return err
 		}
 	}
+	b.analogSampler.Close()
 
 	atomic.AddInt32(&b.closed, 1)
 
@@ -457,10 +459,12 @@ func connect(ctx context.Context, name resource.Name, conf *Config, logger loggi
 		stepSize:         stepSize,
 	}
 
+	// Every analog is read through the same serial port, so sample them together.
+	b.analogSampler = pinwrappers.NewAnalogSampler(logger)
 	b.analogs = map[string]*pinwrappers.AnalogSmoother{}
 	for _, c := range conf.Analogs {
 		r := &analog{b, c.Pin}
-		b.analogs[c.Name] = pinwrappers.SmoothAnalogReader(r, c, logger)
+		b.analogs[c.Name] = b.analogSampler.SmoothAnalogReader(b, r, c)
 	}
 
 	b.lines = make(chan string)
@@ -97,6 +97,7 @@ type piPigpio struct {
 	duty          int // added for mutex
 	gpioConfigSet map[int]bool
 	analogReaders map[string]*pinwrappers.AnalogSmoother
+	analogSampler *pinwrappers.AnalogSampler
 	// `interrupts` maps interrupt names to the interrupts. `interruptsHW` maps broadcom addresses
 	// to these same values. The two should always have the same set of values.
 	interrupts   map[string]ReconfigurableDigitalInterrupt
@@ -162,6 +163,8 @@ func newPigpio(ctx context.Context, name resource.Name, cfg resource.Config, log
 		isClosed:   false,
 		cancelCtx:  cancelCtx,
 		cancelFunc: cancelFunc,
+		// Channels on the same ADC are sampled together.
+		analogSampler: pinwrappers.NewAnalogSampler(logger),
 	}
 
 	if err := piInstance.Reconfigure(ctx, nil, cfg); err != nil {
@@ -231,19 +234,35 @@ func (pi *piPigpio) StreamTicks(ctx context.Context, interrupts []board.DigitalI
 
 func (pi *piPigpio) reconfigureAnalogReaders(ctx context.Context, cfg *Config) error {
 	// No need to reconfigure the old analog readers; just throw them out and make new ones.
+	for _, analog := range pi.analogReaders {
+		utils.UncheckedError(analog.Close(ctx))
+	}
 	pi.analogReaders = map[string]*pinwrappers.AnalogSmoother{}
+	// Channels on the same chip share an MCP3008 such that their reads can be batched.
+	spiBuses := map[string]*piPigpioSPI{}
+	chips := map[[2]string]*mcp3008helper.MCP3008{}
 	for _, ac := range cfg.AnalogReaders {
 		channel, err := strconv.Atoi(ac.Pin)
 		if err != nil {
 			return errors.Errorf("bad analog pin (%s)", ac.Pin)
 		}
 
-		bus := &piPigpioSPI{pi: pi, busSelect: ac.SPIBus}
-		ar := &mcp3008helper.MCP3008AnalogReader{channel, bus, ac.ChipSelect}
+		chipKey := [2]string{ac.SPIBus, ac.ChipSelect}
+		chip, ok := chips[chipKey]
+		if !ok {
+			bus, ok := spiBuses[ac.SPIBus]
+			if !ok {
+				bus = &piPigpioSPI{pi: pi, busSelect: ac.SPIBus}
+				spiBuses[ac.SPIBus] = bus
+			}
+			chip = mcp3008helper.NewMCP3008(bus, ac.ChipSelect)
+			chips[chipKey] = chip
+		}
+		ar := chip.AnalogReader(channel)
 
-		pi.analogReaders[ac.Name] = pinwrappers.SmoothAnalogReader(ar, board.AnalogReaderConfig{
+		pi.analogReaders[ac.Name] = pi.analogSampler.SmoothAnalogReader(chip, ar, board.AnalogReaderConfig{
 			AverageOverMillis: ac.AverageOverMillis, SamplesPerSecond: ac.SamplesPerSecond,
-		}, pi.logger)
+		})
 	}
 	return nil
 }
@@ -740,6 +759,7 @@ func (pi *piPigpio) Close(ctx context.Context) error {
 		err = multierr.Combine(err, analog.Close(ctx))
 	}
 	pi.analogReaders = map[string]*pinwrappers.AnalogSmoother{}
+	pi.analogSampler.Close()
 
 	for bcom := range pi.interruptsHW {
 		if result := C.teardownInterrupt(C.int(bcom)); result != 0 {
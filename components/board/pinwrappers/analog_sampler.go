@@ -0,0 +1,237 @@
+package pinwrappers
+
+import (
+	"context"
+	"math"
+	"sync"
+	"time"
+
+	"go.viam.com/rdk/components/board"
+	"go.viam.com/rdk/logging"
+	"go.viam.com/rdk/utils"
+)
+
+// AnalogBurstReader is implemented by ADCs that can sample several of their inputs in a single bus
+// transaction.
+type AnalogBurstReader interface {
+	// ReadBurst samples each of `readers`, which must all be inputs of this device.
+	ReadBurst(ctx context.Context, readers []board.Analog) ([]board.AnalogValue, error)
+}
+
+// An AnalogSampler samples the smoothed analog readers of a board. Readers on the same device are
+// sampled together by one goroutine: every input that is due is read in a single burst, at the
+// highest rate requested by any of them, and slower inputs are only read every few bursts. If the
+// device is an AnalogBurstReader, each burst is a single call to it. Once every reader of a device
+// is closed, its goroutine stops and the sampler forgets the device.
+type AnalogSampler struct {
+	logger logging.Logger
+
+	mu      sync.Mutex
+	groups  map[any]*analogGroup
+	workers utils.StoppableWorkers
+}
+
+// NewAnalogSampler creates a sampler with no readers.
+func NewAnalogSampler(logger logging.Logger) *AnalogSampler {
+	return &AnalogSampler{
+		logger:  logger,
+		groups:  map[any]*analogGroup{},
+		workers: utils.NewStoppableWorkers(),
+	}
+}
+
+// SmoothAnalogReader wraps the given reader, which is an input of `device`, in a smoother sampled
+// along with every other input of `device`. Closing the smoother stops sampling it.
+func (s *AnalogSampler) SmoothAnalogReader(device any, r board.Analog, c board.AnalogReaderConfig) *AnalogSmoother {
+	smoother := newAnalogSmoother(r, c, s.logger)
+	smoother.setupAverage()
+
+	s.mu.Lock()
+	defer s.mu.Unlock()
+	group, ok := s.groups[device]
+	if !ok {
+		group = &analogGroup{sampler: s, device: device, changed: make(chan struct{}, 1)}
+		s.groups[device] = group
+		s.workers.AddWorkers(group.run)
+	}
+
+	smoother.group = group
+	group.add(smoother)
+	return smoother
+}
+
+// Close stops sampling every reader.
+func (s *AnalogSampler) Close() {
+	s.workers.Stop()
+}
+
+type analogGroupMember struct {
+	smoother *AnalogSmoother
+	// The member is sampled every `decimation` bursts. `countdown` is how many bursts are left
+	// until the next one.
+	decimation int
+	countdown  int
+}
+
+// analogGroup is the inputs of one device.
+type analogGroup struct {
+	sampler *AnalogSampler
+	device  any
+
+	mu sync.Mutex
+	// retired is set once the last member is removed and the group is dropped by its sampler.
+	retired bool
+	members []*analogGroupMember
+	period  time.Duration
+	// restart is set when the members change, so the next burst happens right away and the
+	// deadlines after it are counted from then.
+	restart bool
+	changed chan struct{}
+}
+
+func (g *analogGroup) add(smoother *AnalogSmoother) {
+	g.mu.Lock()
+	defer g.mu.Unlock()
+	g.members = append(g.members, &analogGroupMember{smoother: smoother})
+	g.rescheduleLocked()
+}
+
+func (g *analogGroup) remove(smoother *AnalogSmoother) {
+	// The sampler is locked first such that no reader is added to a group being retired.
+	g.sampler.mu.Lock()
+	defer g.sampler.mu.Unlock()
+	g.mu.Lock()
+	defer g.mu.Unlock()
+	for i, member := range g.members {
+		if member.smoother == smoother {
+			g.members = append(g.members[:i], g.members[i+1:]...)
+			if len(g.members) == 0 && !g.retired {
+				g.retired = true
+				delete(g.sampler.groups, g.device)
+			}
+			g.rescheduleLocked()
+			return
+		}
+	}
+}
+
+// rescheduleLocked sets the burst rate to the highest rate of any member, and how often each member
+// is sampled to approximate its own rate. Lock the mutex before calling this.
+func (g *analogGroup) rescheduleLocked() {
+	maxRate := 0
+	for _, member := range g.members {
+		if member.smoother.SamplesPerSecond > maxRate {
+			maxRate = member.smoother.SamplesPerSecond
+		}
+	}
+	if maxRate > 0 {
+		g.period = time.Second / time.Duration(maxRate)
+	}
+	for _, member := range g.members {
+		decimation := int(math.Round(float64(maxRate) / float64(member.smoother.SamplesPerSecond)))
+		if decimation < 1 {
+			decimation = 1
+		}
+		member.decimation = decimation
+		member.countdown = 0
+	}
+
+	g.restart = true
+	select {
+	case g.changed <- struct{}{}:
+	default:
+	}
+}
+
+func (g *analogGroup) run(ctx context.Context) {
+	var deadline time.Time
+	for {
+		g.mu.Lock()
+		if g.restart {
+			deadline = time.Now()
+			g.restart = false
+		}
+		empty := len(g.members) == 0
+		retired := g.retired
+		period := g.period
+		g.mu.Unlock()
+
+		if retired {
+			return
+		}
+		if empty {
+			select {
+			case <-ctx.Done():
+				return
+			case <-g.changed:
+				continue
+			}
+		}
+
+		if wait := time.Until(deadline); wait > 0 {
+			timer := time.NewTimer(wait)
+			select {
+			case <-ctx.Done():
+				timer.Stop()
+				return
+			case <-g.changed:
+				timer.Stop()
+				continue
+			case <-timer.C:
+			}
+		}
+
+		g.burst(ctx, g.dueMembers(), time.Now())
+		deadline = nextSampleDeadline(deadline, period, time.Now())
+	}
+}
+
+// dueMembers returns the smoothers to sample in this burst.
+func (g *analogGroup) dueMembers() []*AnalogSmoother {
+	g.mu.Lock()
+	defer g.mu.Unlock()
+	var due []*AnalogSmoother
+	for _, member := range g.members {
+		if member.countdown > 0 {
+			member.countdown--
+			continue
+		}
+		member.countdown = member.decimation - 1
+		due = append(due, member.smoother)
+	}
+	return due
+}
+
+// burst samples every smoother in `due`, which were all due at `sampleTime`.
+func (g *analogGroup) burst(ctx context.Context, due []*AnalogSmoother, sampleTime time.Time) {
+	var stopped []*AnalogSmoother
+	addSample := func(smoother *AnalogSmoother, reading board.AnalogValue, err error) {
+		if !smoother.addSample(ctx, reading, err, sampleTime) {
+			stopped = append(stopped, smoother)
+		}
+	}
+
+	if burstReader, ok := g.device.(AnalogBurstReader); ok && len(due) > 1 {
+		readers := make([]board.Analog, 0, len(due))
+		for _, smoother := range due {
+			readers = append(readers, smoother.Raw)
+		}
+		readings, err := burstReader.ReadBurst(ctx, readers)
+		for i, smoother := range due {
+			if err != nil {
+				addSample(smoother, board.AnalogValue{}, err)
+			} else {
+				addSample(smoother, readings[i], nil)
+			}
+		}
+	} else {
+		for _, smoother := range due {
+			reading, err := smoother.Raw.Read(ctx, nil)
+			addSample(smoother, reading, err)
+		}
+	}
+
+	for _, smoother := range stopped {
+		g.remove(smoother)
+	}
+}
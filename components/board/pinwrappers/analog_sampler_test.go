@@ -0,0 +1,159 @@
+package pinwrappers
+
+import (
+	"context"
+	"sync"
+	"testing"
+	"time"
+
+	"go.viam.com/test"
+	"go.viam.com/utils/testutils"
+
+	"go.viam.com/rdk/components/board"
+	"go.viam.com/rdk/grpc"
+	"go.viam.com/rdk/logging"
+)
+
+// burstAnalog is an input of a burstDevice. Each input always reads its own value.
+type burstAnalog struct {
+	value int
+}
+
+func (a *burstAnalog) Read(ctx context.Context, extra map[string]interface{}) (board.AnalogValue, error) {
+	return board.AnalogValue{Value: a.value}, nil
+}
+
+func (a *burstAnalog) Write(ctx context.Context, value int, extra map[string]interface{}) error {
+	return grpc.UnimplementedError
+}
+
+// burstDevice records the inputs sampled in each burst.
+type burstDevice struct {
+	mu     sync.Mutex
+	bursts [][]int
+}
+
+func (d *burstDevice) ReadBurst(ctx context.Context, readers []board.Analog) ([]board.AnalogValue, error) {
+	var values []int
+	var readings []board.AnalogValue
+	for _, reader := range readers {
+		reading, err := reader.Read(ctx, nil)
+		if err != nil {
+			return nil, err
+		}
+		values = append(values, reading.Value)
+		readings = append(readings, reading)
+	}
+	d.mu.Lock()
+	defer d.mu.Unlock()
+	d.bursts = append(d.bursts, values)
+	return readings, nil
+}
+
+func TestAnalogSamplerBursts(t *testing.T) {
+	logger := logging.NewTestLogger(t)
+	sampler := NewAnalogSampler(logger)
+	defer sampler.Close()
+
+	dev := &burstDevice{}
+	fast := sampler.SmoothAnalogReader(dev, &burstAnalog{value: 1}, board.AnalogReaderConfig{
+		AverageOverMillis: 100, SamplesPerSecond: 200,
+	})
+	slow := sampler.SmoothAnalogReader(dev, &burstAnalog{value: 2}, board.AnalogReaderConfig{
+		AverageOverMillis: 100, SamplesPerSecond: 100,
+	})
+
+	testutils.WaitForAssertion(t, func(tb testing.TB) {
+		tb.Helper()
+		dev.mu.Lock()
+		defer dev.mu.Unlock()
+		test.That(tb, len(dev.bursts), test.ShouldBeGreaterThanOrEqualTo, 6)
+	})
+	test.That(t, slow.Close(context.Background()), test.ShouldBeNil)
+
+	dev.mu.Lock()
+	bursts := dev.bursts
+	dev.bursts = nil
+	dev.mu.Unlock()
+
+	// Both inputs are read together in the first burst after they were both added, and then the
+	// slow one is only read every other burst.
+	start := 0
+	for start < len(bursts) && len(bursts[start]) != 2 {
+		start++
+	}
+	test.That(t, start, test.ShouldBeLessThan, len(bursts)-4)
+	for i, burst := range bursts[start : start+4] {
+		if i%2 == 0 {
+			test.That(t, burst, test.ShouldResemble, []int{1, 2})
+		} else {
+			test.That(t, burst, test.ShouldResemble, []int{1})
+		}
+	}
+
+	// Once the slow input is closed, only the fast one is read, one at a time rather than in a
+	// burst.
+	testutils.WaitForAssertion(t, func(tb testing.TB) {
+		tb.Helper()
+		val, err := fast.Read(context.Background(), nil)
+		test.That(tb, err, test.ShouldBeNil)
+		test.That(tb, val.Value, test.ShouldEqual, 1)
+		test.That(tb, time.Since(fast.LastSampleTime()), test.ShouldBeLessThan, time.Second)
+	})
+	// A burst that was already underway when the slow input was closed might have finished since.
+	dev.mu.Lock()
+	dev.bursts = nil
+	dev.mu.Unlock()
+	time.Sleep(50 * time.Millisecond)
+	dev.mu.Lock()
+	defer dev.mu.Unlock()
+	test.That(t, dev.bursts, test.ShouldBeEmpty)
+}
+
+func TestAnalogSamplerReconfigure(t *testing.T) {
+	logger := logging.NewTestLogger(t)
+	sampler := NewAnalogSampler(logger)
+	defer sampler.Close()
+
+	numGroups := func() int {
+		sampler.mu.Lock()
+		defer sampler.mu.Unlock()
+		return len(sampler.groups)
+	}
+
+	// Like a board reconfiguring its analog readers, which makes a new device each time.
+	var smoothers []*AnalogSmoother
+	for i := 0; i < 3; i++ {
+		for _, smoother := range smoothers {
+			test.That(t, smoother.Close(context.Background()), test.ShouldBeNil)
+		}
+		dev := &burstDevice{}
+		smoothers = []*AnalogSmoother{
+			sampler.SmoothAnalogReader(dev, &burstAnalog{value: 1}, board.AnalogReaderConfig{
+				AverageOverMillis: 10, SamplesPerSecond: 100,
+			}),
+			sampler.SmoothAnalogReader(dev, &burstAnalog{value: 2}, board.AnalogReaderConfig{
+				AverageOverMillis: 10, SamplesPerSecond: 100,
+			}),
+		}
+		test.That(t, numGroups(), test.ShouldEqual, 1)
+	}
+
+	for _, smoother := range smoothers {
+		test.That(t, smoother.Close(context.Background()), test.ShouldBeNil)
+	}
+	test.That(t, numGroups(), test.ShouldEqual, 0)
+}
+
+func TestNextSampleDeadline(t *testing.T) {
+	start := time.Unix(0, 0)
+	period := 10 * time.Millisecond
+
+	// On time: the next deadline is one period later, no matter how long the sample took.
+	test.That(t, nextSampleDeadline(start, period, start.Add(3*time.Millisecond)),
+		test.ShouldEqual, start.Add(period))
+
+	// Missed deadlines are skipped, staying on the grid.
+	test.That(t, nextSampleDeadline(start, period, start.Add(35*time.Millisecond)),
+		test.ShouldEqual, start.Add(40*time.Millisecond))
+}
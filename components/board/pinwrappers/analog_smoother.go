@@ -30,10 +30,26 @@ type AnalogSmoother struct {
 	logger            logging.Logger
 	workers           utils.StoppableWorkers
 	analogVal         board.AnalogValue
+	lastSampleNanos   atomic.Int64
+
+	// Only used by whatever takes the samples: the smoother's own goroutine, or its group.
+	consecutiveErrors int
+	lastReadError     error
+
+	// group is set if the smoother is sampled by an AnalogSampler rather than its own goroutine.
+	group *analogGroup
 }
 
-// SmoothAnalogReader wraps the given reader in a smoother.
+// SmoothAnalogReader wraps the given reader in a smoother, which samples it in its own goroutine.
+// To sample several readers on the same device together, use an AnalogSampler instead.
 func SmoothAnalogReader(r board.Analog, c board.AnalogReaderConfig, logger logging.Logger) *AnalogSmoother {
+	smoother := newAnalogSmoother(r, c, logger)
+	smoother.Start()
+	return smoother
+}
+
+// newAnalogSmoother creates a smoother without starting to sample it.
+func newAnalogSmoother(r board.Analog, c board.AnalogReaderConfig, logger logging.Logger) *AnalogSmoother {
 	smoother := &AnalogSmoother{
 		Raw:               r,
 		AverageOverMillis: c.AverageOverMillis,
@@ -49,8 +65,6 @@ func SmoothAnalogReader(r board.Analog, c board.AnalogReaderConfig, logger loggi
 	analogVal, err := smoother.Raw.Read(context.Background(), nil)
 	smoother.lastError.Store(&errValue{err != nil, err})
 	smoother.analogVal = analogVal
-
-	smoother.Start()
 	return smoother
 }
 
@@ -62,10 +76,21 @@ type errValue struct {
 
 // Close stops the smoothing routine.
 func (as *AnalogSmoother) Close(ctx context.Context) error {
-	as.workers.Stop()
+	if as.group != nil {
+		as.group.remove(as)
+		return nil
+	}
+	if as.workers != nil {
+		as.workers.Stop()
+	}
 	return nil
 }
 
+// LastSampleTime returns when the underlying reader was last sampled.
+func (as *AnalogSmoother) LastSampleTime() time.Time {
+	return time.Unix(0, as.lastSampleNanos.Load())
+}
+
 // Read returns the smoothed out reading.
 func (as *AnalogSmoother) Read(ctx context.Context, extra map[string]interface{}) (board.AnalogValue, error) {
 	analogVal := board.AnalogValue{
@@ -94,6 +119,35 @@ func (as *AnalogSmoother) Read(ctx context.Context, extra map[string]interface{}
 // Start begins the smoothing routine that reads from the underlying
 // analog reader.
 func (as *AnalogSmoother) Start() {
+	as.setupAverage()
+
+	period := time.Second / time.Duration(as.SamplesPerSecond)
+	as.workers = utils.NewStoppableWorkers(func(ctx context.Context) {
+		// Samples are due at absolute deadlines, so time spent reading and late wakeups don't lower
+		// the sample rate.
+		deadline := time.Now()
+		for {
+			select {
+			case <-ctx.Done():
+				return
+			default:
+			}
+			sampleTime := time.Now()
+			reading, err := as.Raw.Read(ctx, nil)
+			if !as.addSample(ctx, reading, err, sampleTime) {
+				return
+			}
+
+			deadline = nextSampleDeadline(deadline, period, time.Now())
+			if !goutils.SelectContextOrWait(ctx, time.Until(deadline)) {
+				return
+			}
+		}
+	})
+}
+
+// setupAverage sizes the rolling average for the configured sample rate and averaging window.
+func (as *AnalogSmoother) setupAverage() {
 	// examples 1
 	//    AverageOverMillis 10
 	//    SamplesPerSecond  1000
@@ -110,59 +164,53 @@ func (as *AnalogSmoother) Start() {
 	//    numSamples        4
 
 	numSamples := (as.SamplesPerSecond * as.AverageOverMillis) / 1000
-	nanosBetween := 1e9 / as.SamplesPerSecond
 	if numSamples >= 1 {
 		as.data = utils.NewRollingAverage(numSamples)
 	} else {
 		as.logger.Debug("Too few samples to smooth over; defaulting to raw data.")
 		as.data = nil
 	}
+}
 
-	as.workers = utils.NewStoppableWorkers(func(ctx context.Context) {
-		consecutiveErrors := 0
-		var lastError error
-
-		for {
-			select {
-			case <-ctx.Done():
-				return
-			default:
-			}
-			start := time.Now()
-			reading, err := as.Raw.Read(ctx, nil)
-			as.lastError.Store(&errValue{err != nil, err})
-			if err == nil {
-				as.lastData = reading.Value
-				if as.data != nil {
-					as.data.Add(reading.Value)
-				}
-				consecutiveErrors = 0
-			} else { // Non-nil error
-				if errors.Is(err, errStopReading) {
-					break
-				}
-				if lastError != nil && err.Error() == lastError.Error() {
-					consecutiveErrors++
-				} else {
-					as.logger.CInfow(ctx, "error reading analog", "error", err)
-					consecutiveErrors = 0
-				}
-				// Don't spam the errors: only remind us of the problem every 10 seconds.
-				if consecutiveErrors == (as.SamplesPerSecond * 10) {
-					as.logger.CErrorw(ctx, "unable to read analog for 10 seconds", "error", err)
-					consecutiveErrors = 0
-				}
-			}
-			lastError = err
-
-			end := time.Now()
-
-			toSleep := int64(nanosBetween) - (end.UnixNano() - start.UnixNano())
-			if !goutils.SelectContextOrWait(ctx, time.Duration(toSleep)) {
-				return
-			}
+// addSample records a sample taken at `sampleTime`, or the error from trying to take it. It
+// returns false if sampling should stop.
+func (as *AnalogSmoother) addSample(ctx context.Context, reading board.AnalogValue, err error, sampleTime time.Time) bool {
+	as.lastError.Store(&errValue{err != nil, err})
+	if err == nil {
+		as.lastData = reading.Value
+		if as.data != nil {
+			as.data.Add(reading.Value)
 		}
-	})
+		as.lastSampleNanos.Store(sampleTime.UnixNano())
+		as.consecutiveErrors = 0
+	} else { // Non-nil error
+		if errors.Is(err, errStopReading) {
+			return false
+		}
+		if as.lastReadError != nil && err.Error() == as.lastReadError.Error() {
+			as.consecutiveErrors++
+		} else {
+			as.logger.CInfow(ctx, "error reading analog", "error", err)
+			as.consecutiveErrors = 0
+		}
+		// Don't spam the errors: only remind us of the problem every 10 seconds.
+		if as.consecutiveErrors == (as.SamplesPerSecond * 10) {
+			as.logger.CErrorw(ctx, "unable to read analog for 10 seconds", "error", err)
+			as.consecutiveErrors = 0
+		}
+	}
+	as.lastReadError = err
+	return true
+}
+
+// nextSampleDeadline returns the first deadline after `deadline` on its grid of `period`s that is
+// still in the future. Deadlines that were missed entirely are skipped rather than made up.
+func nextSampleDeadline(deadline time.Time, period time.Duration, now time.Time) time.Time {
+	deadline = deadline.Add(period)
+	if behind := now.Sub(deadline); behind > 0 {
+		deadline = deadline.Add((behind/period + 1) * period)
+	}
+	return deadline
 }
 
 func (as *AnalogSmoother) Write(ctx context.Context, value int, extra map[string]interface{}) error {
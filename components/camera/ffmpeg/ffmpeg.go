@@ -16,6 +16,7 @@ import (
 	viamutils "go.viam.com/utils"
 
 	"go.viam.com/rdk/components/camera"
+	"go.viam.com/rdk/components/camera/rtppassthrough"
 	"go.viam.com/rdk/gostream"
 	"go.viam.com/rdk/logging"
 	"go.viam.com/rdk/resource"
@@ -31,8 +32,26 @@ type Config struct {
 	InputKWArgs          map[string]interface{}             `json:"input_kw_args,omitempty"`
 	Filters              []FilterConfig                     `json:"filters,omitempty"`
 	OutputKWArgs         map[string]interface{}             `json:"output_kw_args,omitempty"`
+	// OutputFormat selects how frames are handed from ffmpeg to the camera. See the output format
+	// constants. Defaults to mjpeg.
+	OutputFormat string `json:"output_format,omitempty"`
+	// Width and Height are the frame dimensions ffmpeg scales to for the rawvideo output format.
+	// They default to the dimensions in intrinsic_parameters.
+	Width  int `json:"width_px,omitempty"`
+	Height int `json:"height_px,omitempty"`
 }
 
+const (
+	// OutputFormatMJPEG has ffmpeg encode every frame as a JPEG that the camera decodes.
+	OutputFormatMJPEG = "mjpeg"
+	// OutputFormatRawVideo has ffmpeg write uncompressed yuv420p frames of a fixed size. This avoids
+	// encoding and decoding each frame.
+	OutputFormatRawVideo = "rawvideo"
+	// OutputFormatH264 has ffmpeg write an H.264 stream, copied from the input when no filters are
+	// configured, that is only made available to RTP passthrough streams. Images cannot be read.
+	OutputFormatH264 = "h264"
+)
+
 // FilterConfig is a struct to used to configure ffmpeg filters.
 type FilterConfig struct {
 	Name   string                 `json:"name"`
@@ -49,9 +68,34 @@ func (cfg *Config) Validate(path string) ([]string, error) {
 				cfg.CameraParameters.Width, cfg.CameraParameters.Height)
 		}
 	}
+	switch cfg.OutputFormat {
+	case "", OutputFormatMJPEG, OutputFormatH264:
+	case OutputFormatRawVideo:
+		width, height := cfg.frameSize()
+		if width <= 0 || height <= 0 {
+			return nil, resource.NewConfigValidationError(path,
+				errors.New("output_format rawvideo requires positive width_px and height_px"))
+		}
+	default:
+		return nil, resource.NewConfigValidationError(path, fmt.Errorf("unsupported output_format %q", cfg.OutputFormat))
+	}
 	return []string{}, nil
 }
 
+// frameSize returns the configured frame dimensions, falling back to the intrinsic parameters.
+func (cfg *Config) frameSize() (int, int) {
+	width, height := cfg.Width, cfg.Height
+	if cfg.CameraParameters != nil {
+		if width == 0 {
+			width = cfg.CameraParameters.Width
+		}
+		if height == 0 {
+			height = cfg.CameraParameters.Height
+		}
+	}
+	return width, height
+}
+
 var model = resource.DefaultModelFamily.WithModel("ffmpeg")
 
 func init() {
@@ -80,7 +124,9 @@ type ffmpegCamera struct {
 	activeBackgroundWorkers sync.WaitGroup
 	inClose                 func() error
 	outClose                func() error
-	logger                  logging.Logger
+	// passthrough is only set for the h264 output format.
+	passthrough *h264Passthrough
+	logger      logging.Logger
 }
 
 type stderrWriter struct {
@@ -103,8 +149,26 @@ func NewFFMPEGCamera(ctx context.Context, conf *Config, logger logging.Logger) (
 	for key, value := range conf.OutputKWArgs {
 		outArgs[key] = value
 	}
-	outArgs["update"] = 1        // always interpret the filename as just a filename, not a pattern
-	outArgs["format"] = "image2" // select image file muxer, used to write video frames to image files
+	switch conf.OutputFormat {
+	case OutputFormatRawVideo:
+		width, height := conf.frameSize()
+		if width <= 0 || height <= 0 {
+			return nil, errors.New("output_format rawvideo requires positive width_px and height_px")
+		}
+		outArgs["format"] = "rawvideo"
+		outArgs["pix_fmt"] = "yuv420p"
+		outArgs["s"] = fmt.Sprintf("%dx%d", width, height)
+	case OutputFormatH264:
+		outArgs["format"] = "h264" // raw Annex-B H.264 elementary stream
+		_, hasCodec := outArgs["c:v"]
+		_, hasVCodec := outArgs["vcodec"]
+		if len(conf.Filters) == 0 && !hasCodec && !hasVCodec {
+			outArgs["c:v"] = "copy"
+		}
+	default:
+		outArgs["update"] = 1        // always interpret the filename as just a filename, not a pattern
+		outArgs["format"] = "image2" // select image file muxer, used to write video frames to image files
+	}
 
 	// instantiate camera with cancellable context that will be applied to all spawned processes
 	cancelableCtx, cancel := context.WithCancel(context.Background())
@@ -121,7 +185,8 @@ func NewFFMPEGCamera(ctx context.Context, conf *Config, logger logging.Logger) (
 
 	// We will launch two goroutines:
 	// - One to shell out to ffmpeg and wait on it exiting.
-	// - Another to read the image output of ffmpeg and write it to a shared pointer.
+	// - Another to read the output of ffmpeg. Depending on the output format it decodes JPEGs or
+	//   reads raw frames into a shared pointer, or packetizes H.264 for passthrough subscribers.
 	//
 	// In addition, there are two other actors in this system:
 	// - The application servicing GetImage and video streams will execute the callback registered
@@ -166,12 +231,36 @@ func NewFFMPEGCamera(ctx context.Context, conf *Config, logger logging.Logger) (
 		ffCam.activeBackgroundWorkers.Done()
 	})
 
+	switch conf.OutputFormat {
+	case OutputFormatRawVideo:
+		ffCam.VideoReader = ffCam.startRawVideoReader(cancelableCtx, in, conf)
+	case OutputFormatH264:
+		ffCam.passthrough = newH264Passthrough(logger)
+		ffCam.activeBackgroundWorkers.Add(1)
+		viamutils.ManagedGo(func() {
+			ffCam.passthrough.run(cancelableCtx, in)
+		}, ffCam.activeBackgroundWorkers.Done)
+		ffCam.VideoReader = gostream.VideoReaderFunc(func(ctx context.Context) (image.Image, func(), error) {
+			return nil, nil, errors.New("ffmpeg camera with output_format h264 only supports rtp passthrough streams")
+		})
+	default:
+		ffCam.VideoReader = ffCam.startMJPEGReader(cancelableCtx, in)
+	}
+	return camera.NewVideoSourceFromReader(
+		ctx,
+		ffCam,
+		&transform.PinholeCameraModel{PinholeCameraIntrinsics: conf.CameraParameters},
+		camera.ColorStream)
+}
+
+// startMJPEGReader decodes the JPEG images output by ffmpeg in the background.
+func (fc *ffmpegCamera) startMJPEGReader(cancelableCtx context.Context, in io.Reader) gostream.VideoReader {
 	var latestFrame atomic.Pointer[image.Image]
 	// Pause the GetImage reader until the producer provides a first item.
 	var gotFirstFrameOnce bool
 	gotFirstFrame := make(chan struct{})
 
-	ffCam.activeBackgroundWorkers.Add(1)
+	fc.activeBackgroundWorkers.Add(1)
 	viamutils.ManagedGo(func() {
 		for {
 			if cancelableCtx.Err() != nil {
@@ -187,10 +276,10 @@ func NewFFMPEGCamera(ctx context.Context, conf *Config, logger logging.Logger) (
 				gotFirstFrameOnce = true
 			}
 		}
-	}, ffCam.activeBackgroundWorkers.Done)
+	}, fc.activeBackgroundWorkers.Done)
 
 	// when next image is requested simply load the image from where it is stored in shared memory
-	reader := gostream.VideoReaderFunc(func(ctx context.Context) (image.Image, func(), error) {
+	return gostream.VideoReaderFunc(func(ctx context.Context) (image.Image, func(), error) {
 		select {
 		case <-cancelableCtx.Done():
 			return nil, nil, cancelableCtx.Err()
@@ -204,13 +293,74 @@ func NewFFMPEGCamera(ctx context.Context, conf *Config, logger logging.Logger) (
 		}
 		return *latest, func() {}, nil
 	})
+}
 
-	ffCam.VideoReader = reader
-	return camera.NewVideoSourceFromReader(
-		ctx,
-		ffCam,
-		&transform.PinholeCameraModel{PinholeCameraIntrinsics: conf.CameraParameters},
-		camera.ColorStream)
+// startRawVideoReader reads fixed size yuv420p frames output by ffmpeg into images in the
+// background. The goroutine exits once the pipe is closed.
+func (fc *ffmpegCamera) startRawVideoReader(cancelableCtx context.Context, in io.Reader, conf *Config) gostream.VideoReader {
+	width, height := conf.frameSize()
+	var latestFrame atomic.Pointer[image.YCbCr]
+	// Pause the GetImage reader until the producer provides a first item.
+	var gotFirstFrameOnce bool
+	gotFirstFrame := make(chan struct{})
+
+	fc.activeBackgroundWorkers.Add(1)
+	viamutils.ManagedGo(func() {
+		for {
+			if cancelableCtx.Err() != nil {
+				return
+			}
+			frame, err := readYUVFrame(in, width, height)
+			if err != nil {
+				if pipeClosed(err) {
+					return
+				}
+				fc.logger.Debugw("error reading rawvideo frame", "err", err)
+				viamutils.SelectContextOrWait(cancelableCtx, readErrorBackoff)
+				continue
+			}
+			latestFrame.Store(frame)
+			if !gotFirstFrameOnce {
+				close(gotFirstFrame)
+				gotFirstFrameOnce = true
+			}
+		}
+	}, fc.activeBackgroundWorkers.Done)
+
+	return gostream.VideoReaderFunc(func(ctx context.Context) (image.Image, func(), error) {
+		select {
+		case <-cancelableCtx.Done():
+			return nil, nil, cancelableCtx.Err()
+		case <-ctx.Done():
+			return nil, nil, ctx.Err()
+		case <-gotFirstFrame:
+		}
+		frame := latestFrame.Load()
+		if frame == nil {
+			return nil, func() {}, errors.New("no frame yet")
+		}
+		return frame, func() {}, nil
+	})
+}
+
+// SubscribeRTP begins a subscription to receive RTP packets. Only supported with the h264 output format.
+func (fc *ffmpegCamera) SubscribeRTP(
+	ctx context.Context,
+	bufferSize int,
+	packetsCB rtppassthrough.PacketCallback,
+) (rtppassthrough.Subscription, error) {
+	if fc.passthrough == nil {
+		return rtppassthrough.NilSubscription, ErrRTPPassthroughNotEnabled
+	}
+	return fc.passthrough.subscribe(bufferSize, packetsCB)
+}
+
+// Unsubscribe terminates the subscription.
+func (fc *ffmpegCamera) Unsubscribe(ctx context.Context, id rtppassthrough.SubscriptionID) error {
+	if fc.passthrough == nil {
+		return ErrRTPPassthroughNotEnabled
+	}
+	return fc.passthrough.unsubscribe(id)
 }
 
 func (fc *ffmpegCamera) Close(ctx context.Context) error {
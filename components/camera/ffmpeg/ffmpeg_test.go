@@ -1,7 +1,10 @@
 package ffmpeg
 
 import (
+	"bytes"
 	"context"
+	"image"
+	"io"
 	"os"
 	"testing"
 
@@ -27,6 +30,93 @@ func TestFFMPEGCamera(t *testing.T) {
 	test.That(t, cam.Close(context.Background()), test.ShouldBeNil)
 }
 
+func TestFFMPEGCameraRawVideo(t *testing.T) {
+	logger := logging.NewTestLogger(t)
+	ctx := context.Background()
+	path := artifact.MustPath("components/camera/ffmpeg/testsrc.mpg")
+	cam, err := NewFFMPEGCamera(ctx, &Config{VideoPath: path, OutputFormat: OutputFormatRawVideo, Width: 64, Height: 48}, logger)
+	test.That(t, err, test.ShouldBeNil)
+	stream, err := cam.Stream(ctx)
+	test.That(t, err, test.ShouldBeNil)
+	for i := 0; i < 5; i++ {
+		img, release, err := stream.Next(ctx)
+		test.That(t, err, test.ShouldBeNil)
+		test.That(t, img.Bounds(), test.ShouldResemble, image.Rect(0, 0, 64, 48))
+		release()
+	}
+	test.That(t, stream.Close(context.Background()), test.ShouldBeNil)
+	test.That(t, cam.Close(context.Background()), test.ShouldBeNil)
+}
+
+func TestValidateOutputFormat(t *testing.T) {
+	_, err := (&Config{OutputFormat: OutputFormatRawVideo}).Validate("path")
+	test.That(t, err, test.ShouldNotBeNil)
+	test.That(t, err.Error(), test.ShouldContainSubstring, "width_px")
+
+	_, err = (&Config{OutputFormat: "gif"}).Validate("path")
+	test.That(t, err, test.ShouldNotBeNil)
+
+	_, err = (&Config{OutputFormat: OutputFormatH264}).Validate("path")
+	test.That(t, err, test.ShouldBeNil)
+}
+
+func TestReadYUVFrame(t *testing.T) {
+	// 4x2 luma plus two 2x1 chroma planes.
+	src := bytes.NewReader([]byte{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24})
+
+	frame, err := readYUVFrame(src, 4, 2)
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, frame.Y, test.ShouldResemble, []byte{1, 2, 3, 4, 5, 6, 7, 8})
+	test.That(t, frame.Cb, test.ShouldResemble, []byte{9, 10})
+	test.That(t, frame.Cr, test.ShouldResemble, []byte{11, 12})
+
+	// Reading the next frame leaves an image already handed out untouched.
+	next, err := readYUVFrame(src, 4, 2)
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, next.Y[0], test.ShouldEqual, 13)
+	test.That(t, frame.Y[0], test.ShouldEqual, 1)
+
+	_, err = readYUVFrame(src, 4, 2)
+	test.That(t, err, test.ShouldEqual, io.EOF)
+	test.That(t, pipeClosed(err), test.ShouldBeTrue)
+	test.That(t, pipeClosed(io.ErrClosedPipe), test.ShouldBeTrue)
+}
+
+func TestAnnexBAccessUnits(t *testing.T) {
+	sps := []byte{0x67, 0x42}
+	pps := []byte{0x68, 0xce}
+	idr := []byte{0x65, 0x88, 0x01}
+	// A second slice of the same picture has a non-zero first_mb_in_slice.
+	idrSecondSlice := []byte{0x65, 0x40, 0x02}
+	nonIDR := []byte{0x41, 0x9a, 0x03}
+
+	var stream []byte
+	for _, nalu := range [][]byte{sps, pps, idr, idrSecondSlice, nonIDR, nonIDR, sps, pps, idr} {
+		stream = append(stream, 0, 0, 0, 1)
+		stream = append(stream, nalu...)
+	}
+
+	// Feed the stream one byte at a time so that start codes straddle reads.
+	scanner := newAnnexBScanner(bytes.NewReader(stream))
+	scanner.chunk = make([]byte, 1)
+
+	au, err := scanner.nextAccessUnit()
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, au, test.ShouldResemble, [][]byte{sps, pps, idr, idrSecondSlice})
+
+	au, err = scanner.nextAccessUnit()
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, au, test.ShouldResemble, [][]byte{nonIDR})
+
+	au, err = scanner.nextAccessUnit()
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, au, test.ShouldResemble, [][]byte{nonIDR})
+
+	// The final access unit is never terminated by a following start code.
+	_, err = scanner.nextAccessUnit()
+	test.That(t, err, test.ShouldEqual, io.EOF)
+}
+
 func TestFFMPEGNotFound(t *testing.T) {
 	oldpath := os.Getenv("PATH")
 	defer func() {
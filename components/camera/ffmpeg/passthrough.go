@@ -0,0 +1,239 @@
+package ffmpeg
+
+import (
+	"bytes"
+	"context"
+	"errors"
+	"io"
+	"sync"
+	"time"
+
+	"github.com/bluenviron/gortsplib/v4/pkg/format"
+	"github.com/bluenviron/gortsplib/v4/pkg/format/rtph264"
+	"github.com/bluenviron/gortsplib/v4/pkg/rtptime"
+	"github.com/bluenviron/mediacommon/pkg/codecs/h264"
+	viamutils "go.viam.com/utils"
+
+	"go.viam.com/rdk/components/camera/rtppassthrough"
+	"go.viam.com/rdk/logging"
+)
+
+// ErrRTPPassthroughNotEnabled indicates that the camera is not configured with the h264 output format.
+var ErrRTPPassthroughNotEnabled = errors.New("rtp passthrough requires output_format h264")
+
+var annexBStartCode = []byte{0, 0, 1}
+
+// annexBScanner splits an H.264 Annex-B byte stream into access units.
+type annexBScanner struct {
+	src   io.Reader
+	chunk []byte
+	// buf holds bytes read from `src` that do not yet make up a complete NALU.
+	buf []byte
+	// held is the first NALU of the next access unit, read while finding the end of the current one.
+	held []byte
+}
+
+func newAnnexBScanner(src io.Reader) *annexBScanner {
+	return &annexBScanner{src: src, chunk: make([]byte, 64*1024)}
+}
+
+// nextNALU returns the next NALU without its start code. NALUs are only ever returned once the
+// following start code has been read. Returned NALUs are not overwritten by later reads.
+func (scanner *annexBScanner) nextNALU() ([]byte, error) {
+	searchFrom := 0
+	for {
+		if idx := bytes.Index(scanner.buf[searchFrom:], annexBStartCode); idx >= 0 {
+			end := searchFrom + idx
+			// A four byte start code, and any trailing_zero_8bits, leave zeroes at the end.
+			nalu := bytes.TrimRight(scanner.buf[:end], "\x00")
+			scanner.buf = scanner.buf[end+len(annexBStartCode):]
+			searchFrom = 0
+			if len(nalu) == 0 {
+				// The stream starts with a start code.
+				continue
+			}
+			return nalu, nil
+		}
+
+		// Keep searching the last bytes in case a start code straddles two reads.
+		if len(scanner.buf) >= len(annexBStartCode) {
+			searchFrom = len(scanner.buf) - len(annexBStartCode) + 1
+		}
+		n, err := scanner.src.Read(scanner.chunk)
+		scanner.buf = append(scanner.buf, scanner.chunk[:n]...)
+		if err != nil {
+			return nil, err
+		}
+	}
+}
+
+// nextAccessUnit returns the NALUs making up the next access unit. A new access unit begins at the
+// first slice of a picture, or at an access unit delimiter or parameter set, following a slice.
+func (scanner *annexBScanner) nextAccessUnit() ([][]byte, error) {
+	var au [][]byte
+	sawSlice := false
+	if scanner.held != nil {
+		au = append(au, scanner.held)
+		sawSlice = isSlice(scanner.held)
+		scanner.held = nil
+	}
+
+	for {
+		nalu, err := scanner.nextNALU()
+		if err != nil {
+			return nil, err
+		}
+
+		startsAccessUnit := false
+		switch h264.NALUType(nalu[0] & 0x1F) {
+		case h264.NALUTypeAccessUnitDelimiter, h264.NALUTypeSPS, h264.NALUTypePPS, h264.NALUTypeSEI:
+			startsAccessUnit = sawSlice
+		case h264.NALUTypeIDR, h264.NALUTypeNonIDR:
+			// first_mb_in_slice is the first exp-Golomb field of the slice header. It is zero, and
+			// thus coded as a single set bit, for the first slice of a picture.
+			startsAccessUnit = sawSlice && len(nalu) > 1 && nalu[1]&0x80 != 0
+		default:
+		}
+		if startsAccessUnit {
+			scanner.held = nalu
+			return au, nil
+		}
+
+		sawSlice = sawSlice || isSlice(nalu)
+		au = append(au, nalu)
+	}
+}
+
+func isSlice(nalu []byte) bool {
+	typ := h264.NALUType(nalu[0] & 0x1F)
+	return typ == h264.NALUTypeIDR || typ == h264.NALUTypeNonIDR
+}
+
+type bufAndCB struct {
+	cb  rtppassthrough.PacketCallback
+	buf *rtppassthrough.Buffer
+}
+
+// h264Passthrough packetizes the H.264 stream output by ffmpeg and publishes it to RTP
+// subscribers. Frames are never decoded.
+type h264Passthrough struct {
+	logger logging.Logger
+
+	mu           sync.RWMutex
+	bufAndCBByID map[rtppassthrough.SubscriptionID]bufAndCB
+}
+
+func newH264Passthrough(logger logging.Logger) *h264Passthrough {
+	return &h264Passthrough{
+		logger:       logger,
+		bufAndCBByID: make(map[rtppassthrough.SubscriptionID]bufAndCB),
+	}
+}
+
+// run reads access units from `src` until `ctx` is done. Access units are read and discarded while
+// there are no subscribers such that ffmpeg is never blocked writing to the pipe.
+func (pt *h264Passthrough) run(ctx context.Context, src io.Reader) {
+	defer pt.unsubscribeAll()
+
+	webrtcPayloadMaxSize := 1188 // 1200 - 12 (RTP header)
+	encoder := &rtph264.Encoder{
+		PayloadType:    96,
+		PayloadMaxSize: webrtcPayloadMaxSize,
+	}
+	if err := encoder.Init(); err != nil {
+		pt.logger.Error(err)
+		return
+	}
+
+	rtpTime := &rtptime.Encoder{ClockRate: (&format.H264{}).ClockRate()}
+	if err := rtpTime.Initialize(); err != nil {
+		pt.logger.Error(err)
+		return
+	}
+	start := time.Now()
+
+	scanner := newAnnexBScanner(src)
+	for {
+		if ctx.Err() != nil {
+			return
+		}
+		au, err := scanner.nextAccessUnit()
+		if err != nil {
+			if ctx.Err() != nil || pipeClosed(err) {
+				return
+			}
+			pt.logger.Debugw("error reading h264 stream", "err", err)
+			// The pipe is shared across ffmpeg restarts. Resynchronize on the next start code.
+			scanner = newAnnexBScanner(src)
+			viamutils.SelectContextOrWait(ctx, readErrorBackoff)
+			continue
+		}
+		if len(au) == 0 || !pt.hasSubscribers() {
+			continue
+		}
+
+		pkts, err := encoder.Encode(au)
+		if err != nil {
+			pt.logger.Debugw("error packetizing h264 access unit", "err", err)
+			continue
+		}
+		ts := rtpTime.Encode(time.Since(start))
+		for _, pkt := range pkts {
+			pkt.Timestamp = ts
+		}
+
+		pt.mu.RLock()
+		for _, sub := range pt.bufAndCBByID {
+			cb := sub.cb
+			if err := sub.buf.Publish(func() {
+				cb(pkts)
+			}); err != nil {
+				pt.logger.Debugw("Publish err", "err", err)
+			}
+		}
+		pt.mu.RUnlock()
+	}
+}
+
+func (pt *h264Passthrough) hasSubscribers() bool {
+	pt.mu.RLock()
+	defer pt.mu.RUnlock()
+	return len(pt.bufAndCBByID) > 0
+}
+
+func (pt *h264Passthrough) subscribe(bufferSize int, packetsCB rtppassthrough.PacketCallback) (rtppassthrough.Subscription, error) {
+	sub, buf, err := rtppassthrough.NewSubscription(bufferSize)
+	if err != nil {
+		return rtppassthrough.NilSubscription, err
+	}
+
+	pt.mu.Lock()
+	defer pt.mu.Unlock()
+	pt.bufAndCBByID[sub.ID] = bufAndCB{
+		cb:  packetsCB,
+		buf: buf,
+	}
+	buf.Start()
+	return sub, nil
+}
+
+func (pt *h264Passthrough) unsubscribe(id rtppassthrough.SubscriptionID) error {
+	pt.mu.Lock()
+	defer pt.mu.Unlock()
+	sub, ok := pt.bufAndCBByID[id]
+	if !ok {
+		return errors.New("id not found")
+	}
+	delete(pt.bufAndCBByID, id)
+	sub.buf.Close()
+	return nil
+}
+
+func (pt *h264Passthrough) unsubscribeAll() {
+	pt.mu.Lock()
+	defer pt.mu.Unlock()
+	for id, sub := range pt.bufAndCBByID {
+		delete(pt.bufAndCBByID, id)
+		sub.buf.Close()
+	}
+}
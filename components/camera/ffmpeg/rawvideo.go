@@ -0,0 +1,47 @@
+package ffmpeg
+
+import (
+	"errors"
+	"image"
+	"io"
+	"time"
+)
+
+// readErrorBackoff is how long readers of the ffmpeg pipe wait after a read error before trying
+// again.
+const readErrorBackoff = 100 * time.Millisecond
+
+// pipeClosed reports whether `err` means the ffmpeg pipe was closed, i.e. the camera is closing and
+// no more frames will ever arrive.
+func pipeClosed(err error) bool {
+	return errors.Is(err, io.EOF) || errors.Is(err, io.ErrUnexpectedEOF) || errors.Is(err, io.ErrClosedPipe)
+}
+
+// newYUVFrame allocates a yuv420p frame. Frames are never reused: callers of the camera may keep
+// an image and encode it after releasing it, so each frame gets its own pixel memory.
+func newYUVFrame(width, height int) (*image.YCbCr, []byte) {
+	// yuv420p stores a full resolution Y plane followed by quarter resolution Cb and Cr planes. We
+	// back all three planes with one allocation such that a frame is filled with a single read.
+	lumaSize := width * height
+	chromaWidth, chromaHeight := (width+1)/2, (height+1)/2
+	chromaSize := chromaWidth * chromaHeight
+	pix := make([]byte, lumaSize+2*chromaSize)
+	return &image.YCbCr{
+		Y:              pix[:lumaSize:lumaSize],
+		Cb:             pix[lumaSize : lumaSize+chromaSize : lumaSize+chromaSize],
+		Cr:             pix[lumaSize+chromaSize:],
+		YStride:        width,
+		CStride:        chromaWidth,
+		SubsampleRatio: image.YCbCrSubsampleRatio420,
+		Rect:           image.Rect(0, 0, width, height),
+	}, pix
+}
+
+// readYUVFrame reads one frame of the given size from `src` into a newly allocated image.
+func readYUVFrame(src io.Reader, width, height int) (*image.YCbCr, error) {
+	img, pix := newYUVFrame(width, height)
+	if _, err := io.ReadFull(src, pix); err != nil {
+		return nil, err
+	}
+	return img, nil
+}
@@ -0,0 +1,442 @@
+package transformpipeline
+
+import (
+	"context"
+	"image"
+	"image/color"
+	"math"
+	"sync"
+
+	"github.com/pkg/errors"
+	"go.opencensus.io/trace"
+
+	"go.viam.com/rdk/components/camera"
+	"go.viam.com/rdk/gostream"
+	"go.viam.com/rdk/rimage"
+	"go.viam.com/rdk/rimage/transform"
+	"go.viam.com/rdk/utils"
+)
+
+// pixelMap maps each pixel of an output image to the pixel of the source image it is copied from.
+// Output pixel (x, y) is source pixel (cols[x], rows[y]), or (rows[y], cols[x]) if transposed.
+// Crops, nearest neighbor resizes and rotations by multiples of 90 degrees all map pixels this way,
+// so any run of them composes into a single pixelMap, and a single resample of the source.
+type pixelMap struct {
+	cols, rows []int
+	transposed bool
+	// min is the top-left corner of the image as seen by the next stage: only the first stage sees
+	// the source image's own bounds.
+	min image.Point
+}
+
+func newPixelMap(bounds image.Rectangle) pixelMap {
+	m := pixelMap{cols: make([]int, bounds.Dx()), rows: make([]int, bounds.Dy()), min: bounds.Min}
+	for x := range m.cols {
+		m.cols[x] = bounds.Min.X + x
+	}
+	for y := range m.rows {
+		m.rows[y] = bounds.Min.Y + y
+	}
+	return m
+}
+
+// offsets returns xOff and yOff such that the data of the source pixel output pixel (x, y) is
+// copied from starts at xOff[x]+yOff[y], given where the source's columns and rows start.
+func (m pixelMap) offsets(colOffset, rowOffset func(int) int) (xOff, yOff []int) {
+	if m.transposed {
+		colOffset, rowOffset = rowOffset, colOffset
+	}
+	xOff = make([]int, len(m.cols))
+	for x, c := range m.cols {
+		xOff[x] = colOffset(c)
+	}
+	yOff = make([]int, len(m.rows))
+	for y, r := range m.rows {
+		yOff[y] = rowOffset(r)
+	}
+	return xOff, yOff
+}
+
+// subsample returns the map of every sx-th column and sy-th row of the output.
+func (m pixelMap) subsample(sx, sy int) pixelMap {
+	sub := pixelMap{
+		cols:       make([]int, 0, (len(m.cols)+sx-1)/sx),
+		rows:       make([]int, 0, (len(m.rows)+sy-1)/sy),
+		transposed: m.transposed,
+	}
+	for x := 0; x < len(m.cols); x += sx {
+		sub.cols = append(sub.cols, m.cols[x])
+	}
+	for y := 0; y < len(m.rows); y += sy {
+		sub.rows = append(sub.rows, m.rows[y])
+	}
+	return sub
+}
+
+// geometricStage is a transform that only moves pixels around, so that consecutive ones can be
+// folded into one pixelMap.
+type geometricStage interface {
+	// apply returns the map of this stage's output given the map m of its input.
+	apply(m pixelMap) (pixelMap, error)
+}
+
+type cropStage struct {
+	cropWindow image.Rectangle
+}
+
+func (s cropStage) apply(m pixelMap) (pixelMap, error) {
+	bounds := image.Rectangle{m.min, m.min.Add(image.Pt(len(m.cols), len(m.rows)))}
+	r := s.cropWindow.Intersect(bounds).Sub(m.min)
+	if r.Empty() {
+		return pixelMap{}, errors.New("crop transform cropped image to 0 pixels")
+	}
+	return pixelMap{cols: m.cols[r.Min.X:r.Max.X], rows: m.rows[r.Min.Y:r.Max.Y], transposed: m.transposed}, nil
+}
+
+// resizeStage picks the same source pixels as draw.NearestNeighbor.
+type resizeStage struct {
+	width, height int
+}
+
+func (s resizeStage) apply(m pixelMap) (pixelMap, error) {
+	out := pixelMap{cols: make([]int, s.width), rows: make([]int, s.height), transposed: m.transposed}
+	for x := range out.cols {
+		out.cols[x] = m.cols[(2*x+1)*len(m.cols)/(2*s.width)]
+	}
+	for y := range out.rows {
+		out.rows[y] = m.rows[(2*y+1)*len(m.rows)/(2*s.height)]
+	}
+	return out, nil
+}
+
+// rotateStage rotates clockwise by quarterTurns multiples of 90 degrees.
+type rotateStage struct {
+	quarterTurns int
+}
+
+func (s rotateStage) apply(m pixelMap) (pixelMap, error) {
+	width, height := len(m.cols), len(m.rows)
+	switch s.quarterTurns {
+	case 1:
+		// output (x, y) is input (y, height-1-x)
+		out := pixelMap{cols: make([]int, height), rows: m.cols, transposed: !m.transposed}
+		for x := range out.cols {
+			out.cols[x] = m.rows[height-1-x]
+		}
+		return out, nil
+	case 2:
+		out := pixelMap{cols: make([]int, width), rows: make([]int, height), transposed: m.transposed}
+		for x := range out.cols {
+			out.cols[x] = m.cols[width-1-x]
+		}
+		for y := range out.rows {
+			out.rows[y] = m.rows[height-1-y]
+		}
+		return out, nil
+	case 3:
+		// output (x, y) is input (width-1-y, x)
+		out := pixelMap{cols: m.rows, rows: make([]int, width), transposed: !m.transposed}
+		for y := range out.rows {
+			out.rows[y] = m.cols[width-1-y]
+		}
+		return out, nil
+	default:
+		return pixelMap{cols: m.cols, rows: m.rows, transposed: m.transposed}, nil
+	}
+}
+
+// geometricStageFor returns the stage of a transform that can be folded into a geometricSource.
+func geometricStageFor(tr Transformation) (geometricStage, bool, error) {
+	switch transformType(tr.Type) {
+	case transformTypeCrop:
+		cropWindow, err := parseCropConfig(tr.Attributes)
+		if err != nil {
+			return nil, false, err
+		}
+		return cropStage{cropWindow}, true, nil
+	case transformTypeResize:
+		conf, err := parseResizeConfig(tr.Attributes)
+		if err != nil {
+			return nil, false, err
+		}
+		if conf.Width < 0 || conf.Height < 0 {
+			return nil, false, nil
+		}
+		return resizeStage{conf.Width, conf.Height}, true, nil
+	case transformTypeRotate:
+		conf, err := parseRotateConfig(tr.Attributes)
+		if err != nil {
+			return nil, false, err
+		}
+		if math.Mod(conf.Angle, 90) != 0 {
+			return nil, false, nil
+		}
+		quarterTurns := int(conf.Angle/90) % 4
+		if quarterTurns < 0 {
+			quarterTurns += 4
+		}
+		return rotateStage{quarterTurns}, true, nil
+	default:
+		return nil, false, nil
+	}
+}
+
+// geometricRun returns the stages of the transforms at the start of pipeline that can be folded
+// into one resample, or nil if there are fewer than two of them.
+func geometricRun(pipeline []Transformation) ([]geometricStage, bool, error) {
+	var stages []geometricStage
+	for _, tr := range pipeline {
+		stage, ok, err := geometricStageFor(tr)
+		if err != nil {
+			return nil, false, err
+		}
+		if !ok {
+			break
+		}
+		stages = append(stages, stage)
+	}
+	if len(stages) < 2 {
+		return nil, false, nil
+	}
+	return stages, true, nil
+}
+
+// geometricSource applies a run of crops, resizes and rotations to each image in one pass, in
+// the image's own format, rather than each stage allocating and converting an image of its own.
+type geometricSource struct {
+	originalStream gostream.VideoStream
+	stream         camera.ImageType
+	stages         []geometricStage
+
+	mu         sync.Mutex
+	lastBounds image.Rectangle
+	lastMap    pixelMap
+	lastErr    error
+}
+
+// newGeometricTransform creates a source that applies all of the stages at once.
+func newGeometricTransform(
+	ctx context.Context, source gostream.VideoSource, stream camera.ImageType, stages []geometricStage,
+) (gostream.VideoSource, camera.ImageType, error) {
+	// Only a rotation keeps the intrinsics of its source, so only a run of rotations does.
+	var cameraModel *transform.PinholeCameraModel
+	onlyRotations := true
+	for _, stage := range stages {
+		if _, ok := stage.(rotateStage); !ok {
+			onlyRotations = false
+		}
+	}
+	if onlyRotations {
+		props, err := propsFromVideoSource(ctx, source)
+		if err != nil {
+			return nil, camera.UnspecifiedStream, err
+		}
+		cameraModel = &transform.PinholeCameraModel{PinholeCameraIntrinsics: props.IntrinsicParams}
+		if props.DistortionParams != nil {
+			cameraModel.Distortion = props.DistortionParams
+		}
+	}
+
+	reader := &geometricSource{originalStream: gostream.NewEmbeddedVideoStream(source), stream: stream, stages: stages}
+	src, err := camera.NewVideoSourceFromReader(ctx, reader, cameraModel, stream)
+	if err != nil {
+		return nil, camera.UnspecifiedStream, err
+	}
+	return src, stream, err
+}
+
+// pixelMap returns the map of the whole run of stages for a source image with the given bounds.
+func (gs *geometricSource) pixelMap(bounds image.Rectangle) (pixelMap, error) {
+	gs.mu.Lock()
+	defer gs.mu.Unlock()
+	if bounds == gs.lastBounds && (gs.lastMap.cols != nil || gs.lastErr != nil) {
+		return gs.lastMap, gs.lastErr
+	}
+	m := newPixelMap(bounds)
+	var err error
+	for _, stage := range gs.stages {
+		if m, err = stage.apply(m); err != nil {
+			break
+		}
+	}
+	gs.lastBounds, gs.lastMap, gs.lastErr = bounds, m, err
+	return m, err
+}
+
+// Read applies all of the stages to the next image.
+func (gs *geometricSource) Read(ctx context.Context) (image.Image, func(), error) {
+	ctx, span := trace.StartSpan(ctx, "camera::transformpipeline::geometric::Read")
+	defer span.End()
+	orig, release, err := gs.originalStream.Next(ctx)
+	if err != nil {
+		return nil, nil, err
+	}
+	if release != nil {
+		// The output does not refer to the original image.
+		defer release()
+	}
+
+	src, err := gs.nativeImage(ctx, orig)
+	if err != nil {
+		return nil, nil, err
+	}
+	m, err := gs.pixelMap(src.Bounds())
+	if err != nil {
+		return nil, nil, err
+	}
+	out := gs.resample(src, m)
+	// The output is never reused. Callers may still encode it after calling release.
+	return out, func() {}, nil
+}
+
+// nativeImage returns the image to resample, only converting it if it is not a format that can
+// be resampled directly.
+func (gs *geometricSource) nativeImage(ctx context.Context, img image.Image) (image.Image, error) {
+	if lazy, ok := img.(*rimage.LazyEncodedImage); ok {
+		decoded, err := rimage.DecodeImage(ctx, lazy.RawData(), lazy.MIMEType())
+		if err != nil {
+			return nil, err
+		}
+		img = decoded
+	}
+	switch gs.stream {
+	case camera.ColorStream, camera.UnspecifiedStream:
+		return img, nil
+	case camera.DepthStream:
+		if gray, ok := img.(*image.Gray16); ok {
+			return gray, nil
+		}
+		return rimage.ConvertImageToDepthMap(ctx, img)
+	default:
+		return nil, camera.NewUnsupportedImageTypeError(gs.stream)
+	}
+}
+
+// output returns a new image of the same format as src of the given size.
+func output(src image.Image, width, height int) image.Image {
+	rect := image.Rect(0, 0, width, height)
+	switch s := src.(type) {
+	case *image.YCbCr:
+		return image.NewYCbCr(rect, s.SubsampleRatio)
+	case *image.RGBA:
+		return image.NewRGBA(rect)
+	case *image.Gray16:
+		return image.NewGray16(rect)
+	case *rimage.DepthMap:
+		return rimage.NewEmptyDepthMap(width, height)
+	case *rimage.Image:
+		return rimage.NewImage(width, height)
+	default:
+		return image.NewNRGBA(rect)
+	}
+}
+
+// resample copies the source pixel of every pixel of the output, splitting the rows across
+// goroutines.
+func (gs *geometricSource) resample(src image.Image, m pixelMap) image.Image {
+	out := output(src, len(m.cols), len(m.rows))
+	switch s := src.(type) {
+	case *image.YCbCr:
+		dst := out.(*image.YCbCr)
+		resamplePix(dst.Y, dst.YStride, s.Y, 1, m, func(x int) int { return x - s.Rect.Min.X },
+			func(y int) int { return (y - s.Rect.Min.Y) * s.YStride })
+		sx, sy := chromaSubsampling(s.SubsampleRatio)
+		chroma := m.subsample(sx, sy)
+		colOffset := func(x int) int { return x/sx - s.Rect.Min.X/sx }
+		rowOffset := func(y int) int { return (y/sy - s.Rect.Min.Y/sy) * s.CStride }
+		resamplePix(dst.Cb, dst.CStride, s.Cb, 1, chroma, colOffset, rowOffset)
+		resamplePix(dst.Cr, dst.CStride, s.Cr, 1, chroma, colOffset, rowOffset)
+	case *image.RGBA:
+		dst := out.(*image.RGBA)
+		resamplePix(dst.Pix, dst.Stride, s.Pix, 4, m, func(x int) int { return (x - s.Rect.Min.X) * 4 },
+			func(y int) int { return (y - s.Rect.Min.Y) * s.Stride })
+	case *image.NRGBA:
+		dst := out.(*image.NRGBA)
+		resamplePix(dst.Pix, dst.Stride, s.Pix, 4, m, func(x int) int { return (x - s.Rect.Min.X) * 4 },
+			func(y int) int { return (y - s.Rect.Min.Y) * s.Stride })
+	case *image.Gray16:
+		dst := out.(*image.Gray16)
+		resamplePix(dst.Pix, dst.Stride, s.Pix, 2, m, func(x int) int { return (x - s.Rect.Min.X) * 2 },
+			func(y int) int { return (y - s.Rect.Min.Y) * s.Stride })
+	case *rimage.DepthMap:
+		dst, srcData := out.(*rimage.DepthMap).Data(), s.Data()
+		xOff, yOff := m.offsets(func(x int) int { return x }, func(y int) int { return y * s.Width() })
+		utils.ParallelForEachRow(len(yOff), func(y int) {
+			row := dst[y*len(xOff) : (y+1)*len(xOff)]
+			for x, xo := range xOff {
+				row[x] = srcData[xo+yOff[y]]
+			}
+		})
+	case *rimage.Image:
+		dst := out.(*rimage.Image)
+		utils.ParallelForEachRow(len(m.rows), func(y int) {
+			for x := range m.cols {
+				dst.SetXY(x, y, s.GetXY(m.sourcePixel(x, y)))
+			}
+		})
+	default:
+		dst := out.(*image.NRGBA)
+		utils.ParallelForEachRow(len(m.rows), func(y int) {
+			for x := range m.cols {
+				dst.SetNRGBA(x, y, color.NRGBAModel.Convert(src.At(m.sourcePixel(x, y))).(color.NRGBA))
+			}
+		})
+	}
+	return out
+}
+
+// sourcePixel returns the source pixel output pixel (x, y) is copied from.
+func (m pixelMap) sourcePixel(x, y int) (int, int) {
+	if m.transposed {
+		return m.rows[y], m.cols[x]
+	}
+	return m.cols[x], m.rows[y]
+}
+
+// resamplePix copies the bpp bytes of the source pixel of every pixel of a plane of the output.
+func resamplePix(dst []byte, dstStride int, src []byte, bpp int, m pixelMap, colOffset, rowOffset func(int) int) {
+	xOff, yOff := m.offsets(colOffset, rowOffset)
+	utils.ParallelForEachRow(len(yOff), func(y int) {
+		row := dst[y*dstStride:]
+		srcRow := src[yOff[y]:]
+		switch bpp {
+		case 1:
+			for x, xo := range xOff {
+				row[x] = srcRow[xo]
+			}
+		case 2:
+			for x, xo := range xOff {
+				row[2*x], row[2*x+1] = srcRow[xo], srcRow[xo+1]
+			}
+		default:
+			for x, xo := range xOff {
+				copy(row[bpp*x:bpp*(x+1)], srcRow[xo:xo+bpp])
+			}
+		}
+	})
+}
+
+// chromaSubsampling returns how many luma columns and rows share each chroma sample.
+func chromaSubsampling(ratio image.YCbCrSubsampleRatio) (int, int) {
+	switch ratio {
+	case image.YCbCrSubsampleRatio422:
+		return 2, 1
+	case image.YCbCrSubsampleRatio420:
+		return 2, 2
+	case image.YCbCrSubsampleRatio440:
+		return 1, 2
+	case image.YCbCrSubsampleRatio411:
+		return 4, 1
+	case image.YCbCrSubsampleRatio410:
+		return 4, 2
+	case image.YCbCrSubsampleRatio444:
+		return 1, 1
+	default:
+		return 1, 1
+	}
+}
+
+// Close closes the original stream.
+func (gs *geometricSource) Close(ctx context.Context) error {
+	return gs.originalStream.Close(ctx)
+}
@@ -0,0 +1,106 @@
+package transformpipeline
+
+import (
+	"image"
+	"image/color"
+	"testing"
+
+	"github.com/disintegration/imaging"
+	"go.viam.com/test"
+	"golang.org/x/image/draw"
+
+	"go.viam.com/rdk/components/camera"
+	"go.viam.com/rdk/rimage"
+	"go.viam.com/rdk/utils"
+)
+
+func TestGeometricRun(t *testing.T) {
+	pipeline := []Transformation{
+		{Type: "crop", Attributes: utils.AttributeMap{"x_min_px": 1, "y_min_px": 1, "x_max_px": 5, "y_max_px": 5}},
+		{Type: "resize", Attributes: utils.AttributeMap{"height_px": 20, "width_px": 10}},
+		{Type: "rotate", Attributes: utils.AttributeMap{"angle_degs": 45}},
+	}
+	stages, ok, err := geometricRun(pipeline)
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, ok, test.ShouldBeTrue)
+	test.That(t, stages, test.ShouldResemble, []geometricStage{cropStage{image.Rect(1, 1, 5, 5)}, resizeStage{10, 20}})
+
+	// a single stage is left as it is
+	_, ok, err = geometricRun(pipeline[1:])
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, ok, test.ShouldBeFalse)
+
+	_, _, err = geometricRun([]Transformation{{Type: "resize", Attributes: utils.AttributeMap{"height_px": 20}}})
+	test.That(t, err, test.ShouldNotBeNil)
+}
+
+func TestGeometricMatchesStages(t *testing.T) {
+	src := image.NewNRGBA(image.Rect(0, 0, 40, 30))
+	for y := 0; y < 30; y++ {
+		for x := 0; x < 40; x++ {
+			src.SetNRGBA(x, y, color.NRGBA{uint8(x * 6), uint8(y * 8), uint8(x + y), 255})
+		}
+	}
+	cropWindow := image.Rect(5, 3, 35, 27)
+
+	for _, quarterTurns := range []int{0, 1, 2, 3} {
+		gs := &geometricSource{
+			stream: camera.ColorStream,
+			stages: []geometricStage{cropStage{cropWindow}, resizeStage{12, 10}, rotateStage{quarterTurns}},
+		}
+		m, err := gs.pixelMap(src.Bounds())
+		test.That(t, err, test.ShouldBeNil)
+		out := gs.resample(src, m)
+
+		cropped := imaging.Crop(src, cropWindow)
+		resized := image.NewRGBA(image.Rect(0, 0, 12, 10))
+		draw.NearestNeighbor.Scale(resized, resized.Bounds(), cropped, cropped.Bounds(), draw.Over, nil)
+		expected := imaging.Rotate(resized, -90*float64(quarterTurns), color.Black)
+
+		test.That(t, out.Bounds(), test.ShouldResemble, expected.Bounds())
+		for y := 0; y < expected.Bounds().Dy(); y++ {
+			for x := 0; x < expected.Bounds().Dx(); x++ {
+				test.That(t, out.At(x, y), test.ShouldResemble, color.NRGBAModel.Convert(expected.At(x, y)))
+			}
+		}
+	}
+}
+
+func TestGeometricNativeFormats(t *testing.T) {
+	stages := []geometricStage{rotateStage{1}, cropStage{image.Rect(0, 0, 2, 4)}}
+
+	ycbcr := image.NewYCbCr(image.Rect(0, 0, 4, 2), image.YCbCrSubsampleRatio420)
+	for i := range ycbcr.Y {
+		ycbcr.Y[i] = uint8(i)
+	}
+	for i := range ycbcr.Cb {
+		ycbcr.Cb[i] = uint8(10 + i)
+		ycbcr.Cr[i] = uint8(20 + i)
+	}
+	gs := &geometricSource{stream: camera.ColorStream, stages: stages}
+	m, err := gs.pixelMap(ycbcr.Bounds())
+	test.That(t, err, test.ShouldBeNil)
+	out, ok := gs.resample(ycbcr, m).(*image.YCbCr)
+	test.That(t, ok, test.ShouldBeTrue)
+	test.That(t, out.SubsampleRatio, test.ShouldEqual, image.YCbCrSubsampleRatio420)
+	// rotated clockwise, the bottom-left pixel is now at the top-left
+	test.That(t, out.Y, test.ShouldResemble, []uint8{4, 0, 5, 1, 6, 2, 7, 3})
+	test.That(t, out.Cb, test.ShouldResemble, []uint8{10, 11})
+	test.That(t, out.Cr, test.ShouldResemble, []uint8{20, 21})
+
+	dm := rimage.NewEmptyDepthMap(4, 2)
+	for i := range dm.Data() {
+		dm.Data()[i] = rimage.Depth(i)
+	}
+	gs = &geometricSource{stream: camera.DepthStream, stages: stages}
+	m, err = gs.pixelMap(dm.Bounds())
+	test.That(t, err, test.ShouldBeNil)
+	outDepth, ok := gs.resample(dm, m).(*rimage.DepthMap)
+	test.That(t, ok, test.ShouldBeTrue)
+	test.That(t, outDepth.Data(), test.ShouldResemble, dm.Rotate(90).Data())
+
+	// cropping outside of the image leaves nothing
+	gs = &geometricSource{stages: []geometricStage{rotateStage{2}, cropStage{image.Rect(10, 10, 20, 20)}}}
+	_, err = gs.pixelMap(dm.Bounds())
+	test.That(t, err, test.ShouldBeError, "crop transform cropped image to 0 pixels")
+}
@@ -33,13 +33,9 @@ type rotateSource struct {
 // newRotateTransform creates a new rotation transform.
 func newRotateTransform(ctx context.Context, source gostream.VideoSource, stream camera.ImageType, am utils.AttributeMap,
 ) (gostream.VideoSource, camera.ImageType, error) {
-	conf, err := resource.TransformAttributeMap[*rotateConfig](am)
+	conf, err := parseRotateConfig(am)
 	if err != nil {
-		return nil, camera.UnspecifiedStream, errors.Wrap(err, "cannot parse rotate attribute map")
-	}
-
-	if !am.Has("angle_degs") {
-		conf.Angle = 180 // Default to 180 for backwards-compatibility
+		return nil, camera.UnspecifiedStream, err
 	}
 
 	props, err := propsFromVideoSource(ctx, source)
@@ -60,6 +56,18 @@ func newRotateTransform(ctx context.Context, source gostream.VideoSource, stream
 	return src, stream, err
 }
 
+func parseRotateConfig(am utils.AttributeMap) (*rotateConfig, error) {
+	conf, err := resource.TransformAttributeMap[*rotateConfig](am)
+	if err != nil {
+		return nil, errors.Wrap(err, "cannot parse rotate attribute map")
+	}
+
+	if !am.Has("angle_degs") {
+		conf.Angle = 180 // Default to 180 for backwards-compatibility
+	}
+	return conf, nil
+}
+
 // Read rotates the 2D image depending on the stream type.
 func (rs *rotateSource) Read(ctx context.Context) (image.Image, func(), error) {
 	ctx, span := trace.StartSpan(ctx, "camera::transformpipeline::rotate::Read")
@@ -106,16 +114,10 @@ type resizeSource struct {
 func newResizeTransform(
 	ctx context.Context, source gostream.VideoSource, stream camera.ImageType, am utils.AttributeMap,
 ) (gostream.VideoSource, camera.ImageType, error) {
-	conf, err := resource.TransformAttributeMap[*resizeConfig](am)
+	conf, err := parseResizeConfig(am)
 	if err != nil {
 		return nil, camera.UnspecifiedStream, err
 	}
-	if conf.Width == 0 {
-		return nil, camera.UnspecifiedStream, errors.New("new width for resize transform cannot be 0")
-	}
-	if conf.Height == 0 {
-		return nil, camera.UnspecifiedStream, errors.New("new height for resize transform cannot be 0")
-	}
 
 	reader := &resizeSource{gostream.NewEmbeddedVideoStream(source), stream, conf.Height, conf.Width}
 	src, err := camera.NewVideoSourceFromReader(ctx, reader, nil, stream)
@@ -125,6 +127,20 @@ func newResizeTransform(
 	return src, stream, err
 }
 
+func parseResizeConfig(am utils.AttributeMap) (*resizeConfig, error) {
+	conf, err := resource.TransformAttributeMap[*resizeConfig](am)
+	if err != nil {
+		return nil, err
+	}
+	if conf.Width == 0 {
+		return nil, errors.New("new width for resize transform cannot be 0")
+	}
+	if conf.Height == 0 {
+		return nil, errors.New("new height for resize transform cannot be 0")
+	}
+	return conf, nil
+}
+
 // Read resizes the 2D image depending on the stream type.
 func (rs *resizeSource) Read(ctx context.Context) (image.Image, func(), error) {
 	ctx, span := trace.StartSpan(ctx, "camera::transformpipeline::resize::Read")
@@ -174,20 +190,10 @@ type cropSource struct {
 func newCropTransform(
 	ctx context.Context, source gostream.VideoSource, stream camera.ImageType, am utils.AttributeMap,
 ) (gostream.VideoSource, camera.ImageType, error) {
-	conf, err := resource.TransformAttributeMap[*cropConfig](am)
+	cropRect, err := parseCropConfig(am)
 	if err != nil {
 		return nil, camera.UnspecifiedStream, err
 	}
-	if conf.XMin < 0 || conf.YMin < 0 {
-		return nil, camera.UnspecifiedStream, errors.New("cannot set x_min or y_min to a negative number")
-	}
-	if conf.XMin >= conf.XMax {
-		return nil, camera.UnspecifiedStream, errors.New("cannot crop image to 0 width (x_min is >= x_max)")
-	}
-	if conf.YMin >= conf.YMax {
-		return nil, camera.UnspecifiedStream, errors.New("cannot crop image to 0 height (y_min is >= y_max)")
-	}
-	cropRect := image.Rect(conf.XMin, conf.YMin, conf.XMax, conf.YMax)
 
 	reader := &cropSource{gostream.NewEmbeddedVideoStream(source), stream, cropRect}
 	src, err := camera.NewVideoSourceFromReader(ctx, reader, nil, stream)
@@ -197,6 +203,24 @@ func newCropTransform(
 	return src, stream, err
 }
 
+// parseCropConfig returns the crop window of a crop transform.
+func parseCropConfig(am utils.AttributeMap) (image.Rectangle, error) {
+	conf, err := resource.TransformAttributeMap[*cropConfig](am)
+	if err != nil {
+		return image.Rectangle{}, err
+	}
+	if conf.XMin < 0 || conf.YMin < 0 {
+		return image.Rectangle{}, errors.New("cannot set x_min or y_min to a negative number")
+	}
+	if conf.XMin >= conf.XMax {
+		return image.Rectangle{}, errors.New("cannot crop image to 0 width (x_min is >= x_max)")
+	}
+	if conf.YMin >= conf.YMax {
+		return image.Rectangle{}, errors.New("cannot crop image to 0 height (y_min is >= y_max)")
+	}
+	return image.Rect(conf.XMin, conf.YMin, conf.XMax, conf.YMax), nil
+}
+
 // Read crops the 2D image depending on the crop window.
 func (cs *cropSource) Read(ctx context.Context) (image.Image, func(), error) {
 	ctx, span := trace.StartSpan(ctx, "camera::transformpipeline::crop::Read")
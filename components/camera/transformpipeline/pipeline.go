@@ -119,8 +119,21 @@ func newTransformPipeline(
 	// loop through the pipeline and create the image flow
 	pipeline := make([]gostream.VideoSource, 0, len(cfg.Pipeline))
 	lastSource := source
-	for _, tr := range cfg.Pipeline {
-		src, newStreamType, err := buildTransform(ctx, r, lastSource, streamType, tr, cfg.Source)
+	for i := 0; i < len(cfg.Pipeline); {
+		// consecutive crops, resizes and rotations are applied together in one pass
+		stages, ok, err := geometricRun(cfg.Pipeline[i:])
+		if err != nil {
+			return nil, err
+		}
+		var src gostream.VideoSource
+		var newStreamType camera.ImageType
+		if ok {
+			src, newStreamType, err = newGeometricTransform(ctx, lastSource, streamType, stages)
+			i += len(stages)
+		} else {
+			src, newStreamType, err = buildTransform(ctx, r, lastSource, streamType, cfg.Pipeline[i], cfg.Source)
+			i++
+		}
 		if err != nil {
 			return nil, err
 		}
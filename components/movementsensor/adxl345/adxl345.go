@@ -56,6 +56,7 @@ type Config struct {
 	BoardName              string          `json:"board,omitempty"`
 	SingleTap              *TapConfig      `json:"tap,omitempty"`
 	FreeFall               *FreeFallConfig `json:"free_fall,omitempty"`
+	FIFO                   *FIFOConfig     `json:"fifo,omitempty"`
 }
 
 // TapConfig is a description of the configs for tap registers.
@@ -117,13 +118,15 @@ func (freefallCfg *FreeFallConfig) validateFreeFallConfigs() error {
 // depend on.
 func (cfg *Config) Validate(path string) ([]string, error) {
 	var deps []string
+	usesInterrupts := cfg.SingleTap != nil || cfg.FreeFall != nil ||
+		(cfg.FIFO != nil && cfg.FIFO.WatermarkInterruptPin != "")
 	if cfg.BoardName == "" {
 		// The board name is only required for interrupt-related functionality.
-		if cfg.SingleTap != nil || cfg.FreeFall != nil {
+		if usesInterrupts {
 			return nil, resource.NewConfigValidationFieldRequiredError(path, "board")
 		}
 	} else {
-		if cfg.SingleTap != nil || cfg.FreeFall != nil {
+		if usesInterrupts {
 			// The board is actually used! Add it to the dependencies.
 			deps = append(deps, cfg.BoardName)
 		}
@@ -141,6 +144,11 @@ func (cfg *Config) Validate(path string) ([]string, error) {
 			return nil, err
 		}
 	}
+	if cfg.FIFO != nil {
+		if err := cfg.FIFO.validateFIFOConfigs(); err != nil {
+			return nil, err
+		}
+	}
 	return deps, nil
 }
 
@@ -172,6 +180,10 @@ type adxl345 struct {
 	linearAcceleration r3.Vector
 	err                movementsensor.LastError
 
+	// Only set when sampling through the FIFO.
+	samplePeriod time.Duration
+	samples      *movementsensor.SampleRing[r3.Vector]
+
 	workers rutils.StoppableWorkers
 }
 
@@ -220,6 +232,8 @@ func makeAdxl345(
 	} else {
 		address = defaultI2CAddress
 	}
+	// The accelerometer is polled at a high rate; keep slower devices on the bus from delaying it.
+	buses.SetI2CDevicePriority(bus, address, buses.I2CPriorityRealtime)
 
 	interruptConfigurations := getInterruptConfigurations(newConf)
 	configuredRegisterValues := getFreeFallRegisterValues(newConf.FreeFall)
@@ -260,39 +274,18 @@ func makeAdxl345(
 
 	// Now, turn on the background goroutine that constantly reads from the chip and stores data in
 	// the object we created.
-	sensor.workers = rutils.NewStoppableWorkers(func(cancelContext context.Context) {
-		// Reading data a thousand times per second is probably fast enough.
-		timer := time.NewTicker(time.Millisecond)
-		defer timer.Stop()
-
-		for {
-			select {
-			case <-cancelContext.Done():
-				return
-			default:
-			}
-			select {
-			case <-timer.C:
-				// The registers with data are 0x32 through 0x37: two bytes each for X, Y, and Z.
-				rawData, err := sensor.readBlock(cancelContext, 0x32, 6)
-				// Record the errors no matter what: if the error is nil, that's useful information
-				// that will prevent errors from being returned later.
-				sensor.err.Set(err)
-				if err != nil {
-					continue
-				}
-
-				linearAcceleration := toLinearAcceleration(rawData)
-				// Only lock the mutex to write to the shared data, so other threads can read the
-				// data as often as they want.
-				sensor.mu.Lock()
-				sensor.linearAcceleration = linearAcceleration
-				sensor.mu.Unlock()
-			case <-cancelContext.Done():
-				return
-			}
+	var fifoTicks chan board.Tick
+	if newConf.FIFO != nil {
+		if err := sensor.configureFIFO(ctx, newConf.FIFO); err != nil {
+			return nil, err
 		}
-	})
+		if newConf.FIFO.WatermarkInterruptPin != "" {
+			fifoTicks = make(chan board.Tick)
+		}
+		sensor.workers = rutils.NewStoppableWorkers(sensor.fifoWorker(newConf.FIFO.watermark(), fifoTicks))
+	} else {
+		sensor.workers = rutils.NewStoppableWorkers(sensor.pollData)
+	}
 
 	// Clear out the source register upon starting the component
 	if _, err := sensor.readByte(ctx, intSourceAddr); err != nil {
@@ -337,9 +330,61 @@ func makeAdxl345(
 		sensor.startInterruptMonitoring(ticksChan)
 	}
 
+	if fifoTicks != nil {
+		// The watermark interrupt gets its own stream so that it wakes up the FIFO worker rather
+		// than the tap and freefall counters.
+		b, err := board.FromDependencies(deps, newConf.BoardName)
+		if err != nil {
+			return nil, err
+		}
+		interrupt, err := b.DigitalInterruptByName(newConf.FIFO.WatermarkInterruptPin)
+		if err != nil {
+			return nil, err
+		}
+		err = b.StreamTicks(sensor.workers.Context(), []board.DigitalInterrupt{interrupt}, fifoTicks, nil)
+		if err != nil {
+			return nil, err
+		}
+	}
+
 	return sensor, nil
 }
 
+// pollData constantly reads the data registers and stores the result.
+func (adxl *adxl345) pollData(cancelContext context.Context) {
+	// Reading data a thousand times per second is probably fast enough.
+	timer := time.NewTicker(time.Millisecond)
+	defer timer.Stop()
+
+	for {
+		select {
+		case <-cancelContext.Done():
+			return
+		default:
+		}
+		select {
+		case <-timer.C:
+			// The registers with data are 0x32 through 0x37: two bytes each for X, Y, and Z.
+			rawData, err := adxl.readBlock(cancelContext, 0x32, 6)
+			// Record the errors no matter what: if the error is nil, that's useful information
+			// that will prevent errors from being returned later.
+			adxl.err.Set(err)
+			if err != nil {
+				continue
+			}
+
+			linearAcceleration := toLinearAcceleration(rawData)
+			// Only lock the mutex to write to the shared data, so other threads can read the
+			// data as often as they want.
+			adxl.mu.Lock()
+			adxl.linearAcceleration = linearAcceleration
+			adxl.mu.Unlock()
+		case <-cancelContext.Done():
+			return
+		}
+	}
+}
+
 func (adxl *adxl345) startInterruptMonitoring(ticksChan chan board.Tick) {
 	adxl.workers.AddWorkers(func(cancelContext context.Context) {
 		for {
@@ -379,6 +424,13 @@ func getInterruptConfigurations(cfg *Config) map[byte]byte {
 		}
 	}
 
+	if cfg.FIFO != nil && cfg.FIFO.WatermarkInterruptPin != "" {
+		intEnabled |= watermarkInterrupt
+		if cfg.FIFO.AccelerometerPin == 2 {
+			intMap |= watermarkInterrupt
+		}
+	}
+
 	return map[byte]byte{intEnableAddr: intEnabled, intMapAddr: intMap}
 }
 
@@ -4,6 +4,7 @@ package adxl345
 
 import (
 	"context"
+	"sync"
 	"testing"
 	"time"
 
@@ -391,3 +392,76 @@ func TestLinearAcceleration(t *testing.T) {
 	test.That(t, accel.Y, test.ShouldEqual, expectedAccelY)
 	test.That(t, accel.Z, test.ShouldEqual, expectedAccelZ)
 }
+
+func TestFIFO(t *testing.T) {
+	logger := logging.NewTestLogger(t)
+	cfg, deps, _ := setupDependencies(nil)
+	cfg.ConvertedAttributes.(*Config).FIFO = &FIFOConfig{SampleRateHz: 400, Watermark: 4}
+
+	var mu sync.Mutex
+	entries := 3
+	i2cHandle := &inject.I2CHandle{}
+	i2cHandle.ReadBlockDataFunc = func(ctx context.Context, register byte, numBytes uint8) ([]byte, error) {
+		mu.Lock()
+		defer mu.Unlock()
+		switch register {
+		case deviceIDRegister:
+			return []byte{expectedDeviceID}, nil
+		case fifoStatusAddr:
+			return []byte{byte(entries)}, nil
+		case dataAddr:
+			// Each entry reports how many entries were left in the X axis.
+			if entries == 0 {
+				return nil, errors.New("read from an empty FIFO")
+			}
+			entries--
+			return []byte{byte(entries), 0, 0, 0, 0, 0}, nil
+		default:
+			return []byte{0}, nil
+		}
+	}
+	i2cHandle.WriteByteDataFunc = func(ctx context.Context, register, data byte) error { return nil }
+	i2cHandle.CloseFunc = func() error { return nil }
+	i2c := &inject.I2C{}
+	i2c.OpenHandleFunc = func(addr byte) (buses.I2CHandle, error) {
+		return i2cHandle, nil
+	}
+
+	sensor, err := makeAdxl345(context.Background(), deps, cfg, logger, i2c)
+	test.That(t, err, test.ShouldBeNil)
+	defer sensor.Close(context.Background())
+
+	var samples []interface{}
+	testutils.WaitForAssertion(t, func(tb testing.TB) {
+		tb.Helper()
+		resp, err := sensor.DoCommand(context.Background(), map[string]interface{}{"get_samples": true})
+		test.That(tb, err, test.ShouldBeNil)
+		samples = resp["samples"].([]interface{})
+		test.That(tb, len(samples), test.ShouldEqual, 3)
+	})
+
+	// The samples are returned oldest first, spaced out at the sample rate.
+	var lastTime time.Time
+	for i, sample := range samples {
+		fields := sample.(map[string]interface{})
+		accel := fields["linear_acceleration"].(map[string]interface{})
+		test.That(t, accel["x"], test.ShouldEqual, setScale(2-i, 2.0*9.81))
+		sampleTime, err := movementsensor.ParseUnixNanos(fields, "time_unix_nanos")
+		test.That(t, err, test.ShouldBeNil)
+		if i > 0 {
+			test.That(t, sampleTime.Sub(lastTime), test.ShouldEqual, 2500*time.Microsecond)
+		}
+		lastTime = sampleTime
+	}
+
+	linearAcceleration, err := sensor.LinearAcceleration(context.Background(), nil)
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, linearAcceleration.X, test.ShouldEqual, 0)
+
+	resp, err := sensor.DoCommand(context.Background(), map[string]interface{}{
+		"get_samples":      true,
+		"since_unix_nanos": movementsensor.FormatUnixNanos(lastTime),
+	})
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, resp["samples"], test.ShouldBeEmpty)
+}
@@ -0,0 +1,212 @@
+//go:build linux
+
+package adxl345
+
+import (
+	"context"
+	"fmt"
+	"time"
+
+	"github.com/golang/geo/r3"
+	"github.com/pkg/errors"
+
+	"go.viam.com/rdk/components/board"
+	"go.viam.com/rdk/components/movementsensor"
+	"go.viam.com/rdk/resource"
+)
+
+// addresses relevant to the FIFO.
+const (
+	// the output data rate, in the lowest 4 bits.
+	bwRateAddr byte = 0x2C
+	// the FIFO mode in bits 7:6, and the number of entries that trigger the watermark interrupt in
+	// bits 4:0.
+	fifoCtlAddr byte = 0x38
+	// the number of entries in the FIFO, in bits 5:0.
+	fifoStatusAddr byte = 0x39
+	// the first of the six data registers. Reading all six pops one entry off of the FIFO.
+	dataAddr byte = 0x32
+)
+
+const (
+	// In stream mode, the FIFO holds the 32 most recent samples.
+	fifoStreamMode     byte = 0x80
+	fifoEntriesMask    byte = 0x3F
+	watermarkInterrupt byte = 1 << 1
+	maxFIFOEntries          = 32
+
+	defaultFIFOSampleRateHz = 800
+	defaultFIFOWatermark    = 16
+	defaultFIFOBufferSize   = 1000
+)
+
+// bwRateCodes maps the supported output data rates to their BW_RATE codes.
+var bwRateCodes = map[int]byte{
+	100:  0x0A,
+	200:  0x0B,
+	400:  0x0C,
+	800:  0x0D,
+	1600: 0x0E,
+	3200: 0x0F,
+}
+
+// FIFOConfig enables sampling through the chip's FIFO. The chip takes samples at SampleRateHz,
+// and they are read out in bursts once Watermark samples have accumulated. If a board and
+// WatermarkInterruptPin are configured, the chip's watermark interrupt paces the reads instead of
+// a timer. The most recent BufferSize samples are kept with the time they were taken.
+type FIFOConfig struct {
+	SampleRateHz          int    `json:"sample_rate_hz,omitempty"`
+	Watermark             int    `json:"watermark,omitempty"`
+	AccelerometerPin      int    `json:"accelerometer_pin,omitempty"`
+	WatermarkInterruptPin string `json:"watermark_interrupt_pin,omitempty"`
+	BufferSize            int    `json:"buffer_size,omitempty"`
+}
+
+func (fifoCfg *FIFOConfig) validateFIFOConfigs() error {
+	if _, ok := bwRateCodes[fifoCfg.SampleRateHz]; fifoCfg.SampleRateHz != 0 && !ok {
+		return errors.New("FIFO sample rate on the ADXL345 must be one of 100, 200, 400, 800, 1600, or 3200Hz")
+	}
+	if fifoCfg.Watermark < 0 || fifoCfg.Watermark >= maxFIFOEntries {
+		return fmt.Errorf("FIFO watermark on the ADXL345 must be between 1 and %d samples", maxFIFOEntries-1)
+	}
+	if fifoCfg.WatermarkInterruptPin != "" && fifoCfg.AccelerometerPin != 1 && fifoCfg.AccelerometerPin != 2 {
+		return errors.New("Accelerometer pin on the ADXL345 must be 1 or 2")
+	}
+	if fifoCfg.BufferSize < 0 {
+		return errors.New("FIFO buffer size on the ADXL345 cannot be negative")
+	}
+	return nil
+}
+
+func (fifoCfg *FIFOConfig) sampleRateHz() int {
+	if fifoCfg.SampleRateHz == 0 {
+		return defaultFIFOSampleRateHz
+	}
+	return fifoCfg.SampleRateHz
+}
+
+func (fifoCfg *FIFOConfig) watermark() int {
+	if fifoCfg.Watermark == 0 {
+		return defaultFIFOWatermark
+	}
+	return fifoCfg.Watermark
+}
+
+func (fifoCfg *FIFOConfig) bufferSize() int {
+	if fifoCfg.BufferSize == 0 {
+		return defaultFIFOBufferSize
+	}
+	return fifoCfg.BufferSize
+}
+
+// configureFIFO sets the output data rate and puts the FIFO in stream mode.
+func (adxl *adxl345) configureFIFO(ctx context.Context, fifoCfg *FIFOConfig) error {
+	adxl.samplePeriod = time.Second / time.Duration(fifoCfg.sampleRateHz())
+	adxl.samples = movementsensor.NewSampleRing[r3.Vector](fifoCfg.bufferSize())
+
+	if err := adxl.writeByte(ctx, bwRateAddr, bwRateCodes[fifoCfg.sampleRateHz()]); err != nil {
+		return errors.Wrap(err, "unable to set ADXL345 data rate")
+	}
+	if err := adxl.writeByte(ctx, fifoCtlAddr, fifoStreamMode|byte(fifoCfg.watermark())); err != nil {
+		return errors.Wrap(err, "unable to enable ADXL345 FIFO")
+	}
+	return nil
+}
+
+// fifoWorker drains the FIFO whenever `watermark` samples should have accumulated, or when the
+// watermark interrupt fires. The timer keeps running with an interrupt, at a longer period, so a
+// missed interrupt does not let the FIFO overrun.
+func (adxl *adxl345) fifoWorker(watermark int, ticks chan board.Tick) func(context.Context) {
+	return func(cancelContext context.Context) {
+		period := adxl.samplePeriod * time.Duration(watermark)
+		if ticks != nil {
+			period *= 4
+		}
+		timer := time.NewTicker(period)
+		defer timer.Stop()
+
+		for {
+			select {
+			case <-cancelContext.Done():
+				return
+			case tick := <-ticks:
+				if !tick.High {
+					continue
+				}
+			case <-timer.C:
+			}
+
+			err := adxl.drainFIFO(cancelContext, time.Now())
+			// Record the errors no matter what: if the error is nil, that's useful information
+			// that will prevent errors from being returned later.
+			adxl.err.Set(err)
+		}
+	}
+}
+
+// drainFIFO reads every entry out of the FIFO. The newest entry is taken to have been sampled at
+// `newest`, and the ones before it at the sample period. Unlike the data registers of most chips,
+// the ADXL345 only pops one entry per read of the data registers, so each entry is its own
+// transaction.
+func (adxl *adxl345) drainFIFO(ctx context.Context, newest time.Time) error {
+	status, err := adxl.readByte(ctx, fifoStatusAddr)
+	if err != nil {
+		return err
+	}
+	entries := int(status & fifoEntriesMask)
+	if entries == 0 {
+		return nil
+	}
+
+	samples := make([]movementsensor.TimedSample[r3.Vector], entries)
+	for i := range samples {
+		rawData, err := adxl.readBlock(ctx, dataAddr, 6)
+		if err != nil {
+			return err
+		}
+		samples[i] = movementsensor.TimedSample[r3.Vector]{
+			Time:  newest.Add(-time.Duration(entries-1-i) * adxl.samplePeriod),
+			Value: toLinearAcceleration(rawData),
+		}
+	}
+	adxl.samples.Push(samples...)
+
+	adxl.mu.Lock()
+	adxl.linearAcceleration = samples[len(samples)-1].Value
+	adxl.mu.Unlock()
+	return nil
+}
+
+// samplesCommand returns the samples taken after `since_unix_nanos`, oldest first. Timestamps are
+// decimal strings such that the last one can be passed back as `since_unix_nanos` exactly.
+func (adxl *adxl345) samplesCommand(cmd map[string]interface{}) (map[string]interface{}, error) {
+	if adxl.samples == nil {
+		return nil, errors.New("samples are only available with fifo configured")
+	}
+	since, err := movementsensor.ParseUnixNanos(cmd, "since_unix_nanos")
+	if err != nil {
+		return nil, err
+	}
+
+	samples := []interface{}{}
+	for _, sample := range adxl.samples.Since(since) {
+		samples = append(samples, map[string]interface{}{
+			"time_unix_nanos": movementsensor.FormatUnixNanos(sample.Time),
+			"linear_acceleration": map[string]interface{}{
+				"x": sample.Value.X,
+				"y": sample.Value.Y,
+				"z": sample.Value.Z,
+			},
+		})
+	}
+	return map[string]interface{}{"samples": samples}, nil
+}
+
+// DoCommand supports "get_samples", which returns the buffered FIFO samples taken after
+// "since_unix_nanos".
+func (adxl *adxl345) DoCommand(ctx context.Context, cmd map[string]interface{}) (map[string]interface{}, error) {
+	if _, ok := cmd["get_samples"]; ok {
+		return adxl.samplesCommand(cmd)
+	}
+	return nil, resource.ErrDoUnimplemented
+}
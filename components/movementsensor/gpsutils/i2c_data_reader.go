@@ -51,6 +51,10 @@ func NewI2cDataReader(config I2CConfig, bus buses.I2C, logger logging.Logger) (D
 		logger.Warn("using default baudrate: 38400")
 	}
 
+	// The reader polls the device continuously, but NMEA data is not latency sensitive. Let other
+	// devices on the bus go first.
+	buses.SetI2CDevicePriority(bus, byte(addr), buses.I2CPriorityBackground)
+
 	data := make(chan string)
 	cancelCtx, cancelFunc := context.WithCancel(context.Background())
 
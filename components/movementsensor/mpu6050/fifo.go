@@ -0,0 +1,257 @@
+//go:build linux
+
+package mpu6050
+
+import (
+	"context"
+	"fmt"
+	"time"
+
+	"github.com/golang/geo/r3"
+	"github.com/pkg/errors"
+
+	"go.viam.com/rdk/components/board"
+	"go.viam.com/rdk/components/movementsensor"
+	"go.viam.com/rdk/resource"
+	"go.viam.com/rdk/spatialmath"
+)
+
+const (
+	sampleRateDividerRegister = 25
+	configRegister            = 26
+	fifoEnableRegister        = 35
+	interruptEnableRegister   = 56
+	temperatureRegister       = 65
+	userControlRegister       = 106
+	fifoCountRegister         = 114
+	fifoReadWriteRegister     = 116
+
+	// Write the accelerometer and all three gyroscope axes to the FIFO, in that order.
+	fifoEnableAccelAndGyro = 0x78
+	userControlFIFOEnable  = 1 << 6
+	userControlFIFOReset   = 1 << 2
+	dataReadyInterrupt     = 1 << 0
+	// Enables the digital low pass filter, which sets the gyroscope output rate to 1kHz.
+	lowPassFilter184Hz = 1
+
+	gyroscopeOutputRateHz = 1000
+	fifoSize              = 1024
+	fifoFrameSize         = 12
+	// The largest number of whole frames that fit in a single block read.
+	maxFramesPerRead = 255 / fifoFrameSize
+
+	defaultFIFOSampleRateHz = 1000
+	defaultFIFOWatermark    = 20
+	defaultFIFOBufferSize   = 1000
+)
+
+// FIFOConfig enables sampling through the chip's FIFO. The chip takes samples at SampleRateHz,
+// and they are read out in bursts once Watermark samples have accumulated. If a board and
+// DataReadyInterruptPin are configured, the chip's data ready interrupt paces the reads instead of
+// a timer. The most recent BufferSize samples are kept with the time they were taken.
+type FIFOConfig struct {
+	SampleRateHz          int    `json:"sample_rate_hz,omitempty"`
+	Watermark             int    `json:"watermark,omitempty"`
+	DataReadyInterruptPin string `json:"data_ready_interrupt_pin,omitempty"`
+	BufferSize            int    `json:"buffer_size,omitempty"`
+}
+
+func (cfg *FIFOConfig) validate(path string) error {
+	if cfg.SampleRateHz != 0 && (cfg.SampleRateHz < 4 || cfg.SampleRateHz > gyroscopeOutputRateHz) {
+		return resource.NewConfigValidationError(path,
+			fmt.Errorf("fifo sample_rate_hz must be between 4 and %d", gyroscopeOutputRateHz))
+	}
+	if cfg.Watermark < 0 || cfg.Watermark*fifoFrameSize >= fifoSize {
+		return resource.NewConfigValidationError(path,
+			fmt.Errorf("fifo watermark must be between 1 and %d samples", fifoSize/fifoFrameSize-1))
+	}
+	if cfg.BufferSize < 0 {
+		return resource.NewConfigValidationError(path, errors.New("fifo buffer_size cannot be negative"))
+	}
+	return nil
+}
+
+func (cfg *FIFOConfig) sampleRateHz() int {
+	if cfg.SampleRateHz == 0 {
+		return defaultFIFOSampleRateHz
+	}
+	return cfg.SampleRateHz
+}
+
+func (cfg *FIFOConfig) watermark() int {
+	if cfg.Watermark == 0 {
+		return defaultFIFOWatermark
+	}
+	return cfg.Watermark
+}
+
+func (cfg *FIFOConfig) bufferSize() int {
+	if cfg.BufferSize == 0 {
+		return defaultFIFOBufferSize
+	}
+	return cfg.BufferSize
+}
+
+// imuSample is a single FIFO frame.
+type imuSample struct {
+	linearAcceleration r3.Vector
+	angularVelocity    spatialmath.AngularVelocity
+}
+
+var errFIFOOverflow = errors.New("MPU6050 FIFO overflowed, samples were lost")
+
+// configureFIFO sets the sample rate and starts writing samples to the FIFO.
+func (mpu *mpu6050) configureFIFO(ctx context.Context, cfg *FIFOConfig, useInterrupt bool) error {
+	divider := gyroscopeOutputRateHz/cfg.sampleRateHz() - 1
+	mpu.samplePeriod = time.Second * time.Duration(divider+1) / gyroscopeOutputRateHz
+	mpu.samples = movementsensor.NewSampleRing[imuSample](cfg.bufferSize())
+
+	var interrupts byte
+	if useInterrupt {
+		interrupts = dataReadyInterrupt
+	}
+	for _, write := range []struct{ register, value byte }{
+		{configRegister, lowPassFilter184Hz},
+		{sampleRateDividerRegister, byte(divider)},
+		{fifoEnableRegister, fifoEnableAccelAndGyro},
+		{interruptEnableRegister, interrupts},
+		{userControlRegister, userControlFIFOEnable | userControlFIFOReset},
+	} {
+		if err := mpu.writeByte(ctx, write.register, write.value); err != nil {
+			return errors.Wrap(err, "unable to configure MPU6050 FIFO")
+		}
+	}
+	return nil
+}
+
+// fifoWorker drains the FIFO whenever `watermark` samples should have accumulated. With a data
+// ready interrupt, samples are counted as the chip announces them. Otherwise they are assumed to
+// arrive at the configured sample rate. The timer keeps running with an interrupt, at a longer
+// period, so a missed interrupt does not let the FIFO overflow.
+func (mpu *mpu6050) fifoWorker(watermark int, ticks chan board.Tick) func(context.Context) {
+	return func(cancelCtx context.Context) {
+		period := mpu.samplePeriod * time.Duration(watermark)
+		if ticks != nil {
+			period *= 4
+		}
+		timer := time.NewTicker(period)
+		defer timer.Stop()
+
+		samplesAnnounced := 0
+		for {
+			select {
+			case <-cancelCtx.Done():
+				return
+			case tick := <-ticks:
+				if !tick.High {
+					continue
+				}
+				samplesAnnounced++
+				if samplesAnnounced < watermark {
+					continue
+				}
+			case <-timer.C:
+			}
+			samplesAnnounced = 0
+
+			err := mpu.drainFIFO(cancelCtx, time.Now())
+			// Record `err` no matter what: even if it's nil, that's useful information.
+			mpu.err.Set(err)
+			if err != nil {
+				mpu.logger.CErrorf(cancelCtx, "error reading MPU6050 FIFO: '%s'", err)
+			}
+		}
+	}
+}
+
+// drainFIFO reads every whole sample out of the FIFO. The newest sample is taken to have been
+// sampled at `newest`, and the ones before it at the sample period.
+func (mpu *mpu6050) drainFIFO(ctx context.Context, newest time.Time) error {
+	countData, err := mpu.readBlock(ctx, fifoCountRegister, 2)
+	if err != nil {
+		return err
+	}
+	count := int(countData[0])<<8 | int(countData[1])
+	if count >= fifoSize {
+		// The FIFO is full and has been dropping samples, so we can't tell which ones remain.
+		// Start over.
+		if err := mpu.writeByte(ctx, userControlRegister, userControlFIFOEnable|userControlFIFOReset); err != nil {
+			return err
+		}
+		return errFIFOOverflow
+	}
+
+	frames := count / fifoFrameSize
+	if frames == 0 {
+		return nil
+	}
+	data := make([]byte, 0, frames*fifoFrameSize)
+	for remaining := frames; remaining > 0; {
+		burst := remaining
+		if burst > maxFramesPerRead {
+			burst = maxFramesPerRead
+		}
+		block, err := mpu.readBlock(ctx, fifoReadWriteRegister, uint8(burst*fifoFrameSize))
+		if err != nil {
+			return err
+		}
+		data = append(data, block...)
+		remaining -= burst
+	}
+
+	temperatureData, err := mpu.readBlock(ctx, temperatureRegister, 2)
+	if err != nil {
+		return err
+	}
+
+	samples := make([]movementsensor.TimedSample[imuSample], frames)
+	for i := range samples {
+		frame := data[i*fifoFrameSize : (i+1)*fifoFrameSize]
+		samples[i] = movementsensor.TimedSample[imuSample]{
+			Time: newest.Add(-time.Duration(frames-1-i) * mpu.samplePeriod),
+			Value: imuSample{
+				linearAcceleration: toLinearAcceleration(frame[0:6]),
+				angularVelocity:    toAngularVelocity(frame[6:12]),
+			},
+		}
+	}
+	mpu.samples.Push(samples...)
+
+	latest := samples[len(samples)-1].Value
+	mpu.mu.Lock()
+	mpu.linearAcceleration = latest.linearAcceleration
+	mpu.angularVelocity = latest.angularVelocity
+	mpu.temperature = toTemperature(temperatureData)
+	mpu.mu.Unlock()
+	return nil
+}
+
+// samplesCommand returns the samples taken after `since_unix_nanos`, oldest first. Timestamps are
+// decimal strings such that the last one can be passed back as `since_unix_nanos` exactly.
+func (mpu *mpu6050) samplesCommand(cmd map[string]interface{}) (map[string]interface{}, error) {
+	if mpu.samples == nil {
+		return nil, errors.New("samples are only available with fifo configured")
+	}
+	since, err := movementsensor.ParseUnixNanos(cmd, "since_unix_nanos")
+	if err != nil {
+		return nil, err
+	}
+
+	samples := []interface{}{}
+	for _, sample := range mpu.samples.Since(since) {
+		samples = append(samples, map[string]interface{}{
+			"time_unix_nanos": movementsensor.FormatUnixNanos(sample.Time),
+			"linear_acceleration": map[string]interface{}{
+				"x": sample.Value.linearAcceleration.X,
+				"y": sample.Value.linearAcceleration.Y,
+				"z": sample.Value.linearAcceleration.Z,
+			},
+			"angular_velocity": map[string]interface{}{
+				"x": sample.Value.angularVelocity.X,
+				"y": sample.Value.angularVelocity.Y,
+				"z": sample.Value.angularVelocity.Z,
+			},
+		})
+	}
+	return map[string]interface{}{"samples": samples}, nil
+}
@@ -6,10 +6,11 @@
 // description of the I2C registers is at
 // https://download.datasheets.com/pdfs/2015/3/19/8/3/59/59/invse_/manual/5rm-mpu-6000a-00v4.2.pdf
 //
-// We support reading the accelerometer, gyroscope, and thermometer data off of the chip. We do not
-// yet support using the digital interrupt pin to notify on events (freefall, collision, etc.),
-// nor do we yet support using the secondary I2C connection to add an external clock or
-// magnetometer.
+// We support reading the accelerometer, gyroscope, and thermometer data off of the chip, either by
+// polling the data registers or, if "fifo" is configured, in bursts through the chip's FIFO. The
+// digital interrupt pin can be used to pace FIFO reads with the data ready interrupt. We do not
+// yet support using it to notify on events (freefall, collision, etc.), nor do we yet support
+// using the secondary I2C connection to add an external clock or magnetometer.
 //
 // The chip has two possible I2C addresses, which can be selected by wiring the AD0 pin to either
 // hot or ground:
@@ -30,6 +31,7 @@ import (
 	geo "github.com/kellydunn/golang-geo"
 	"github.com/pkg/errors"
 
+	"go.viam.com/rdk/components/board"
 	"go.viam.com/rdk/components/board/genericlinux/buses"
 	"go.viam.com/rdk/components/movementsensor"
 	"go.viam.com/rdk/logging"
@@ -48,8 +50,10 @@ const (
 
 // Config is used to configure the attributes of the chip.
 type Config struct {
-	I2cBus                 string `json:"i2c_bus"`
-	UseAlternateI2CAddress bool   `json:"use_alt_i2c_address,omitempty"`
+	I2cBus                 string      `json:"i2c_bus"`
+	UseAlternateI2CAddress bool        `json:"use_alt_i2c_address,omitempty"`
+	BoardName              string      `json:"board,omitempty"`
+	FIFO                   *FIFOConfig `json:"fifo,omitempty"`
 }
 
 // Validate ensures all parts of the config are valid, and then returns the list of things we
@@ -60,6 +64,18 @@ func (conf *Config) Validate(path string) ([]string, error) {
 	}
 
 	var deps []string
+	if conf.FIFO != nil {
+		if err := conf.FIFO.validate(path); err != nil {
+			return nil, err
+		}
+		if conf.FIFO.DataReadyInterruptPin != "" {
+			// The board is only needed to watch the data ready interrupt.
+			if conf.BoardName == "" {
+				return nil, resource.NewConfigValidationFieldRequiredError(path, "board")
+			}
+			deps = append(deps, conf.BoardName)
+		}
+	}
 	return deps, nil
 }
 
@@ -83,6 +99,10 @@ type mpu6050 struct {
 	// Stores the most recent error from the background goroutine
 	err movementsensor.LastError
 
+	// Only set when sampling through the FIFO.
+	samplePeriod time.Duration
+	samples      *movementsensor.SampleRing[imuSample]
+
 	workers utils.StoppableWorkers
 	logger  logging.Logger
 }
@@ -119,7 +139,7 @@ func newMpu6050(
 // This function is separated from NewMpu6050 solely so you can inject a mock I2C bus in tests.
 func makeMpu6050(
 	ctx context.Context,
-	_ resource.Dependencies,
+	deps resource.Dependencies,
 	conf resource.Config,
 	logger logging.Logger,
 	bus buses.I2C,
@@ -136,6 +156,8 @@ func makeMpu6050(
 		address = expectedDefaultAddress
 	}
 	logger.CDebugf(ctx, "Using address %d for MPU6050 sensor", address)
+	// The IMU is polled at a high rate; keep slower devices on the bus from delaying it.
+	buses.SetI2CDevicePriority(bus, address, buses.I2CPriorityRealtime)
 
 	sensor := &mpu6050{
 		Named:      conf.ResourceName().AsNamed(),
@@ -165,6 +187,13 @@ func makeMpu6050(
 		return nil, errors.Errorf("Unable to wake up MPU6050: '%s'", err.Error())
 	}
 
+	if newConf.FIFO != nil {
+		if err := sensor.startFIFO(ctx, deps, newConf); err != nil {
+			return nil, err
+		}
+		return sensor, nil
+	}
+
 	// Now, turn on the background goroutine that constantly reads from the chip and stores data in
 	// the object we created.
 	sensor.workers = utils.NewStoppableWorkers(func(cancelCtx context.Context) {
@@ -184,8 +213,7 @@ func makeMpu6050(
 				}
 
 				linearAcceleration := toLinearAcceleration(rawData[0:6])
-				// Taken straight from the MPU6050 register map. Yes, these are weird constants.
-				temperature := float64(utils.Int16FromBytesBE(rawData[6:8]))/340.0 + 36.53
+				temperature := toTemperature(rawData[6:8])
 				angularVelocity := toAngularVelocity(rawData[8:14])
 
 				// Lock the mutex before modifying the state within the object. By keeping the mutex
@@ -244,6 +272,39 @@ func (mpu *mpu6050) writeByte(ctx context.Context, register, value byte) error {
 	return handle.WriteByteData(ctx, register, value)
 }
 
+// startFIFO configures the FIFO and starts the background goroutine that drains it.
+func (mpu *mpu6050) startFIFO(ctx context.Context, deps resource.Dependencies, conf *Config) error {
+	var ticks chan board.Tick
+	var interrupt board.DigitalInterrupt
+	var b board.Board
+	if conf.FIFO.DataReadyInterruptPin != "" {
+		var err error
+		b, err = board.FromDependencies(deps, conf.BoardName)
+		if err != nil {
+			return err
+		}
+		interrupt, err = b.DigitalInterruptByName(conf.FIFO.DataReadyInterruptPin)
+		if err != nil {
+			return err
+		}
+		ticks = make(chan board.Tick)
+	}
+
+	if err := mpu.configureFIFO(ctx, conf.FIFO, ticks != nil); err != nil {
+		return err
+	}
+
+	mpu.workers = utils.NewStoppableWorkers(mpu.fifoWorker(conf.FIFO.watermark(), ticks))
+	if ticks != nil {
+		err := b.StreamTicks(mpu.workers.Context(), []board.DigitalInterrupt{interrupt}, ticks, nil)
+		if err != nil {
+			mpu.workers.Stop()
+			return err
+		}
+	}
+	return nil
+}
+
 // Given a value, scales it so that the range of int16s becomes the range of +/- maxValue.
 func setScale(value int, maxValue float64) float64 {
 	return float64(value) * maxValue / (1 << 15)
@@ -279,6 +340,12 @@ func toLinearAcceleration(data []byte) r3.Vector {
 	}
 }
 
+// Takes 2 bytes and gives back the temperature in degrees Celsius.
+func toTemperature(data []byte) float64 {
+	// Taken straight from the MPU6050 register map. Yes, these are weird constants.
+	return float64(utils.Int16FromBytesBE(data))/340.0 + 36.53
+}
+
 func (mpu *mpu6050) AngularVelocity(ctx context.Context, extra map[string]interface{}) (spatialmath.AngularVelocity, error) {
 	mpu.mu.Lock()
 	defer mpu.mu.Unlock()
@@ -335,6 +402,15 @@ func (mpu *mpu6050) Properties(ctx context.Context, extra map[string]interface{}
 	}, nil
 }
 
+// DoCommand supports "get_samples", which returns the buffered FIFO samples taken after
+// "since_unix_nanos".
+func (mpu *mpu6050) DoCommand(ctx context.Context, cmd map[string]interface{}) (map[string]interface{}, error) {
+	if _, ok := cmd["get_samples"]; ok {
+		return mpu.samplesCommand(cmd)
+	}
+	return nil, resource.ErrDoUnimplemented
+}
+
 func (mpu *mpu6050) Close(ctx context.Context) error {
 	mpu.workers.Stop()
 
@@ -5,6 +5,7 @@ package mpu6050
 import (
 	"context"
 	"testing"
+	"time"
 
 	"github.com/pkg/errors"
 	"go.viam.com/test"
@@ -261,3 +262,65 @@ func TestTemperature(t *testing.T) {
 	test.That(t, err, test.ShouldBeNil)
 	test.That(t, readings["temperature_celsius"], test.ShouldAlmostEqual, expectedTemp, 0.001)
 }
+
+func TestDrainFIFO(t *testing.T) {
+	logger := logging.NewTestLogger(t)
+	frames := make([]byte, 3*fifoFrameSize)
+	for i := 0; i < 3; i++ {
+		// Each frame reports i in the X axis of both the accelerometer and the gyroscope.
+		frames[i*fifoFrameSize+1] = byte(i)
+		frames[i*fifoFrameSize+7] = byte(i)
+	}
+	fifoCount := []byte{0, byte(len(frames))}
+
+	var writes [][2]byte
+	i2cHandle := &inject.I2CHandle{}
+	i2cHandle.ReadBlockDataFunc = func(ctx context.Context, register byte, numBytes uint8) ([]byte, error) {
+		switch register {
+		case fifoCountRegister:
+			return fifoCount, nil
+		case fifoReadWriteRegister:
+			test.That(t, int(numBytes), test.ShouldEqual, len(frames))
+			return frames, nil
+		case temperatureRegister:
+			return []byte{231, 202}, nil
+		default:
+			return nil, errors.Errorf("unexpected read of register %d", register)
+		}
+	}
+	i2cHandle.WriteByteDataFunc = func(ctx context.Context, register, data byte) error {
+		writes = append(writes, [2]byte{register, data})
+		return nil
+	}
+	i2cHandle.CloseFunc = func() error { return nil }
+	i2c := &inject.I2C{}
+	i2c.OpenHandleFunc = func(addr byte) (buses.I2CHandle, error) {
+		return i2cHandle, nil
+	}
+
+	sensor := &mpu6050{bus: i2c, i2cAddress: expectedDefaultAddress, logger: logger}
+	err := sensor.configureFIFO(context.Background(), &FIFOConfig{SampleRateHz: 500}, false)
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, sensor.samplePeriod, test.ShouldEqual, 2*time.Millisecond)
+	test.That(t, writes[1], test.ShouldResemble, [2]byte{sampleRateDividerRegister, 1})
+
+	newest := time.Unix(100, 0)
+	test.That(t, sensor.drainFIFO(context.Background(), newest), test.ShouldBeNil)
+
+	samples := sensor.samples.Since(time.Time{})
+	test.That(t, len(samples), test.ShouldEqual, 3)
+	for i, sample := range samples {
+		test.That(t, sample.Time, test.ShouldEqual, newest.Add(-time.Duration(2-i)*2*time.Millisecond))
+		test.That(t, sample.Value.linearAcceleration.X, test.ShouldEqual, setScale(i, 2.0*9.81))
+		test.That(t, sample.Value.angularVelocity.X, test.ShouldEqual, setScale(i, 250.0))
+	}
+	test.That(t, sensor.linearAcceleration, test.ShouldResemble, samples[2].Value.linearAcceleration)
+	test.That(t, sensor.temperature, test.ShouldAlmostEqual, 18.3, 0.001)
+
+	// An overflowed FIFO is reset rather than read.
+	fifoCount = []byte{fifoSize >> 8, 0}
+	writes = nil
+	test.That(t, sensor.drainFIFO(context.Background(), newest), test.ShouldBeError, errFIFOOverflow)
+	test.That(t, writes, test.ShouldResemble, [][2]byte{{userControlRegister, userControlFIFOEnable | userControlFIFOReset}})
+	test.That(t, len(sensor.samples.Since(time.Time{})), test.ShouldEqual, 3)
+}
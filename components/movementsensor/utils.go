@@ -2,8 +2,11 @@ package movementsensor
 
 import (
 	"errors"
+	"fmt"
 	"math"
+	"strconv"
 	"sync"
+	"time"
 
 	geo "github.com/kellydunn/golang-geo"
 )
@@ -164,6 +167,91 @@ func (lch *LastCompassHeading) SetLastCompassHeading(compassheading float64) {
 	lch.lastcompassheading = compassheading
 }
 
+// TimedSample is a reading along with the time the sensor took it.
+type TimedSample[T any] struct {
+	Time  time.Time
+	Value T
+}
+
+// SampleRing stores the most recent samples of a sensor that produces readings faster than they
+// are asked for, such that callers can consume every sample rather than only the latest one.
+type SampleRing[T any] struct {
+	mu      sync.Mutex
+	samples []TimedSample[T]
+	next    int // Index the next sample is written to
+	count   int // How many entries of samples are filled in
+}
+
+// NewSampleRing creates a SampleRing that holds up to `size` samples.
+func NewSampleRing[T any](size int) *SampleRing[T] {
+	if size < 1 {
+		size = 1
+	}
+	return &SampleRing[T]{samples: make([]TimedSample[T], size)}
+}
+
+// Push adds samples, oldest first, evicting the oldest stored samples once the ring is full.
+func (sr *SampleRing[T]) Push(samples ...TimedSample[T]) {
+	sr.mu.Lock()
+	defer sr.mu.Unlock()
+	for _, sample := range samples {
+		sr.samples[sr.next] = sample
+		sr.next = (sr.next + 1) % len(sr.samples)
+		if sr.count < len(sr.samples) {
+			sr.count++
+		}
+	}
+}
+
+// Latest returns the most recent sample, and false if there are none.
+func (sr *SampleRing[T]) Latest() (TimedSample[T], bool) {
+	sr.mu.Lock()
+	defer sr.mu.Unlock()
+	if sr.count == 0 {
+		return TimedSample[T]{}, false
+	}
+	return sr.samples[(sr.next-1+len(sr.samples))%len(sr.samples)], true
+}
+
+// Since returns the stored samples taken strictly after `after`, oldest first.
+func (sr *SampleRing[T]) Since(after time.Time) []TimedSample[T] {
+	sr.mu.Lock()
+	defer sr.mu.Unlock()
+	var ret []TimedSample[T]
+	for i := 0; i < sr.count; i++ {
+		sample := sr.samples[(sr.next-sr.count+i+len(sr.samples))%len(sr.samples)]
+		if sample.Time.After(after) {
+			ret = append(ret, sample)
+		}
+	}
+	return ret
+}
+
+// FormatUnixNanos encodes `t` as a decimal string of nanoseconds since the epoch. Numbers in
+// DoCommand results are float64s, which cannot hold current nanosecond timestamps exactly, so
+// timestamps that callers pass back to page through samples are sent as strings.
+func FormatUnixNanos(t time.Time) string {
+	return strconv.FormatInt(t.UnixNano(), 10)
+}
+
+// ParseUnixNanos returns the time encoded by FormatUnixNanos under `key` in `cmd`. The zero time is
+// returned if `cmd` has no such key.
+func ParseUnixNanos(cmd map[string]interface{}, key string) (time.Time, error) {
+	raw, ok := cmd[key]
+	if !ok {
+		return time.Time{}, nil
+	}
+	str, ok := raw.(string)
+	if !ok {
+		return time.Time{}, fmt.Errorf("%s must be a string of nanoseconds since the epoch, got %T", key, raw)
+	}
+	nanos, err := strconv.ParseInt(str, 10, 64)
+	if err != nil {
+		return time.Time{}, fmt.Errorf("invalid %s: %w", key, err)
+	}
+	return time.Unix(0, nanos), nil
+}
+
 // PMTKAddChk adds PMTK checksums to commands by XORing the bytes together.
 func PMTKAddChk(data []byte) []byte {
 	chk := PMTKChecksum(data)
@@ -4,6 +4,7 @@ import (
 	"errors"
 	"math"
 	"testing"
+	"time"
 
 	geo "github.com/kellydunn/golang-geo"
 	"go.viam.com/test"
@@ -102,3 +103,44 @@ func TestPMTKFunctions(t *testing.T) {
 	test.That(t, PMTKChecksum(testValue), test.ShouldEqual, expectedChecksum)
 	test.That(t, PMTKAddChk(testValue), test.ShouldResemble, expectedValue)
 }
+
+func TestSampleRing(t *testing.T) {
+	ring := NewSampleRing[int](3)
+	_, ok := ring.Latest()
+	test.That(t, ok, test.ShouldBeFalse)
+
+	start := time.Now()
+	for i := 0; i < 5; i++ {
+		ring.Push(TimedSample[int]{Time: start.Add(time.Duration(i) * time.Millisecond), Value: i})
+	}
+
+	latest, ok := ring.Latest()
+	test.That(t, ok, test.ShouldBeTrue)
+	test.That(t, latest.Value, test.ShouldEqual, 4)
+
+	// Only the last 3 samples are kept.
+	values := []int{}
+	for _, sample := range ring.Since(start) {
+		values = append(values, sample.Value)
+	}
+	test.That(t, values, test.ShouldResemble, []int{2, 3, 4})
+	test.That(t, len(ring.Since(start.Add(3*time.Millisecond))), test.ShouldEqual, 1)
+}
+
+func TestUnixNanos(t *testing.T) {
+	// A current timestamp that a float64 cannot represent exactly.
+	sampleTime := time.Unix(1700000000, 123456789)
+	cmd := map[string]interface{}{"since_unix_nanos": FormatUnixNanos(sampleTime)}
+	test.That(t, cmd["since_unix_nanos"], test.ShouldEqual, "1700000000123456789")
+
+	parsed, err := ParseUnixNanos(cmd, "since_unix_nanos")
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, parsed.Equal(sampleTime), test.ShouldBeTrue)
+
+	parsed, err = ParseUnixNanos(map[string]interface{}{}, "since_unix_nanos")
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, parsed.IsZero(), test.ShouldBeTrue)
+
+	_, err = ParseUnixNanos(map[string]interface{}{"since_unix_nanos": 1.7e18}, "since_unix_nanos")
+	test.That(t, err, test.ShouldNotBeNil)
+}
@@ -37,6 +37,10 @@ const (
 	resetShift               = "reset"
 	moveX                    = "moveX"
 	moveY                    = "moveY"
+
+	// basePropsRefreshInterval is how often trackPosition re-reads the base properties. They rarely
+	// change, so there is no need to query them on every tick.
+	basePropsRefreshInterval = 5 * time.Second
 )
 
 // Config is the config for a wheeledodometry MovementSensor.
@@ -52,12 +56,32 @@ type motorPair struct {
 	right motor.Motor
 }
 
+// timedPosition is a motor position in revolutions along with the time it was sampled at.
+type timedPosition struct {
+	revolutions float64
+	sampledAt   time.Time
+	err         error
+}
+
+// readTimedPosition reads the motor position. Motors do not report when their position was
+// sampled, so the midpoint of the request is used as the best estimate.
+func readTimedPosition(ctx context.Context, m motor.Motor) timedPosition {
+	start := time.Now()
+	revolutions, err := m.Position(ctx, nil)
+	return timedPosition{
+		revolutions: revolutions,
+		sampledAt:   start.Add(time.Since(start) / 2),
+		err:         err,
+	}
+}
+
 type odometry struct {
 	resource.Named
 	resource.AlwaysRebuild
 
 	lastLeftPos        float64
 	lastRightPos       float64
+	lastSampleTime     time.Time
 	baseWidth          float64
 	wheelCircumference float64
 	base               base.Base
@@ -350,8 +374,8 @@ func (o *odometry) checkBaseProps(ctx context.Context) {
 	if err != nil {
 		if !errors.Is(err, context.Canceled) {
 			o.logger.Error(err)
-			return
 		}
+		return
 	}
 	if (o.baseWidth != props.WidthMeters) || (o.wheelCircumference != props.WheelCircumferenceMeters) {
 		o.baseWidth = props.WidthMeters
@@ -366,10 +390,40 @@ func (o *odometry) checkBaseProps(ctx context.Context) {
 // linear velocity, and angular velocity of the wheeled base.
 // The estimations in this function are based on the math outlined in this article:
 // https://stuff.mit.edu/afs/athena/course/6/6.186/OldFiles/2005/doc/odomtutorial/odomtutorial.pdf
+// Rather than assuming the base moved along a straight line in the direction of its final heading,
+// each interval is integrated as a circular arc, and velocities use the measured time between
+// samples instead of the nominal tick interval.
 func (o *odometry) trackPosition() {
+	// Velocities are not computed across a restart of the tracking loop.
+	o.lastSampleTime = time.Time{}
+
+	// The right motor is read by a long-lived worker such that both motors are polled at the same
+	// time without starting new goroutines on every tick.
+	rightRequests := make(chan struct{})
+	rightResults := make(chan timedPosition)
+	readRight := func(ctx context.Context) {
+		for {
+			select {
+			case <-ctx.Done():
+				return
+			case <-rightRequests:
+			}
+
+			// Always use the first pair until more than one pair of motors is supported in this model.
+			result := readTimedPosition(ctx, o.motors[0].right)
+			select {
+			case <-ctx.Done():
+				return
+			case rightResults <- result:
+			}
+		}
+	}
+
 	// Spawn a new goroutine to do all the work in the background.
-	o.workers = utils.NewStoppableWorkers(func(ctx context.Context) {
+	o.workers = utils.NewStoppableWorkers(readRight, func(ctx context.Context) {
 		ticker := time.NewTicker(time.Duration(o.timeIntervalMSecs) * time.Millisecond)
+		defer ticker.Stop()
+		basePropsCheckedAt := time.Now()
 		for {
 			select {
 			case <-ctx.Done():
@@ -384,81 +438,104 @@ func (o *odometry) trackPosition() {
 			case <-ticker.C:
 			}
 
-			// Use GetInParallel to ensure the left and right motors are polled at the same time.
-			positionFuncs := func() []utils.FloatFunc {
-				fs := []utils.FloatFunc{}
-
-				// Always use the first pair until more than one pair of motors is supported in this model.
-				fs = append(fs, func(ctx context.Context) (float64, error) { return o.motors[0].left.Position(ctx, nil) })
-				fs = append(fs, func(ctx context.Context) (float64, error) { return o.motors[0].right.Position(ctx, nil) })
-
-				return fs
+			select {
+			case <-ctx.Done():
+				return
+			case rightRequests <- struct{}{}:
 			}
-
-			_, positions, err := utils.GetInParallel(ctx, positionFuncs())
-			if err != nil {
-				o.logger.CError(ctx, err)
-				continue
+			left := readTimedPosition(ctx, o.motors[0].left)
+			var right timedPosition
+			select {
+			case <-ctx.Done():
+				return
+			case right = <-rightResults:
 			}
 
-			// Current position of the left and right motors in revolutions.
-			if len(positions) != len(o.motors)*2 {
-				o.logger.CError(ctx, "error getting both motor positions, trying again")
+			if left.err != nil {
+				o.logger.CError(ctx, left.err)
 				continue
 			}
-			left := positions[0]
-			right := positions[1]
-
-			// Base properties need to be checked every time because dependent components reconfiguring does not trigger
-			// the parent component to reconfigure. In this case, that means if the base properties change, the wheeled
-			// odometry movement sensor will not be aware of these changes and will continue to use the old values
-			o.checkBaseProps(ctx)
-
-			// Difference in the left and right motors since the last iteration, in mm.
-			leftDist := (left - o.lastLeftPos) * o.wheelCircumference
-			rightDist := (right - o.lastRightPos) * o.wheelCircumference
-
-			// Update lastLeftPos and lastRightPos to be the current position in mm.
-			o.lastLeftPos = left
-			o.lastRightPos = right
-
-			// Linear and angular distance the center point has traveled. This works based on
-			// the assumption that the time interval between calulations is small enough that
-			// the inner angle of the rotation will be small enough that it can be accurately
-			// estimated using the below equations.
-			centerDist := (leftDist + rightDist) / 2
-			centerAngle := (rightDist - leftDist) / o.baseWidth
-
-			// Update the position and orientation values accordingly.
-			o.mu.Lock()
-			o.orientation.Yaw += centerAngle
-
-			// Limit the yaw to a range of positive 0 to 360 degrees.
-			o.orientation.Yaw = math.Mod(o.orientation.Yaw, oneTurn)
-			o.orientation.Yaw = math.Mod(o.orientation.Yaw+oneTurn, oneTurn)
-			angle := o.orientation.Yaw
-			xFlip := -1.0
-			if o.useCompass {
-				angle = utils.DegToRad(yawToCompassHeading(o.orientation.Yaw))
-				xFlip = 1.0
+			if right.err != nil {
+				o.logger.CError(ctx, right.err)
+				continue
 			}
-			o.position.X += xFlip * (centerDist * math.Sin(angle))
-			o.position.Y += (centerDist * math.Cos(angle))
 
-			distance := math.Hypot(o.position.X, o.position.Y)
-			heading := utils.RadToDeg(math.Atan2(o.position.X, o.position.Y))
-			o.coord = o.originCoord.PointAtDistanceAndBearing(distance*mToKm, heading)
-			o.coordUpToDate.Store(true)
-
-			// Update the linear and angular velocity values using the provided time interval.
-			o.linearVelocity.Y = centerDist / (o.timeIntervalMSecs / 1000)
-			o.angularVelocity.Z = centerAngle * (180 / math.Pi) / (o.timeIntervalMSecs / 1000)
+			// Base properties need to be checked periodically because dependent components reconfiguring does not
+			// trigger the parent component to reconfigure. In this case, that means if the base properties change, the
+			// wheeled odometry movement sensor will not be aware of these changes and will continue to use the old values
+			if time.Since(basePropsCheckedAt) >= basePropsRefreshInterval {
+				o.checkBaseProps(ctx)
+				basePropsCheckedAt = time.Now()
+			}
 
-			o.mu.Unlock()
+			o.integrate(left, right)
 		}
 	})
 }
 
+// integrate updates the pose and velocities with the motor positions sampled at the end of an
+// interval.
+func (o *odometry) integrate(left, right timedPosition) {
+	sampledAt := left.sampledAt.Add(right.sampledAt.Sub(left.sampledAt) / 2)
+
+	// Difference in the left and right motors since the last iteration, in mm.
+	leftDist := (left.revolutions - o.lastLeftPos) * o.wheelCircumference
+	rightDist := (right.revolutions - o.lastRightPos) * o.wheelCircumference
+
+	// Update lastLeftPos and lastRightPos to be the current position in mm.
+	o.lastLeftPos = left.revolutions
+	o.lastRightPos = right.revolutions
+
+	// The time the motors took to travel those distances. There is no previous sample on the
+	// first iteration, so the nominal interval is used instead.
+	dt := time.Duration(o.timeIntervalMSecs) * time.Millisecond
+	if !o.lastSampleTime.IsZero() {
+		dt = sampledAt.Sub(o.lastSampleTime)
+	}
+	o.lastSampleTime = sampledAt
+
+	// Linear and angular distance the center point has traveled.
+	centerDist := (leftDist + rightDist) / 2
+	centerAngle := (rightDist - leftDist) / o.baseWidth
+
+	// Treat the motion as an arc of constant curvature. The base moves along the chord of
+	// that arc, whose direction is the heading halfway through the turn.
+	chordDist := centerDist
+	if halfAngle := centerAngle / 2; math.Abs(halfAngle) > 1e-9 {
+		chordDist = centerDist * math.Sin(halfAngle) / halfAngle
+	}
+
+	// Update the position and orientation values accordingly.
+	o.mu.Lock()
+	midYaw := o.orientation.Yaw + centerAngle/2
+	o.orientation.Yaw += centerAngle
+
+	// Limit the yaw to a range of positive 0 to 360 degrees.
+	o.orientation.Yaw = math.Mod(o.orientation.Yaw, oneTurn)
+	o.orientation.Yaw = math.Mod(o.orientation.Yaw+oneTurn, oneTurn)
+	midYaw = math.Mod(math.Mod(midYaw, oneTurn)+oneTurn, oneTurn)
+	angle := midYaw
+	xFlip := -1.0
+	if o.useCompass {
+		angle = utils.DegToRad(yawToCompassHeading(midYaw))
+		xFlip = 1.0
+	}
+	o.position.X += xFlip * (chordDist * math.Sin(angle))
+	o.position.Y += (chordDist * math.Cos(angle))
+
+	distance := math.Hypot(o.position.X, o.position.Y)
+	heading := utils.RadToDeg(math.Atan2(o.position.X, o.position.Y))
+	o.coord = o.originCoord.PointAtDistanceAndBearing(distance*mToKm, heading)
+	o.coordUpToDate.Store(true)
+
+	// Update the linear and angular velocity values using the measured time interval.
+	if dt > 0 {
+		o.linearVelocity.Y = centerDist / dt.Seconds()
+		o.angularVelocity.Z = centerAngle * (180 / math.Pi) / dt.Seconds()
+	}
+	o.mu.Unlock()
+}
+
 func (o *odometry) DoCommand(ctx context.Context,
 	req map[string]interface{},
 ) (map[string]interface{}, error) {
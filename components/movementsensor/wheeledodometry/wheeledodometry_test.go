@@ -439,33 +439,41 @@ func TestComplicatedPath(t *testing.T) {
 	or, err = od.Orientation(context.Background(), nil)
 	test.That(t, err, test.ShouldBeNil)
 	test.That(t, or.OrientationVectorDegrees().Theta, test.ShouldAlmostEqual, 0, 0.1)
-	test.That(t, pos.Lat(), test.ShouldAlmostEqual, 7.6, 0.1)
-	test.That(t, pos.Lng(), test.ShouldAlmostEqual, 6.4, 0.1)
+	// The base travels along the chord of the arc, heading 337.5 degrees halfway through the turn.
+	test.That(t, pos.Lat(), test.ShouldAlmostEqual, 7.47, 0.1)
+	test.That(t, pos.Lng(), test.ShouldAlmostEqual, 6.85, 0.1)
 	test.That(t, od.Close(context.Background()), test.ShouldBeNil)
 }
 
 func TestVelocities(t *testing.T) {
-	left := createFakeMotor(true)
-	right := createFakeMotor(false)
-	base := createFakeBase(1, 1, 0.1)
 	ctx := context.Background()
-	_ = left.ResetZeroPosition(ctx, 0, nil)
-	_ = right.ResetZeroPosition(ctx, 0, nil)
 
 	od := &odometry{
 		lastLeftPos:  0,
 		lastRightPos: 0, wheelCircumference: 1,
 		baseWidth:         1,
-		base:              base,
 		timeIntervalMSecs: 500,
 		originCoord:       geo.NewPoint(0, 0),
 	}
-	od.motors = append(od.motors, motorPair{left, right})
-	od.trackPosition()
+
+	// Feed samples taken exactly 500ms apart, such that the velocities do not depend on scheduling.
+	start := time.Now()
+	var samples int
+	var leftPos, rightPos float64
+	move := func(left, right float64) {
+		leftPos += left
+		rightPos += right
+		samples++
+		sampledAt := start.Add(time.Duration(samples) * 500 * time.Millisecond)
+		od.integrate(
+			timedPosition{revolutions: leftPos, sampledAt: sampledAt},
+			timedPosition{revolutions: rightPos, sampledAt: sampledAt},
+		)
+	}
+	move(0, 0)
 
 	// move forward 10 m
-	setPositions(10, 10)
-	time.Sleep(time.Duration(od.timeIntervalMSecs*1.15) * time.Millisecond)
+	move(10, 10)
 
 	linVel, err := od.LinearVelocity(ctx, nil)
 	test.That(t, err, test.ShouldBeNil)
@@ -475,8 +483,7 @@ func TestVelocities(t *testing.T) {
 	test.That(t, angVel.Z, test.ShouldAlmostEqual, 0, 0.1)
 
 	// spin 45 degrees
-	setPositions(-1*(math.Pi/8), 1*(math.Pi/8))
-	time.Sleep(time.Duration(od.timeIntervalMSecs*1.15) * time.Millisecond)
+	move(-1*(math.Pi/8), 1*(math.Pi/8))
 
 	linVel, err = od.LinearVelocity(ctx, nil)
 	test.That(t, err, test.ShouldBeNil)
@@ -486,8 +493,7 @@ func TestVelocities(t *testing.T) {
 	test.That(t, angVel.Z, test.ShouldAlmostEqual, 90, 0.1)
 
 	// spin back 45 degrees
-	setPositions(1*(math.Pi/8), -1*(math.Pi/8))
-	time.Sleep(time.Duration(od.timeIntervalMSecs*1.15) * time.Millisecond)
+	move(1*(math.Pi/8), -1*(math.Pi/8))
 
 	linVel, err = od.LinearVelocity(ctx, nil)
 	test.That(t, err, test.ShouldBeNil)
@@ -497,8 +503,7 @@ func TestVelocities(t *testing.T) {
 	test.That(t, angVel.Z, test.ShouldAlmostEqual, -90, 0.1)
 
 	// move backwards 5 m
-	setPositions(-5, -5)
-	time.Sleep(time.Duration(od.timeIntervalMSecs*1.15) * time.Millisecond)
+	move(-5, -5)
 
 	linVel, err = od.LinearVelocity(ctx, nil)
 	test.That(t, err, test.ShouldBeNil)
@@ -506,5 +511,4 @@ func TestVelocities(t *testing.T) {
 	test.That(t, err, test.ShouldBeNil)
 	test.That(t, linVel.Y, test.ShouldAlmostEqual, -10, 0.1)
 	test.That(t, angVel.Z, test.ShouldAlmostEqual, 0, 0.1)
-	test.That(t, od.Close(context.Background()), test.ShouldBeNil)
 }
@@ -1,6 +1,7 @@
 package config
 
 import (
+	"encoding/json"
 	"reflect"
 	"strings"
 	"syscall"
@@ -12,6 +13,7 @@ import (
 	"go.viam.com/utils/pexec"
 	"go.viam.com/utils/protoutils"
 	"go.viam.com/utils/rpc"
+	"google.golang.org/protobuf/encoding/protojson"
 	"google.golang.org/protobuf/types/known/durationpb"
 
 	"go.viam.com/rdk/logging"
@@ -116,7 +118,7 @@ func ComponentConfigToProto(conf *resource.Config) (*pb.ComponentConfig, error)
 		DependsOn:        conf.DependsOn,
 		ServiceConfigs:   serviceConfigs,
 		Attributes:       attributes,
-		LogConfiguration: &pb.LogConfiguration{Level: strings.ToLower(conf.LogConfiguration.Level.String())},
+		LogConfiguration: logConfigToProto(conf.Name, conf.LogConfiguration),
 	}
 
 	if conf.Frame != nil {
@@ -157,15 +159,6 @@ func ComponentConfigFromProto(protoConf *pb.ComponentConfig) (*resource.Config,
 		return nil, err
 	}
 
-	level := logging.INFO
-	if protoConf.GetLogConfiguration() != nil {
-		if level, err = logging.LevelFromString(protoConf.GetLogConfiguration().Level); err != nil {
-			// Don't fail configuration due to a malformed log level.
-			level = logging.INFO
-			logging.Global().Warnw(
-				"Invalid log level.", "name", protoConf.GetName(), "log_level", protoConf.GetLogConfiguration().Level, "error", err)
-		}
-	}
 	componentConf := resource.Config{
 		Name:                      protoConf.GetName(),
 		API:                       api,
@@ -173,7 +166,7 @@ func ComponentConfigFromProto(protoConf *pb.ComponentConfig) (*resource.Config,
 		Attributes:                attrs,
 		DependsOn:                 protoConf.GetDependsOn(),
 		AssociatedResourceConfigs: serviceConfigs,
-		LogConfiguration:          resource.LogConfig{Level: level},
+		LogConfiguration:          logConfigFromProto(protoConf.GetName(), protoConf.GetLogConfiguration()),
 	}
 
 	if protoConf.GetFrame() != nil {
@@ -211,7 +204,7 @@ func ServiceConfigToProto(conf *resource.Config) (*pb.ServiceConfig, error) {
 		Attributes:       attributes,
 		DependsOn:        conf.DependsOn,
 		ServiceConfigs:   serviceConfigs,
-		LogConfiguration: &pb.LogConfiguration{Level: strings.ToLower(conf.LogConfiguration.Level.String())},
+		LogConfiguration: logConfigToProto(conf.Name, conf.LogConfiguration),
 	}
 
 	return &protoConf, nil
@@ -240,16 +233,6 @@ func ServiceConfigFromProto(protoConf *pb.ServiceConfig) (*resource.Config, erro
 		return nil, err
 	}
 
-	level := logging.INFO
-	if protoConf.GetLogConfiguration() != nil {
-		if level, err = logging.LevelFromString(protoConf.GetLogConfiguration().Level); err != nil {
-			// Don't fail configuration due to a malformed log level.
-			level = logging.INFO
-			logging.Global().Warnw(
-				"Invalid log level.", "name", protoConf.GetName(), "log_level", protoConf.GetLogConfiguration().Level, "error", err)
-		}
-	}
-
 	conf := resource.Config{
 		Name:                      protoConf.GetName(),
 		API:                       api,
@@ -257,12 +240,63 @@ func ServiceConfigFromProto(protoConf *pb.ServiceConfig) (*resource.Config, erro
 		Attributes:                attrs,
 		DependsOn:                 protoConf.GetDependsOn(),
 		AssociatedResourceConfigs: serviceConfigs,
-		LogConfiguration:          resource.LogConfig{Level: level},
+		LogConfiguration:          logConfigFromProto(protoConf.GetName(), protoConf.GetLogConfiguration()),
 	}
 
 	return &conf, nil
 }
 
+// logConfigFromProto converts a resource's log configuration. Sampling is read through the proto's
+// JSON form such that it is picked up from any API version that carries a `sampling` message with
+// `burst` and `window_ms` fields.
+func logConfigFromProto(name string, proto *pb.LogConfiguration) resource.LogConfig {
+	conf := resource.LogConfig{Level: logging.INFO}
+	if proto == nil {
+		return conf
+	}
+
+	level, err := logging.LevelFromString(proto.Level)
+	if err != nil {
+		// Don't fail configuration due to a malformed log level.
+		logging.Global().Warnw("Invalid log level.", "name", name, "log_level", proto.Level, "error", err)
+	} else {
+		conf.Level = level
+	}
+
+	var sampling struct {
+		Sampling *logging.SamplingConfig `json:"sampling"`
+	}
+	raw, err := protojson.MarshalOptions{UseProtoNames: true}.Marshal(proto)
+	if err == nil {
+		err = json.Unmarshal(raw, &sampling)
+	}
+	if err != nil {
+		// Don't fail configuration due to a malformed sampling config either.
+		logging.Global().Warnw("Invalid log sampling config.", "name", name, "error", err)
+		return conf
+	}
+	conf.Sampling = sampling.Sampling
+	return conf
+}
+
+// logConfigToProto converts a resource's log configuration. Sampling is only kept if the proto has
+// a field for it.
+func logConfigToProto(name string, conf resource.LogConfig) *pb.LogConfiguration {
+	proto := &pb.LogConfiguration{Level: strings.ToLower(conf.Level.String())}
+	if conf.Sampling == nil {
+		return proto
+	}
+
+	raw, err := json.Marshal(map[string]interface{}{"sampling": conf.Sampling})
+	if err == nil {
+		err = protojson.UnmarshalOptions{DiscardUnknown: true, Merge: true}.Unmarshal(raw, proto)
+	}
+	if err != nil {
+		logging.Global().Warnw("Failed to convert log sampling config.", "name", name, "error", err)
+	}
+	return proto
+}
+
 // ModuleConfigToProto converts Module to the proto equivalent.
 func ModuleConfigToProto(module *Module) (*pb.ModuleConfig, error) {
 	var status *pb.AppValidationStatus
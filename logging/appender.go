@@ -1,11 +1,12 @@
 package logging
 
 import (
-	"fmt"
 	"io"
 	"os"
 	"strings"
+	"time"
 
+	"go.uber.org/zap/buffer"
 	"go.uber.org/zap/zapcore"
 )
 
@@ -20,6 +21,18 @@ type Appender interface {
 	Sync() error
 }
 
+var (
+	// consoleBufferPool hands out the byte buffers each log line is assembled in. Buffers are
+	// returned to the pool after the line has been written out.
+	consoleBufferPool = buffer.NewPool()
+
+	// fieldsEncoder is zap's json encoder which will encode our slice of fields in-order. As opposed
+	// to the random iteration order of a map. It is called with an empty Entry object such that only
+	// the fields become "map-ified". `EncodeEntry` clones the encoder internally, so a single
+	// instance is safe to share between goroutines.
+	fieldsEncoder = zapcore.NewJSONEncoder(zapcore.EncoderConfig{SkipLineEnding: true})
+)
+
 // ConsoleAppender will create human readable lines from log events and write them to the desired
 // output sync. E.g: stdout or a file.
 type ConsoleAppender struct {
@@ -38,45 +51,59 @@ func NewWriterAppender(writer io.Writer) ConsoleAppender {
 
 // Write outputs the log entry to the underlying stream.
 func (appender ConsoleAppender) Write(entry zapcore.Entry, fields []zapcore.Field) error {
-	const maxLength = 10
-	toPrint := make([]string, 0, maxLength)
+	buf := consoleBufferPool.Get()
+	defer buf.Free()
+
 	// We use UTC such that logs from different `viam-server`s can have their logs compared without
 	// needing them to be configured in the same timezone.
-	toPrint = append(toPrint, entry.Time.UTC().Format(DefaultTimeFormatStr))
-	toPrint = append(toPrint, strings.ToUpper(entry.Level.String()))
-	toPrint = append(toPrint, entry.LoggerName)
+	err := appendLogLine(buf, entry.Time.UTC(), entry, fields)
+	buf.AppendByte('\n')
+	if _, writeErr := appender.Writer.Write(buf.Bytes()); writeErr != nil && err == nil {
+		err = writeErr
+	}
+
+	return err
+}
+
+// Sync is a no-op.
+func (appender ConsoleAppender) Sync() error {
+	return nil
+}
+
+// appendLogLine appends the tab separated, human readable form of a log entry to `buf`. The entry
+// time is formatted as given, such that callers may choose between UTC and local time. If encoding
+// the structured fields fails, `buf` still contains everything up to and including the message and
+// the error is returned.
+func appendLogLine(buf *buffer.Buffer, entryTime time.Time, entry zapcore.Entry, fields []zapcore.Field) error {
+	buf.AppendTime(entryTime, DefaultTimeFormatStr)
+	buf.AppendByte('\t')
+	buf.AppendString(strings.ToUpper(entry.Level.String()))
+	buf.AppendByte('\t')
+	buf.AppendString(entry.LoggerName)
+	buf.AppendByte('\t')
 	if entry.Caller.Defined {
-		toPrint = append(toPrint, callerToString(&entry.Caller))
+		appendCaller(buf, &entry.Caller)
+		buf.AppendByte('\t')
 	}
-	toPrint = append(toPrint, entry.Message)
+	buf.AppendString(entry.Message)
 	if len(fields) == 0 {
-		fmt.Fprintln(appender.Writer, strings.Join(toPrint, "\t"))
 		return nil
 	}
 
-	// Use zap's json encoder which will encode our slice of fields in-order. As opposed to the
-	// random iteration order of a map. Call it with an empty Entry object such that only the fields
-	// become "map-ified".
-	jsonEncoder := zapcore.NewJSONEncoder(zapcore.EncoderConfig{SkipLineEnding: true})
-	buf, err := jsonEncoder.EncodeEntry(zapcore.Entry{}, fields)
+	fieldsBuf, err := fieldsEncoder.EncodeEntry(zapcore.Entry{}, fields)
 	if err != nil {
-		// Log what we have and return the error.
-		fmt.Fprintln(appender.Writer, strings.Join(toPrint, "\t"))
 		return err
 	}
-	toPrint = append(toPrint, string(buf.Bytes()))
+	defer fieldsBuf.Free()
 
-	fmt.Fprintln(appender.Writer, strings.Join(toPrint, "\t"))
-	return nil
-}
-
-// Sync is a no-op.
-func (appender ConsoleAppender) Sync() error {
-	return nil
+	buf.AppendByte('\t')
+	_, err = buf.Write(fieldsBuf.Bytes())
+	return err
 }
 
-// The input `caller` must satisfy `caller.Defined == true`.
-func callerToString(caller *zapcore.EntryCaller) string {
+// appendCaller appends the `<package>/<file>:<line>` form of `caller` to `buf`. The input `caller`
+// must satisfy `caller.Defined == true`.
+func appendCaller(buf *buffer.Buffer, caller *zapcore.EntryCaller) {
 	// The file returned by `runtime.Caller` is a full path and always contains '/' to separate
 	// directories. Including on windows. We only want to keep the `<package>/<file>` part of the
 	// path. We use a stateful lambda to count back two '/' runes.
@@ -95,5 +122,7 @@ func callerToString(caller *zapcore.EntryCaller) string {
 
 	// If idx >= 0, then we add 1 to trim the leading '/'.
 	// If idx == -1 (not found), we add 1 to return the entire file.
-	return fmt.Sprintf("%s:%d", caller.File[idx+1:], caller.Line)
+	buf.AppendString(caller.File[idx+1:])
+	buf.AppendByte(':')
+	buf.AppendInt(int64(caller.Line))
 }
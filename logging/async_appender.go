@@ -0,0 +1,202 @@
+package logging
+
+import (
+	"fmt"
+	"os"
+	"sync"
+	"time"
+
+	"go.uber.org/zap/zapcore"
+	"go.viam.com/utils"
+)
+
+// OverflowPolicy decides what an `AsyncAppender` does with a log entry that is written while its
+// queue is full.
+type OverflowPolicy int
+
+const (
+	// DropNewest discards the entry being written. The logging goroutine never waits.
+	DropNewest OverflowPolicy = iota
+	// DropOldest discards the oldest queued entry to make room for the entry being written. The
+	// logging goroutine never waits.
+	DropOldest
+	// Block makes the logging goroutine wait until the background writer frees up a slot. No
+	// entries are lost.
+	Block
+)
+
+// DefaultAsyncQueueSize is the number of entries an `AsyncAppender` queues when constructed with a
+// non-positive size.
+const DefaultAsyncQueueSize = 1024
+
+type asyncEntry struct {
+	entry  zapcore.Entry
+	fields []zapcore.Field
+}
+
+// AsyncAppender wraps another `Appender` and moves the work of writing entries off of the logging
+// goroutine. Entries are queued into a bounded ring and written out in order by a background
+// goroutine. When the ring is full, the configured `OverflowPolicy` is applied. The number of
+// dropped entries is reported through the wrapped appender as a warning once the writer catches up.
+//
+// AsyncAppenders ought to be `Close`d prior to shutdown to flush remaining logs.
+type AsyncAppender struct {
+	inner  Appender
+	policy OverflowPolicy
+
+	// mu guards all of the following members. `cond` is broadcast whenever entries are pushed or
+	// popped, when a batch finishes writing and on close.
+	mu   sync.Mutex
+	cond *sync.Cond
+	ring []asyncEntry
+	head int
+	size int
+	// inFlight is true while the background writer is outputting a batch it popped off the ring.
+	inFlight bool
+	// dropped counts entries discarded due to the overflow policy that have not yet been reported.
+	dropped int
+	closed  bool
+
+	activeBackgroundWorkers sync.WaitGroup
+}
+
+// NewAsyncAppender returns an `AsyncAppender` that queues up to `queueSize` entries in front of
+// `inner`. A non-positive `queueSize` uses `DefaultAsyncQueueSize`.
+func NewAsyncAppender(inner Appender, queueSize int, policy OverflowPolicy) *AsyncAppender {
+	if queueSize <= 0 {
+		queueSize = DefaultAsyncQueueSize
+	}
+
+	appender := &AsyncAppender{
+		inner:  inner,
+		policy: policy,
+		ring:   make([]asyncEntry, queueSize),
+	}
+	appender.cond = sync.NewCond(&appender.mu)
+
+	appender.activeBackgroundWorkers.Add(1)
+	utils.ManagedGo(appender.backgroundWorker, appender.activeBackgroundWorkers.Done)
+	return appender
+}
+
+// Write queues the log entry. It only returns an error if the appender is closed and writing
+// through to the wrapped appender fails.
+func (appender *AsyncAppender) Write(entry zapcore.Entry, fields []zapcore.Field) error {
+	appender.mu.Lock()
+	if appender.closed {
+		// Nothing will drain the ring anymore. Write through rather than lose the entry.
+		appender.mu.Unlock()
+		return appender.inner.Write(entry, fields)
+	}
+
+	for appender.size == len(appender.ring) {
+		switch appender.policy {
+		case DropNewest:
+			appender.dropped++
+			appender.mu.Unlock()
+			return nil
+		case DropOldest:
+			appender.ring[appender.head] = asyncEntry{}
+			appender.head = (appender.head + 1) % len(appender.ring)
+			appender.size--
+			appender.dropped++
+		case Block:
+			appender.cond.Wait()
+			if appender.closed {
+				appender.mu.Unlock()
+				return appender.inner.Write(entry, fields)
+			}
+		}
+	}
+
+	tail := (appender.head + appender.size) % len(appender.ring)
+	appender.ring[tail] = asyncEntry{entry, fields}
+	appender.size++
+	appender.cond.Broadcast()
+	appender.mu.Unlock()
+	return nil
+}
+
+// Sync waits for all queued entries to be written out and then syncs the wrapped appender.
+func (appender *AsyncAppender) Sync() error {
+	appender.mu.Lock()
+	for (appender.size > 0 || appender.inFlight) && !appender.closed {
+		appender.cond.Wait()
+	}
+	appender.mu.Unlock()
+
+	return appender.inner.Sync()
+}
+
+// Close stops accepting queued entries and waits for the background writer to flush everything
+// that was queued. Entries written after `Close` are written through synchronously.
+func (appender *AsyncAppender) Close() {
+	appender.mu.Lock()
+	appender.closed = true
+	appender.cond.Broadcast()
+	appender.mu.Unlock()
+
+	appender.activeBackgroundWorkers.Wait()
+	utils.UncheckedError(appender.inner.Sync())
+}
+
+// Dropped returns the number of entries discarded by the overflow policy that have not yet been
+// reported through the wrapped appender.
+func (appender *AsyncAppender) Dropped() int {
+	appender.mu.Lock()
+	defer appender.mu.Unlock()
+	return appender.dropped
+}
+
+func (appender *AsyncAppender) backgroundWorker() {
+	// The batch is reused across iterations to avoid an allocation per wakeup.
+	batch := make([]asyncEntry, 0, len(appender.ring))
+	for {
+		appender.mu.Lock()
+		for appender.size == 0 && !appender.closed {
+			appender.cond.Wait()
+		}
+		if appender.size == 0 && appender.closed {
+			appender.mu.Unlock()
+			return
+		}
+
+		batch = batch[:0]
+		for appender.size > 0 {
+			batch = append(batch, appender.ring[appender.head])
+			appender.ring[appender.head] = asyncEntry{}
+			appender.head = (appender.head + 1) % len(appender.ring)
+			appender.size--
+		}
+		dropped := appender.dropped
+		appender.dropped = 0
+		appender.inFlight = true
+		// Wake up writers blocked on a full ring.
+		appender.cond.Broadcast()
+		appender.mu.Unlock()
+
+		if dropped > 0 {
+			appender.writeEntry(zapcore.Entry{
+				Level:      zapcore.WarnLevel,
+				Time:       time.Now(),
+				LoggerName: "logging",
+				Message:    fmt.Sprintf("async log appender queue overflowed, dropped %d log entries", dropped),
+			}, nil)
+		}
+		for idx := range batch {
+			appender.writeEntry(batch[idx].entry, batch[idx].fields)
+			batch[idx] = asyncEntry{}
+		}
+
+		appender.mu.Lock()
+		appender.inFlight = false
+		appender.cond.Broadcast()
+		appender.mu.Unlock()
+	}
+}
+
+func (appender *AsyncAppender) writeEntry(entry zapcore.Entry, fields []zapcore.Field) {
+	if err := appender.inner.Write(entry, fields); err != nil {
+		fmt.Fprint(os.Stderr, err)
+	}
+}
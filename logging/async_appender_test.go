@@ -0,0 +1,143 @@
+package logging
+
+import (
+	"bytes"
+	"io"
+	"sync"
+	"testing"
+
+	"go.uber.org/zap/zapcore"
+	"go.viam.com/test"
+	"go.viam.com/utils/testutils"
+)
+
+// gatedAppender records entries and blocks every write until `release` is closed.
+type gatedAppender struct {
+	mu      sync.Mutex
+	release chan struct{}
+	entries []zapcore.Entry
+}
+
+func (gated *gatedAppender) Write(entry zapcore.Entry, fields []zapcore.Field) error {
+	<-gated.release
+	gated.mu.Lock()
+	defer gated.mu.Unlock()
+	gated.entries = append(gated.entries, entry)
+	return nil
+}
+
+func (gated *gatedAppender) Sync() error {
+	return nil
+}
+
+func (gated *gatedAppender) messages() []string {
+	gated.mu.Lock()
+	defer gated.mu.Unlock()
+	ret := make([]string, 0, len(gated.entries))
+	for _, entry := range gated.entries {
+		ret = append(ret, entry.Message)
+	}
+	return ret
+}
+
+func TestAsyncAppenderPreservesOrder(t *testing.T) {
+	inner := &gatedAppender{release: make(chan struct{})}
+	close(inner.release)
+
+	appender := NewAsyncAppender(inner, 4, Block)
+	defer appender.Close()
+
+	logger := NewBlankLogger("async")
+	logger.AddAppender(appender)
+	for _, msg := range []string{"1", "2", "3", "4", "5", "6", "7", "8"} {
+		logger.Info(msg)
+	}
+	test.That(t, logger.Sync(), test.ShouldBeNil)
+	test.That(t, inner.messages(), test.ShouldResemble, []string{"1", "2", "3", "4", "5", "6", "7", "8"})
+}
+
+func TestAsyncAppenderOverflow(t *testing.T) {
+	for _, tc := range []struct {
+		policy   OverflowPolicy
+		expected []string
+	}{
+		{DropNewest, []string{"a", "b", "c"}},
+		{DropOldest, []string{"a", "d", "e"}},
+	} {
+		inner := &gatedAppender{release: make(chan struct{})}
+		appender := NewAsyncAppender(inner, 2, tc.policy)
+
+		// Wait for the background writer to pop "a" and block on the gated appender. That leaves
+		// the entire ring available for the following writes.
+		test.That(t, appender.Write(zapcore.Entry{Message: "a"}, nil), test.ShouldBeNil)
+		testutils.WaitForAssertion(t, func(tb testing.TB) {
+			tb.Helper()
+			appender.mu.Lock()
+			defer appender.mu.Unlock()
+			test.That(tb, appender.inFlight, test.ShouldBeTrue)
+		})
+
+		for _, msg := range []string{"b", "c", "d", "e"} {
+			test.That(t, appender.Write(zapcore.Entry{Message: msg}, nil), test.ShouldBeNil)
+		}
+		test.That(t, appender.Dropped(), test.ShouldEqual, 2)
+
+		close(inner.release)
+		test.That(t, appender.Sync(), test.ShouldBeNil)
+		appender.Close()
+
+		// The overflow is reported ahead of the entries that survived.
+		messages := inner.messages()
+		test.That(t, len(messages), test.ShouldEqual, len(tc.expected)+1)
+		test.That(t, messages[0], test.ShouldEqual, "a")
+		test.That(t, messages[1], test.ShouldContainSubstring, "dropped 2 log entries")
+		test.That(t, messages[2:], test.ShouldResemble, tc.expected[1:])
+	}
+}
+
+func TestAsyncAppenderWritesThroughAfterClose(t *testing.T) {
+	var buf bytes.Buffer
+	appender := NewAsyncAppender(NewWriterAppender(&buf), 0, DropNewest)
+	appender.Close()
+
+	logger := NewBlankLogger("closed")
+	logger.AddAppender(appender)
+	logger.Info("after close")
+	test.That(t, buf.String(), test.ShouldContainSubstring, "after close")
+}
+
+func BenchmarkConsoleAppender(b *testing.B) {
+	logger := NewBlankLogger("bench")
+	logger.AddAppender(NewWriterAppender(io.Discard))
+
+	b.Run("Info", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			logger.Info("control loop tick")
+		}
+	})
+
+	b.Run("Infow", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			logger.Infow("control loop tick", "iteration", i, "error", 0.25)
+		}
+	})
+}
+
+func BenchmarkAsyncAppender(b *testing.B) {
+	for name, policy := range map[string]OverflowPolicy{"DropNewest": DropNewest, "Block": Block} {
+		appender := NewAsyncAppender(NewWriterAppender(io.Discard), 0, policy)
+		logger := NewBlankLogger("bench")
+		logger.AddAppender(appender)
+
+		b.Run(name, func(b *testing.B) {
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				logger.Infow("control loop tick", "iteration", i, "error", 0.25)
+			}
+			test.That(b, appender.Sync(), test.ShouldBeNil)
+		})
+		appender.Close()
+	}
+}
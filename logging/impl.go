@@ -6,6 +6,8 @@ import (
 	"fmt"
 	"os"
 	"runtime"
+	"sync"
+	"sync/atomic"
 	"testing"
 	"time"
 
@@ -19,6 +21,8 @@ type (
 	impl struct {
 		name  string
 		level AtomicLevel
+		// sampler suppresses repeated log statements. A nil sampler, the default, logs everything.
+		sampler atomic.Pointer[logSampler]
 
 		appenders []Appender
 		// Logging to a `testing.T` always includes a filename/line number. We use this helper to
@@ -63,6 +67,14 @@ func (imp *impl) Level() zapcore.Level {
 	return imp.GetLevel().AsZap()
 }
 
+func (imp *impl) SetSampling(config *SamplingConfig) {
+	old := imp.sampler.Swap(newLogSampler(config))
+	// Report what the replaced sampler suppressed rather than dropping the counts.
+	for _, summary := range old.flush(time.Now()) {
+		imp.Write(summary)
+	}
+}
+
 func (imp *impl) Sublogger(subname string) Logger {
 	newName := subname
 	if imp.name != "" {
@@ -71,12 +83,17 @@ func (imp *impl) Sublogger(subname string) Logger {
 
 	// Force all parameters to be passed. Avoid bugs where adding members to `impl` silently
 	// succeeds without a change here.
-	return &impl{
+	sublogger := &impl{
 		newName,
 		NewAtomicLevelAt(imp.level.Get()),
+		atomic.Pointer[logSampler]{},
 		imp.appenders,
 		imp.testHelper,
 	}
+	// Subloggers start out with the same sampling config, but count repeats independently.
+	sublogger.sampler.Store(newLogSampler(imp.sampler.Load().config()))
+
+	return sublogger
 }
 
 func (imp *impl) Named(name string) *zap.SugaredLogger {
@@ -156,6 +173,11 @@ func (imp *impl) shouldLog(logLevel Level) bool {
 
 func (imp *impl) Write(entry *LogEntry) {
 	imp.testHelper()
+	if entry == nil {
+		// The entry was suppressed by the sampler.
+		return
+	}
+
 	for _, appender := range imp.appenders {
 		err := appender.Write(entry.Entry, entry.fields)
 		if err != nil {
@@ -164,9 +186,36 @@ func (imp *impl) Write(entry *LogEntry) {
 	}
 }
 
+// sample checks whether `logEntry` may be logged under the logger's sampling config. It must be
+// called before any formatting work. If the entry's call site had entries suppressed in a previous
+// window, a summary entry is written out first. So is one for each idle call site the sampler
+// evicted with entries still unreported.
+func (imp *impl) sample(logEntry *LogEntry, logLevel Level, template string) bool {
+	suppressed, ok, evicted := imp.sampler.Load().allow(logLevel, template, logEntry.Entry)
+	for _, summary := range evicted {
+		imp.Write(summary)
+	}
+	if !ok {
+		return false
+	}
+
+	if suppressed > 0 {
+		summary := &LogEntry{Entry: logEntry.Entry}
+		summary.Level = logLevel.AsZap()
+		summary.Message = suppressedMessage(suppressed, template)
+		imp.Write(summary)
+	}
+
+	return true
+}
+
 // Constructs the log message by forwarding to `fmt.Sprint`. `traceKey` may be the empty string.
+// Returns nil if the entry is suppressed by sampling.
 func (imp *impl) format(logLevel Level, traceKey string, args ...interface{}) *LogEntry {
 	logEntry := imp.NewLogEntry()
+	if !imp.sample(logEntry, logLevel, "") {
+		return nil
+	}
 	logEntry.Level = logLevel.AsZap()
 	logEntry.Message = fmt.Sprint(args...)
 	if traceKey != emptyTraceKey {
@@ -177,8 +226,12 @@ func (imp *impl) format(logLevel Level, traceKey string, args ...interface{}) *L
 }
 
 // Constructs the log message by forwarding to `fmt.Sprintf`. `traceKey` may be the empty string.
+// Returns nil if the entry is suppressed by sampling.
 func (imp *impl) formatf(logLevel Level, traceKey, template string, args ...interface{}) *LogEntry {
 	logEntry := imp.NewLogEntry()
+	if !imp.sample(logEntry, logLevel, template) {
+		return nil
+	}
 	logEntry.Level = logLevel.AsZap()
 	logEntry.Message = fmt.Sprintf(template, args...)
 	if traceKey != emptyTraceKey {
@@ -191,9 +244,12 @@ func (imp *impl) formatf(logLevel Level, traceKey, template string, args ...inte
 // Turns `keysAndValues` into a map where the odd elements are the keys and their following even
 // counterpart is the value. The keys are expected to be strings. The values are json
 // serialized. Only public fields are included in the serialization. `traceKey` may be the empty
-// string.
+// string. Returns nil if the entry is suppressed by sampling.
 func (imp *impl) formatw(logLevel Level, traceKey, msg string, keysAndValues ...interface{}) *LogEntry {
 	logEntry := imp.NewLogEntry()
+	if !imp.sample(logEntry, logLevel, msg) {
+		return nil
+	}
 	logEntry.Level = logLevel.AsZap()
 	logEntry.Message = msg
 
@@ -446,25 +502,48 @@ func (imp *impl) Fatalw(msg string, keysAndValues ...interface{}) {
 	os.Exit(1)
 }
 
+// callerCache maps the program counter of a logging call site to its resolved
+// `zapcore.EntryCaller`. Resolving file, line and function names is the expensive part of
+// `runtime.Caller`. `runtime.Callers` reports each logical frame, including inlined ones, with a
+// program counter of its own, so one program counter identifies one call site. The set of call sites
+// in a binary is fixed, so the cache is bounded. A plain map is used rather than a `sync.Map`
+// because the latter boxes the key into an interface, which allocates on every lookup.
+var (
+	callerCacheMu sync.RWMutex
+	callerCache   = make(map[uintptr]zapcore.EntryCaller)
+)
+
 // Return example: "logging/impl_test.go:36". `entryCaller` is an outParameter.
 func getCaller() zapcore.EntryCaller {
-	var ok bool
-	var entryCaller zapcore.EntryCaller
-	const framesToSkip = 4
-	entryCaller.PC, entryCaller.File, entryCaller.Line, ok = runtime.Caller(framesToSkip)
-	if !ok {
-		return entryCaller
-	}
-	entryCaller.Defined = true
-
-	// Getting an individual program counter and the file/line/function at that address can be
-	// nuanced due to inlining. The alternative is getting all program counters on the stack and
-	// iterating through the associated frames with `runtime.CallersFrames`. A note to future
-	// readers that this choice is due to less coding/convenience.
-	runtimeFunc := runtime.FuncForPC(entryCaller.PC)
-	if runtimeFunc != nil {
-		entryCaller.Function = runtimeFunc.Name()
-	}
+	// `runtime.Callers` counts itself as frame 0, where `runtime.Caller` starts at its caller.
+	const framesToSkip = 5
+	var pcs [1]uintptr
+	if runtime.Callers(framesToSkip, pcs[:]) == 0 {
+		return zapcore.EntryCaller{}
+	}
+	pc := pcs[0]
+
+	callerCacheMu.RLock()
+	cached, ok := callerCache[pc]
+	callerCacheMu.RUnlock()
+	if ok {
+		return cached
+	}
+
+	// The file/line/function at a program counter can be nuanced due to inlining.
+	// `runtime.CallersFrames` accounts for inlined frames and adjusts return program counters into
+	// call program counters. This runs once per call site.
+	frame, _ := runtime.CallersFrames(pcs[:]).Next()
+	entryCaller := zapcore.EntryCaller{
+		Defined:  frame.PC != 0,
+		PC:       frame.PC,
+		File:     frame.File,
+		Line:     frame.Line,
+		Function: frame.Function,
+	}
+	callerCacheMu.Lock()
+	callerCache[pc] = entryCaller
+	callerCacheMu.Unlock()
 
 	return entryCaller
 }
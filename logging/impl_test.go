@@ -8,6 +8,7 @@ import (
 	"strconv"
 	"strings"
 	"testing"
+	"time"
 
 	"go.viam.com/test"
 )
@@ -298,3 +299,105 @@ func TestSublogger(t *testing.T) {
 	assertLogMatches(t, notStdout,
 		`2023-10-30T09:12:09.459Z	INFO	impl.sub	logging/impl_test.go:67	info log`)
 }
+
+func TestSampling(t *testing.T) {
+	notStdout := &bytes.Buffer{}
+	logger := &impl{
+		name:       "impl",
+		level:      NewAtomicLevelAt(DEBUG),
+		appenders:  []Appender{NewWriterAppender(notStdout)},
+		testHelper: func() {},
+	}
+	logger.SetSampling(&SamplingConfig{Burst: 2, WindowMs: 60 * 1000})
+
+	for i := 0; i < 5; i++ {
+		logger.Warnf("failed to read position: %d", i)
+	}
+	// A different template from the same logger is counted separately.
+	logger.Warnw("different message", "key", "value")
+
+	assertLogMatches(t, notStdout,
+		`2023-10-30T09:12:09.459Z	WARN	impl	logging/impl_test.go:67	failed to read position: 0`)
+	assertLogMatches(t, notStdout,
+		`2023-10-30T09:12:09.459Z	WARN	impl	logging/impl_test.go:67	failed to read position: 1`)
+	assertLogMatches(t, notStdout,
+		`2023-10-30T09:12:09.459Z	WARN	impl	logging/impl_test.go:67	different message	{"key":"value"}`)
+	test.That(t, notStdout.Len(), test.ShouldEqual, 0)
+
+	// Pretend the window elapsed. The next entry is preceded by a summary of what was suppressed.
+	sampler := logger.sampler.Load()
+	for _, state := range sampler.states {
+		state.windowStart = state.windowStart.Add(-time.Hour)
+	}
+	for i := 5; i < 7; i++ {
+		logger.Warnf("failed to read position: %d", i)
+	}
+	assertLogMatches(t, notStdout,
+		`2023-10-30T09:12:09.459Z	WARN	impl	logging/impl_test.go:67	Suppressed 3 repeats of log message "failed to read position: %d"`)
+	assertLogMatches(t, notStdout,
+		`2023-10-30T09:12:09.459Z	WARN	impl	logging/impl_test.go:67	failed to read position: 5`)
+	assertLogMatches(t, notStdout,
+		`2023-10-30T09:12:09.459Z	WARN	impl	logging/impl_test.go:67	failed to read position: 6`)
+
+	// Subloggers inherit the config. Removing it logs everything.
+	subLogger := logger.Sublogger("sub")
+	test.That(t, subLogger.(*impl).sampler.Load().config(), test.ShouldResemble, &SamplingConfig{Burst: 2, WindowMs: 60 * 1000})
+	test.That(t, subLogger.(*impl).sampler.Load().config().Equal(&SamplingConfig{Burst: 2, WindowMs: 60 * 1000}), test.ShouldBeTrue)
+	test.That(t, (&SamplingConfig{Burst: 2, WindowMs: 1}).Equal(nil), test.ShouldBeFalse)
+	test.That(t, (*SamplingConfig)(nil).Equal(nil), test.ShouldBeTrue)
+	logger.SetSampling(nil)
+	for i := 0; i < 3; i++ {
+		logger.Info("unsampled")
+	}
+	test.That(t, strings.Count(notStdout.String(), "unsampled"), test.ShouldEqual, 3)
+}
+
+func TestSamplingEviction(t *testing.T) {
+	notStdout := &bytes.Buffer{}
+	logger := &impl{
+		name:       "impl",
+		level:      NewAtomicLevelAt(DEBUG),
+		appenders:  []Appender{NewWriterAppender(notStdout)},
+		testHelper: func() {},
+	}
+	logger.SetSampling(&SamplingConfig{Burst: 1, WindowMs: 60 * 1000})
+
+	for i := 0; i < 4; i++ {
+		logger.Warnf("failed to read position: %d", i)
+	}
+	assertLogMatches(t, notStdout,
+		`2023-10-30T09:12:09.459Z	WARN	impl	logging/impl_test.go:67	failed to read position: 0`)
+	test.That(t, notStdout.Len(), test.ShouldEqual, 0)
+
+	// The message stops repeating. Once a window passes, logging anything else evicts its group and
+	// reports the final count.
+	sampler := logger.sampler.Load()
+	for _, state := range sampler.states {
+		state.windowStart = state.windowStart.Add(-time.Hour)
+	}
+	sampler.lastSweep = sampler.lastSweep.Add(-time.Hour)
+	logger.Info("other message")
+	assertLogMatches(t, notStdout,
+		`2023-10-30T09:12:09.459Z	WARN	impl	logging/impl_test.go:67	Suppressed 3 repeats of log message "failed to read position: %d"`)
+	assertLogMatches(t, notStdout,
+		`2023-10-30T09:12:09.459Z	INFO	impl	logging/impl_test.go:67	other message`)
+	test.That(t, len(sampler.states), test.ShouldEqual, 1)
+
+	// Replacing the config reports counts that have not been logged yet.
+	for i := 0; i < 3; i++ {
+		logger.Info("other message")
+	}
+	logger.SetSampling(nil)
+	assertLogMatches(t, notStdout,
+		`2023-10-30T09:12:09.459Z	INFO	impl	logging/impl_test.go:67	Suppressed 3 repeats of a log message`)
+	test.That(t, notStdout.Len(), test.ShouldEqual, 0)
+}
+
+func TestNewLogEntryAllocs(t *testing.T) {
+	logger := &impl{name: "impl", level: NewAtomicLevelAt(DEBUG), testHelper: func() {}}
+	// At most the entry itself is allocated. Looking up the cached call site must not allocate.
+	allocs := testing.AllocsPerRun(100, func() {
+		logger.NewLogEntry()
+	})
+	test.That(t, allocs, test.ShouldBeLessThanOrEqualTo, 1)
+}
@@ -15,10 +15,13 @@ type Logger interface {
 
 	SetLevel(level Level)
 	GetLevel() Level
+	// SetSampling configures duplicate suppression for log statements. A nil config logs everything.
+	SetSampling(config *SamplingConfig)
 	Sublogger(subname string) Logger
 	AddAppender(appender Appender)
 	AsZap() *zap.SugaredLogger
-	// Unconditionally logs a LogEntry object. Specifically any configured log level is ignored.
+	// Unconditionally logs a LogEntry object. Specifically any configured log level is ignored. A
+	// nil entry is ignored.
 	Write(*LogEntry)
 
 	CDebug(ctx context.Context, args ...interface{})
@@ -107,6 +110,10 @@ func (logger *zLogger) GetLevel() Level {
 	return INFO
 }
 
+func (logger *zLogger) SetSampling(config *SamplingConfig) {
+	// Not supported
+}
+
 func (logger *zLogger) AddAppender(appender Appender) {
 	// Not supported
 }
@@ -169,6 +176,10 @@ func (logger zLogger) CErrorw(ctx context.Context, msg string, keysAndValues ...
 }
 
 func (logger zLogger) Write(entry *LogEntry) {
+	if entry == nil {
+		return
+	}
+
 	err := logger.Desugar().Core().Write(entry.Entry, entry.fields)
 	if err != nil {
 		fmt.Fprint(os.Stderr, err)
@@ -0,0 +1,188 @@
+package logging
+
+import (
+	"errors"
+	"fmt"
+	"sync"
+	"time"
+
+	"go.uber.org/zap/zapcore"
+)
+
+// SamplingConfig describes duplicate suppression for a logger. Log statements are grouped by their
+// level, message template and call site. Within each window of `WindowMs` milliseconds, the first
+// `Burst` entries of a group are logged and the remainder are dropped before any formatting work is
+// done. The first entry logged in a later window is preceded by a summary of how many entries were
+// suppressed. Groups that go a full window without an entry are forgotten, and any entries they
+// suppressed are reported at that point.
+type SamplingConfig struct {
+	Burst    int `json:"burst"`
+	WindowMs int `json:"window_ms"`
+}
+
+// Validate returns an error if the config would suppress every log statement or never reset.
+func (conf *SamplingConfig) Validate() error {
+	if conf.Burst <= 0 {
+		return errors.New("log sampling burst must be positive")
+	}
+	if conf.WindowMs <= 0 {
+		return errors.New("log sampling window_ms must be positive")
+	}
+	return nil
+}
+
+// Equal reports whether two configs, either of which may be nil, describe the same sampling.
+func (conf *SamplingConfig) Equal(other *SamplingConfig) bool {
+	if conf == nil || other == nil {
+		return conf == other
+	}
+	return *conf == *other
+}
+
+type sampleKey struct {
+	level    Level
+	template string
+	pc       uintptr
+}
+
+type sampleState struct {
+	windowStart time.Time
+	count       int
+	suppressed  int
+	// entry is the first entry of the group. It carries the logger name and call site used to
+	// report suppressed entries when the group is evicted.
+	entry zapcore.Entry
+}
+
+// logSampler is a per-logger rate limiter. A nil `*logSampler` allows every entry.
+type logSampler struct {
+	burst  int
+	window time.Duration
+
+	mu        sync.Mutex
+	states    map[sampleKey]*sampleState
+	lastSweep time.Time
+}
+
+// newLogSampler returns nil, i.e. no sampling, for a nil or invalid config.
+func newLogSampler(conf *SamplingConfig) *logSampler {
+	if conf == nil || conf.Validate() != nil {
+		return nil
+	}
+
+	return &logSampler{
+		burst:  conf.Burst,
+		window: time.Duration(conf.WindowMs) * time.Millisecond,
+		states: make(map[sampleKey]*sampleState),
+	}
+}
+
+func (sampler *logSampler) config() *SamplingConfig {
+	if sampler == nil {
+		return nil
+	}
+
+	return &SamplingConfig{Burst: sampler.burst, WindowMs: int(sampler.window / time.Millisecond)}
+}
+
+// allow reports whether `entry`, a log statement for the given level and template, should be
+// logged. When it should be, the number of entries of its group suppressed since the last one logged
+// is also returned. Any idle groups evicted along the way that had suppressed entries are returned
+// as summary entries to be written out.
+func (sampler *logSampler) allow(level Level, template string, entry zapcore.Entry) (int, bool, []*LogEntry) {
+	if sampler == nil {
+		return 0, true, nil
+	}
+
+	key := sampleKey{level, template, entry.Caller.PC}
+	now := entry.Time
+	sampler.mu.Lock()
+	defer sampler.mu.Unlock()
+
+	suppressed, ok := sampler.allowLocked(key, entry)
+	// The group for `key` was touched at `now`, so it is never among those evicted.
+	return suppressed, ok, sampler.evictIdleLocked(now)
+}
+
+func (sampler *logSampler) allowLocked(key sampleKey, entry zapcore.Entry) (int, bool) {
+	now := entry.Time
+	state, ok := sampler.states[key]
+	if !ok {
+		sampler.states[key] = &sampleState{windowStart: now, count: 1, entry: entry}
+		return 0, true
+	}
+
+	if now.Sub(state.windowStart) >= sampler.window {
+		suppressed := state.suppressed
+		*state = sampleState{windowStart: now, count: 1, entry: state.entry}
+		return suppressed, true
+	}
+
+	if state.count < sampler.burst {
+		state.count++
+		return 0, true
+	}
+
+	state.suppressed++
+	return 0, false
+}
+
+// evictIdleLocked removes groups whose window elapsed without them being reset. To keep the cost
+// off the common path, it scans the groups at most once per window. The result has one summary
+// entry per evicted group that suppressed entries in its final window.
+func (sampler *logSampler) evictIdleLocked(now time.Time) []*LogEntry {
+	if now.Sub(sampler.lastSweep) < sampler.window {
+		return nil
+	}
+	sampler.lastSweep = now
+
+	var summaries []*LogEntry
+	for key, state := range sampler.states {
+		if now.Sub(state.windowStart) < sampler.window {
+			continue
+		}
+		delete(sampler.states, key)
+		if state.suppressed > 0 {
+			summaries = append(summaries, state.summary(key, now))
+		}
+	}
+
+	return summaries
+}
+
+// flush removes every group and returns a summary entry for each one with suppressed entries.
+func (sampler *logSampler) flush(now time.Time) []*LogEntry {
+	if sampler == nil {
+		return nil
+	}
+
+	sampler.mu.Lock()
+	defer sampler.mu.Unlock()
+
+	var summaries []*LogEntry
+	for key, state := range sampler.states {
+		if state.suppressed > 0 {
+			summaries = append(summaries, state.summary(key, now))
+		}
+	}
+	sampler.states = make(map[sampleKey]*sampleState)
+
+	return summaries
+}
+
+func (state *sampleState) summary(key sampleKey, now time.Time) *LogEntry {
+	summary := &LogEntry{Entry: state.entry}
+	summary.Time = now
+	summary.Level = key.level.AsZap()
+	summary.Message = suppressedMessage(state.suppressed, key.template)
+
+	return summary
+}
+
+// suppressedMessage is the text of the summary entry logged for `suppressed` entries of a group.
+func suppressedMessage(suppressed int, template string) string {
+	if template == "" {
+		return fmt.Sprintf("Suppressed %d repeats of a log message", suppressed)
+	}
+	return fmt.Sprintf("Suppressed %d repeats of log message %q", suppressed, template)
+}
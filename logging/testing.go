@@ -1,7 +1,6 @@
 package logging
 
 import (
-	"strings"
 	"testing"
 
 	"go.uber.org/zap/zapcore"
@@ -44,34 +43,12 @@ func NewTestAppender(tb testing.TB) Appender {
 // Write outputs the log entry to the underlying test object `Log` method.
 func (tapp *testAppender) Write(entry zapcore.Entry, fields []zapcore.Field) error {
 	tapp.tb.Helper()
-	const maxLength = 10
-	toPrint := make([]string, 0, maxLength)
-	toPrint = append(toPrint, entry.Time.Format(DefaultTimeFormatStr))
+	buf := consoleBufferPool.Get()
+	defer buf.Free()
 
-	toPrint = append(toPrint, strings.ToUpper(entry.Level.String()))
-	toPrint = append(toPrint, entry.LoggerName)
-	if entry.Caller.Defined {
-		toPrint = append(toPrint, callerToString(&entry.Caller))
-	}
-	toPrint = append(toPrint, entry.Message)
-	if len(fields) == 0 {
-		tapp.tb.Log(strings.Join(toPrint, "\t"))
-		return nil
-	}
-
-	// Use zap's json encoder which will encode our slice of fields in-order. As opposed to the
-	// random iteration order of a map. Call it with an empty Entry object such that only the fields
-	// become "map-ified".
-	jsonEncoder := zapcore.NewJSONEncoder(zapcore.EncoderConfig{SkipLineEnding: true})
-	buf, err := jsonEncoder.EncodeEntry(zapcore.Entry{}, fields)
-	if err != nil {
-		// Log what we have and return the error.
-		tapp.tb.Log(strings.Join(toPrint, "\t"))
-		return err
-	}
-	toPrint = append(toPrint, string(buf.Bytes()))
-	tapp.tb.Log(strings.Join(toPrint, "\t"))
-	return nil
+	err := appendLogLine(buf, entry.Time, entry, fields)
+	tapp.tb.Log(buf.String())
+	return err
 }
 
 // Sync is a no-op.
@@ -5,6 +5,7 @@ import (
 	"context"
 	"fmt"
 	"io/fs"
+	"net"
 	"os"
 	"path/filepath"
 	"slices"
@@ -1047,8 +1048,8 @@ func (m *module) startProcess(
 	var err error
 	// append a random alpha string to the module name while creating a socket address to avoid conflicts
 	// with old versions of the module.
-	if m.addr, err = modlib.CreateSocketAddress(
-		filepath.Dir(parentAddr), fmt.Sprintf("%s-%s", m.cfg.Name, utils.RandomAlphaString(5))); err != nil {
+	socketName := fmt.Sprintf("%s-%s", m.cfg.Name, utils.RandomAlphaString(5))
+	if m.addr, err = modlib.CreateSocketAddress(filepath.Dir(parentAddr), socketName); err != nil {
 		return err
 	}
 
@@ -1069,6 +1070,24 @@ func (m *module) startProcess(
 		logger.CInfow(ctx, "Starting module in working directory", "module", m.cfg.Name, "dir", moduleWorkingDirectory)
 	}
 
+	// The module connects to this socket as soon as its own socket is listening, so we usually find
+	// out it is up without waiting for the next check below. Modules built with older SDKs never
+	// connect, and we notice their socket with those checks instead.
+	var ready <-chan struct{}
+	readyAddr, err := modlib.CreateSocketAddress(filepath.Dir(parentAddr), socketName+"-ready")
+	if err == nil {
+		var stopListening func()
+		ready, stopListening, err = listenForReady(readyAddr)
+		if err == nil {
+			defer stopListening()
+			moduleEnvironment[modlib.ReadySocketEnvVar] = readyAddr
+		}
+	}
+	if err != nil {
+		logger.CDebugw(ctx, "Not listening for module readiness, will check for its socket instead",
+			"module", m.cfg.Name, "error", err)
+	}
+
 	pconf := pexec.ProcessConfig{
 		ID:               m.cfg.Name,
 		Name:             absoluteExePath,
@@ -1105,6 +1124,8 @@ func (m *module) startProcess(
 				return rutils.NewModuleStartUpTimeoutError(m.cfg.Name)
 			}
 			return ctxTimeout.Err()
+		case <-ready:
+			ready = nil
 		case <-checkTicker.C:
 			if errors.Is(m.process.Status(), os.ErrProcessDone) {
 				return fmt.Errorf(
@@ -1125,6 +1146,31 @@ func (m *module) startProcess(
 	return nil
 }
 
+// listenForReady listens on a unix socket at `addr` for a module to connect once it is listening on
+// its own socket. The returned channel is closed when it does. Call the returned function to stop
+// listening, which also removes the socket.
+func listenForReady(addr string) (<-chan struct{}, func(), error) {
+	lis, err := net.Listen("unix", addr)
+	if err != nil {
+		return nil, nil, err
+	}
+	ready := make(chan struct{})
+	done := make(chan struct{})
+	utils.PanicCapturingGo(func() {
+		defer close(done)
+		conn, err := lis.Accept()
+		if err != nil {
+			return // We stopped listening.
+		}
+		utils.UncheckedError(conn.Close())
+		close(ready)
+	})
+	return ready, func() {
+		utils.UncheckedError(lis.Close())
+		<-done
+	}, nil
+}
+
 func (m *module) stopProcess() error {
 	if m.process == nil {
 		return nil
@@ -3,6 +3,7 @@ package modmanager
 import (
 	"context"
 	"fmt"
+	"net"
 	"os"
 	"path/filepath"
 	"sync/atomic"
@@ -1320,3 +1321,30 @@ func TestBadModuleFailsFast(t *testing.T) {
 
 	test.That(t, err.Error(), test.ShouldContainSubstring, "module test-module exited too quickly after attempted startup")
 }
+
+func TestListenForReady(t *testing.T) {
+	readyAddr, err := modlib.CreateSocketAddress(t.TempDir(), "ready")
+	test.That(t, err, test.ShouldBeNil)
+	ready, stopListening, err := listenForReady(readyAddr)
+	test.That(t, err, test.ShouldBeNil)
+
+	select {
+	case <-ready:
+		t.Fatal("ready before the module connected")
+	default:
+	}
+
+	conn, err := net.Dial("unix", readyAddr)
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, conn.Close(), test.ShouldBeNil)
+	select {
+	case <-ready:
+	case <-time.After(5 * time.Second):
+		t.Fatal("not ready after the module connected")
+	}
+
+	// Stopping cleans up the socket.
+	stopListening()
+	_, err = os.Stat(readyAddr)
+	test.That(t, os.IsNotExist(err), test.ShouldBeTrue)
+}
@@ -54,6 +54,11 @@ const (
 	maxSupportedWebRTCTRacks = 9
 )
 
+// ReadySocketEnvVar is the environment variable through which the module manager passes the path of
+// a unix socket it listens on. Once the module's own socket is listening, the module connects to it
+// so the manager learns the module is up without polling the filesystem.
+const ReadySocketEnvVar = "VIAM_MODULE_READY_SOCKET"
+
 // errMaxSupportedWebRTCTrackLimit is the error returned when the MaxSupportedWebRTCTRacks limit is reached.
 var errMaxSupportedWebRTCTrackLimit = fmt.Errorf("only %d WebRTC tracks are supported per peer connection", maxSupportedWebRTCTRacks)
 
@@ -275,6 +280,7 @@ func (m *Module) Start(ctx context.Context) error {
 	}); err != nil {
 		return err
 	}
+	notifyListening(m.logger)
 
 	m.activeBackgroundWorkers.Add(1)
 	utils.PanicCapturingGo(func() {
@@ -289,6 +295,21 @@ func (m *Module) Start(ctx context.Context) error {
 	return nil
 }
 
+// notifyListening tells the module manager that the module's socket is listening, if the manager
+// asked to be told. Managers that did not ask notice the socket on their own.
+func notifyListening(logger logging.Logger) {
+	readyAddr := os.Getenv(ReadySocketEnvVar)
+	if readyAddr == "" {
+		return
+	}
+	conn, err := net.DialTimeout("unix", readyAddr, time.Second)
+	if err != nil {
+		logger.Debugw("failed to notify module manager that the module is listening", "error", err)
+		return
+	}
+	utils.UncheckedError(conn.Close())
+}
+
 // Close shuts down the module and grpc server.
 func (m *Module) Close(ctx context.Context) {
 	m.closeOnce.Do(func() {
@@ -8,6 +8,8 @@ import (
 	"fmt"
 	"math"
 	"math/rand"
+	"sort"
+	"sync"
 	"time"
 
 	"go.viam.com/utils"
@@ -25,6 +27,10 @@ const (
 
 	// Maximum number of iterations that constrainedExtend will run before exiting.
 	maxExtendIter = 5000
+
+	// Maximum number of non-overlapping shortcuts that smoothPath evaluates in parallel. This is a constant rather than
+	// based on the number of CPUs such that smoothing is reproducible across machines for a given seed.
+	smoothBatchSize = 8
 )
 
 type cbirrtOptions struct {
@@ -402,70 +408,190 @@ func (mp *cBiRRTMotionPlanner) constrainNear(
 	return nil
 }
 
+// smoothCandidate is a shortcut between inputSteps[i] and inputSteps[j] that smoothPath attempts to make.
+type smoothCandidate struct {
+	i, j       int
+	hitCorners []node
+	seed       int64
+
+	// Set once the candidate has been evaluated. reached is nil if no shortcut was found, otherwise it is the
+	// first node of the chain that replaces inputSteps[i:j+1], and shortcut maps every node of the chain to its successor.
+	reached  node
+	shortcut map[node]node
+}
+
 // smoothPath will pick two points at random along the path and attempt to do a fast gradient descent directly between
 // them, which will cut off randomly-chosen points with odd joint angles into something that is a more intuitive motion.
+//
+// Up to smoothBatchSize shortcuts that do not overlap are drawn at a time and evaluated in parallel. Each is given its own
+// random seed drawn from mp.randseed and accepted shortcuts are spliced in by index, so the result only depends on the
+// planner's seed and not on the order in which the evaluations finish.
 func (mp *cBiRRTMotionPlanner) smoothPath(ctx context.Context, inputSteps []node) []node {
 	toIter := int(math.Min(float64(len(inputSteps)*len(inputSteps)), float64(mp.planOpts.SmoothIter)))
 
-	schan := make(chan node, 1)
-	defer close(schan)
-
 	for numCornersToPass := 2; numCornersToPass > 0; numCornersToPass-- {
-		for iter := 0; iter < toIter/2 && len(inputSteps) > 3; iter++ {
+		for iter := 0; iter < toIter/2 && len(inputSteps) > 3; {
 			select {
 			case <-ctx.Done():
 				return inputSteps
 			default:
 			}
-			// get start node of first edge. Cannot be either the last or second-to-last node.
-			// Intn will return an int in the half-open interval [0,n)
-			i := mp.randseed.Intn(len(inputSteps) - 2)
-			j := i + 1
-			cornersPassed := 0
-			hitCorners := []node{}
-			for (cornersPassed != numCornersToPass || !inputSteps[j].Corner()) && j < len(inputSteps)-1 {
-				j++
-				if cornersPassed < numCornersToPass && inputSteps[j].Corner() {
-					cornersPassed++
-					hitCorners = append(hitCorners, inputSteps[j])
+
+			candidates := []*smoothCandidate{}
+			for len(candidates) < smoothBatchSize && iter < toIter/2 {
+				iter++
+				if candidate := mp.drawSmoothCandidate(inputSteps, numCornersToPass); candidate != nil {
+					if overlapsAny(candidate, candidates) {
+						continue
+					}
+					candidate.seed = mp.randseed.Int63()
+					candidates = append(candidates, candidate)
 				}
 			}
-			// no corners existed between i and end of inputSteps -> not good candidate for smoothing
-			if len(hitCorners) == 0 {
+			if len(candidates) == 0 {
 				continue
 			}
 
-			shortcutGoal := make(map[node]node)
+			var activeWorkers sync.WaitGroup
+			for _, candidate := range candidates {
+				candidate := candidate
+				activeWorkers.Add(1)
+				utils.PanicCapturingGo(func() {
+					defer activeWorkers.Done()
+					mp.evaluateSmoothCandidate(ctx, inputSteps, candidate)
+				})
+			}
+			activeWorkers.Wait()
 
-			iSol := inputSteps[i]
-			jSol := inputSteps[j]
-			shortcutGoal[jSol] = nil
+			inputSteps = applySmoothCandidates(inputSteps, candidates)
+		}
+	}
+	return inputSteps
+}
 
-			mp.constrainedExtend(ctx, mp.randseed, shortcutGoal, jSol, iSol, schan)
-			reached := <-schan
+// drawSmoothCandidate picks a random shortcut that cuts off numCornersToPass corners, or fewer if the end of the path is
+// hit first. It returns nil if no corners would be cut.
+func (mp *cBiRRTMotionPlanner) drawSmoothCandidate(inputSteps []node, numCornersToPass int) *smoothCandidate {
+	// get start node of first edge. Cannot be either the last or second-to-last node.
+	// Intn will return an int in the half-open interval [0,n)
+	i := mp.randseed.Intn(len(inputSteps) - 2)
+	j := i + 1
+	cornersPassed := 0
+	hitCorners := []node{}
+	for (cornersPassed != numCornersToPass || !inputSteps[j].Corner()) && j < len(inputSteps)-1 {
+		j++
+		if cornersPassed < numCornersToPass && inputSteps[j].Corner() {
+			cornersPassed++
+			hitCorners = append(hitCorners, inputSteps[j])
+		}
+	}
+	// no corners existed between i and end of inputSteps -> not good candidate for smoothing
+	if len(hitCorners) == 0 {
+		return nil
+	}
+	return &smoothCandidate{i: i, j: j, hitCorners: hitCorners}
+}
 
-			// Note this could technically replace paths with "longer" paths i.e. with more waypoints.
-			// However, smoothed paths are invariably more intuitive and smooth, and lend themselves to future shortening,
-			// so we allow elongation here.
-			dist := mp.planOpts.DistanceFunc(&ik.Segment{StartConfiguration: inputSteps[i].Q(), EndConfiguration: reached.Q()})
-			if dist < mp.planOpts.JointSolveDist {
-				for _, hitCorner := range hitCorners {
-					hitCorner.SetCorner(false)
-				}
+// overlapsAny reports whether candidate shares any node of the path with one of the others. Shortcuts replace both of
+// their endpoints, so candidates may not even share those.
+func overlapsAny(candidate *smoothCandidate, others []*smoothCandidate) bool {
+	for _, other := range others {
+		if candidate.i <= other.j && other.i <= candidate.j {
+			return true
+		}
+	}
+	return false
+}
 
-				newInputSteps := append([]node{}, inputSteps[:i]...)
-				for reached != nil {
-					newInputSteps = append(newInputSteps, reached)
-					reached = shortcutGoal[reached]
-				}
-				newInputSteps[i].SetCorner(true)
-				newInputSteps[len(newInputSteps)-1].SetCorner(true)
-				newInputSteps = append(newInputSteps, inputSteps[j+1:]...)
-				inputSteps = newInputSteps
-			}
+// evaluateSmoothCandidate tries to connect inputSteps[j] back to inputSteps[i]. If the straight line between them is
+// valid it is interpolated directly, otherwise this falls back to a constrained extension. Only the candidate is written
+// to, so candidates may be evaluated concurrently.
+func (mp *cBiRRTMotionPlanner) evaluateSmoothCandidate(ctx context.Context, inputSteps []node, candidate *smoothCandidate) {
+	iSol := inputSteps[candidate.i]
+	jSol := inputSteps[candidate.j]
+	shortcutGoal := map[node]node{jSol: nil}
+
+	var reached node
+	if mp.straightLineValid(iSol, jSol) {
+		reached = interpolateTowards(mp.planOpts, shortcutGoal, jSol, iSol)
+	} else {
+		//nolint: gosec
+		randseed := rand.New(rand.NewSource(candidate.seed))
+		schan := make(chan node, 1)
+		mp.constrainedExtend(ctx, randseed, shortcutGoal, jSol, iSol, schan)
+		reached = <-schan
+	}
+
+	// Note this could technically replace paths with "longer" paths i.e. with more waypoints.
+	// However, smoothed paths are invariably more intuitive and smooth, and lend themselves to future shortening,
+	// so we allow elongation here.
+	dist := mp.planOpts.DistanceFunc(&ik.Segment{StartConfiguration: iSol.Q(), EndConfiguration: reached.Q()})
+	if dist < mp.planOpts.JointSolveDist {
+		candidate.reached = reached
+		candidate.shortcut = shortcutGoal
+	}
+}
+
+// straightLineValid is a cheap check of whether the direct motion between two nodes meets all constraints, in which
+// case no gradient descent is needed to connect them.
+func (mp *cBiRRTMotionPlanner) straightLineValid(from, to node) bool {
+	fromPos, err := mp.frame.Transform(from.Q())
+	if err != nil {
+		return false
+	}
+	toPos, err := mp.frame.Transform(to.Q())
+	if err != nil {
+		return false
+	}
+	ok, _ := mp.planOpts.CheckSegmentAndStateValidity(&ik.Segment{
+		StartPosition:      fromPos,
+		EndPosition:        toPos,
+		StartConfiguration: from.Q(),
+		EndConfiguration:   to.Q(),
+		Frame:              mp.frame,
+	}, mp.planOpts.Resolution)
+	return ok
+}
+
+// interpolateTowards steps from near to target along a straight line using the same step sizes constrainedExtend would,
+// recording each step in rrtMap. It returns the last node reached.
+func interpolateTowards(planOpts *plannerOptions, rrtMap map[node]node, near, target node) node {
+	for i := 0; i < maxExtendIter; i++ {
+		dist := planOpts.DistanceFunc(&ik.Segment{StartConfiguration: near.Q(), EndConfiguration: target.Q()})
+		if dist < planOpts.JointSolveDist {
+			break
 		}
+		newNear := &basicNode{q: fixedStepInterpolation(near, target, planOpts.qstep)}
+		rrtMap[newNear] = near
+		near = newNear
 	}
-	return inputSteps
+	return near
+}
+
+// applySmoothCandidates splices every successful shortcut into inputSteps in index order.
+func applySmoothCandidates(inputSteps []node, candidates []*smoothCandidate) []node {
+	sort.Slice(candidates, func(a, b int) bool { return candidates[a].i < candidates[b].i })
+
+	newInputSteps := make([]node, 0, len(inputSteps))
+	next := 0
+	for _, candidate := range candidates {
+		if candidate.reached == nil {
+			continue
+		}
+		for _, hitCorner := range candidate.hitCorners {
+			hitCorner.SetCorner(false)
+		}
+
+		newInputSteps = append(newInputSteps, inputSteps[next:candidate.i]...)
+		start := len(newInputSteps)
+		for reached := candidate.reached; reached != nil; reached = candidate.shortcut[reached] {
+			newInputSteps = append(newInputSteps, reached)
+		}
+		newInputSteps[start].SetCorner(true)
+		newInputSteps[len(newInputSteps)-1].SetCorner(true)
+		next = candidate.j + 1
+	}
+	return append(newInputSteps, inputSteps[next:]...)
 }
 
 // getFrameSteps will return a slice of positive values representing the largest amount a particular DOF of a frame should
@@ -109,3 +109,32 @@ func TestSimpleLinearMotion(t *testing.T) {
 	// Test that path has changed after smoothing was applied
 	test.That(t, finalSteps, test.ShouldNotResemble, inputSteps)
 }
+
+func TestApplySmoothCandidates(t *testing.T) {
+	path := []node{}
+	for i := 0; i < 10; i++ {
+		path = append(path, &basicNode{q: referenceframe.FloatsToInputs([]float64{float64(i)})})
+	}
+	path[3].SetCorner(true)
+	path[7].SetCorner(true)
+
+	// Shortcut path[1:5] with a two node chain that ends at path[4], and leave the failed candidate in place.
+	shortcutStart := &basicNode{q: referenceframe.FloatsToInputs([]float64{1.5})}
+	succeeded := &smoothCandidate{
+		i: 1, j: 4, hitCorners: []node{path[3]},
+		reached: shortcutStart, shortcut: map[node]node{shortcutStart: path[4], path[4]: nil},
+	}
+	failed := &smoothCandidate{i: 6, j: 8, hitCorners: []node{path[7]}}
+	test.That(t, overlapsAny(&smoothCandidate{i: 4, j: 6}, []*smoothCandidate{succeeded, failed}), test.ShouldBeTrue)
+	test.That(t, overlapsAny(&smoothCandidate{i: 5, j: 5}, []*smoothCandidate{succeeded, failed}), test.ShouldBeFalse)
+
+	// Candidates are applied in index order regardless of the order they are passed in.
+	smoothed := applySmoothCandidates(path, []*smoothCandidate{failed, succeeded})
+	test.That(t, len(smoothed), test.ShouldEqual, 8)
+	test.That(t, smoothed[:2], test.ShouldResemble, []node{path[0], shortcutStart})
+	test.That(t, smoothed[2:], test.ShouldResemble, path[4:])
+	test.That(t, path[3].Corner(), test.ShouldBeFalse)
+	test.That(t, path[7].Corner(), test.ShouldBeTrue)
+	test.That(t, shortcutStart.Corner(), test.ShouldBeTrue)
+	test.That(t, path[4].Corner(), test.ShouldBeTrue)
+}
@@ -26,6 +26,16 @@ func NewWithPrealloc(size int) PointCloud {
 	}
 }
 
+// newBasicPointCloudFromPoints returns a basicPointCloud of points at distinct positions, taking
+// ownership of the slice. The index of the points by position is only built if it is needed.
+func newBasicPointCloudFromPoints(points []PointAndData) *basicPointCloud {
+	meta := NewMetaData()
+	for _, p := range points {
+		meta.Merge(p.P, p.D)
+	}
+	return &basicPointCloud{points: &matrixStorage{points: points}, meta: meta}
+}
+
 func (cloud *basicPointCloud) Size() int {
 	return cloud.points.Size()
 }
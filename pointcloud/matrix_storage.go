@@ -7,11 +7,23 @@ import (
 )
 
 type matrixStorage struct {
-	mu       sync.RWMutex
-	points   []PointAndData
+	mu     sync.RWMutex
+	points []PointAndData
+	// indexMap is built on first use if nil.
 	indexMap map[r3.Vector]uint // TODO (aidanglickman): when r3.Vector has a hash method update this to save space
 }
 
+// buildIndex builds indexMap if it has not been yet. Hold the write lock to call this.
+func (ms *matrixStorage) buildIndex() {
+	if ms.indexMap != nil {
+		return
+	}
+	ms.indexMap = make(map[r3.Vector]uint, len(ms.points))
+	for i, p := range ms.points {
+		ms.indexMap[p.P] = uint(i)
+	}
+}
+
 func (ms *matrixStorage) Size() int {
 	ms.mu.RLock()
 	defer ms.mu.RUnlock()
@@ -30,6 +42,7 @@ func (ms *matrixStorage) Set(v r3.Vector, d Data) error {
 	if v.Z > maxPreciseFloat64 || v.Z < minPreciseFloat64 {
 		return newOutOfRangeErr("z", v.Z)
 	}
+	ms.buildIndex()
 	if i, found := ms.indexMap[v]; found {
 		ms.points[i].D = d
 	} else {
@@ -41,6 +54,13 @@ func (ms *matrixStorage) Set(v r3.Vector, d Data) error {
 
 func (ms *matrixStorage) At(x, y, z float64) (Data, bool) {
 	ms.mu.RLock()
+	if ms.indexMap == nil {
+		ms.mu.RUnlock()
+		ms.mu.Lock()
+		ms.buildIndex()
+		ms.mu.Unlock()
+		ms.mu.RLock()
+	}
 	defer ms.mu.RUnlock()
 	// TODO (aidanglickman): Update this whole function with the new hashing
 	v := r3.Vector{x, y, z}
@@ -0,0 +1,151 @@
+package pointcloud
+
+import (
+	"bufio"
+	"bytes"
+	"encoding/binary"
+	"fmt"
+	"math"
+	"strings"
+	"sync"
+
+	"github.com/golang/geo/r3"
+	"github.com/pkg/errors"
+	"go.viam.com/utils"
+
+	"go.viam.com/rdk/spatialmath"
+	rutils "go.viam.com/rdk/utils"
+)
+
+// pcdBinaryLayout is where the points of a binary PCD are in its bytes.
+type pcdBinaryLayout struct {
+	dataOffset int
+	stride     int
+	points     int
+}
+
+// binaryPCDLayout parses just the header of a PCD, and returns where its points are if it is a
+// binary PCD whose x, y and z fields are single float32s. ok is false for any other PCD.
+func binaryPCDLayout(pcd []byte) (layout pcdBinaryLayout, ok bool, err error) {
+	r := bytes.NewReader(pcd)
+	in := bufio.NewReader(r)
+	header, err := parsePCDHeader(in)
+	if err != nil {
+		return pcdBinaryLayout{}, false, err
+	}
+	if header.data != PCDBinary {
+		return pcdBinaryLayout{}, false, nil
+	}
+	for i := 0; i < 3; i++ {
+		if header.size[i] != 4 || header.count[i] != 1 {
+			return pcdBinaryLayout{}, false, nil
+		}
+	}
+	stride := 0
+	for i := range header.size {
+		stride += int(header.size[i] * header.count[i])
+	}
+
+	layout = pcdBinaryLayout{
+		dataOffset: len(pcd) - r.Len() - in.Buffered(),
+		stride:     stride,
+		points:     int(header.points),
+	}
+	if len(pcd)-layout.dataOffset < layout.points*layout.stride {
+		// The PCD is truncated. Leave it to the decoder to read what there is of it.
+		return pcdBinaryLayout{}, false, nil
+	}
+	return layout, true, nil
+}
+
+// TransformBinaryPCD applies pose, whose translation is in millimeters, to every point of a binary
+// PCD, rewriting the x, y and z fields of pcd in place. Only the header is parsed: the other
+// fields of each point and the header itself are left untouched, so the cost is a single pass over
+// the points, split across goroutines. It returns false without modifying pcd if the PCD is not
+// binary or its x, y and z fields are not single float32s, in which case decode it with ReadPCD
+// instead.
+func TransformBinaryPCD(pcd []byte, pose spatialmath.Pose) (bool, error) {
+	layout, ok, err := binaryPCDLayout(pcd)
+	if !ok || err != nil {
+		return false, err
+	}
+
+	rot := pose.Orientation().RotationMatrix()
+	// Converts RDK units (millimeters) to meters for PCD
+	translation := pose.Point().Mul(1. / 1000.)
+
+	data := pcd[layout.dataOffset : layout.dataOffset+layout.points*layout.stride]
+	numGroups := rutils.ParallelFactor
+	if numGroups > layout.points {
+		numGroups = 1
+	}
+	groupSize := (layout.points + numGroups - 1) / numGroups
+	var wg sync.WaitGroup
+	for from := 0; from < layout.points; from += groupSize {
+		to := from + groupSize
+		if to > layout.points {
+			to = layout.points
+		}
+		group := data[from*layout.stride : to*layout.stride]
+		wg.Add(1)
+		utils.PanicCapturingGo(func() {
+			defer wg.Done()
+			transformPCDPoints(group, layout.stride, rot, translation)
+		})
+	}
+	wg.Wait()
+	return true, nil
+}
+
+// transformPCDPoints rotates and then translates the point at the start of every stride bytes of
+// data.
+func transformPCDPoints(data []byte, stride int, rot *spatialmath.RotationMatrix, translation r3.Vector) {
+	for off := 0; off+12 <= len(data); off += stride {
+		pt := data[off : off+12]
+		p := r3.Vector{
+			X: float64(math.Float32frombits(binary.LittleEndian.Uint32(pt))),
+			Y: float64(math.Float32frombits(binary.LittleEndian.Uint32(pt[4:]))),
+			Z: float64(math.Float32frombits(binary.LittleEndian.Uint32(pt[8:]))),
+		}
+		p = rot.Mul(p).Add(translation)
+		binary.LittleEndian.PutUint32(pt, math.Float32bits(float32(p.X)))
+		binary.LittleEndian.PutUint32(pt[4:], math.Float32bits(float32(p.Y)))
+		binary.LittleEndian.PutUint32(pt[8:], math.Float32bits(float32(p.Z)))
+	}
+}
+
+// SetPCDViewpoint returns a copy of a PCD whose VIEWPOINT is composed with pose, whose translation
+// is in millimeters. None of the points are touched, so this only has the effect of transforming
+// the cloud for readers that apply the VIEWPOINT to its points, which ReadPCD does not.
+func SetPCDViewpoint(pcd []byte, pose spatialmath.Pose) ([]byte, error) {
+	r := bytes.NewReader(pcd)
+	in := bufio.NewReader(r)
+	header, err := parsePCDHeader(in)
+	if err != nil {
+		return nil, err
+	}
+	headerLen := len(pcd) - r.Len() - in.Buffered()
+
+	for lineStart := 0; lineStart < headerLen; {
+		lineLen := bytes.IndexByte(pcd[lineStart:headerLen], '\n') + 1
+		if lineLen == 0 {
+			break
+		}
+		lineEnd := lineStart + lineLen
+		if strings.HasPrefix(string(pcd[lineStart:lineEnd]), "VIEWPOINT") {
+			// Converts RDK units (millimeters) to meters for PCD
+			offset := spatialmath.NewPose(pose.Point().Mul(1./1000.), pose.Orientation())
+			viewpoint := spatialmath.Compose(offset, header.viewpoint)
+			pt := viewpoint.Point()
+			q := viewpoint.Orientation().Quaternion()
+			line := fmt.Sprintf("VIEWPOINT %g %g %g %g %g %g %g\n", pt.X, pt.Y, pt.Z, q.Real, q.Imag, q.Jmag, q.Kmag)
+
+			out := make([]byte, 0, len(pcd)-(lineEnd-lineStart)+len(line))
+			out = append(out, pcd[:lineStart]...)
+			out = append(out, line...)
+			return append(out, pcd[lineEnd:]...), nil
+		}
+		lineStart = lineEnd
+	}
+	return nil, errors.New("no VIEWPOINT in pcd header")
+}
@@ -0,0 +1,65 @@
+package pointcloud
+
+import (
+	"bufio"
+	"bytes"
+	"image/color"
+	"testing"
+
+	"github.com/golang/geo/r3"
+	"go.viam.com/test"
+
+	"go.viam.com/rdk/spatialmath"
+)
+
+func testPCDForTransform(t *testing.T, outputType PCDType) []byte {
+	t.Helper()
+	cloud := New()
+	test.That(t, cloud.Set(NewVector(1000, 0, 0), NewColoredData(color.NRGBA{255, 0, 0, 255})), test.ShouldBeNil)
+	test.That(t, cloud.Set(NewVector(0, 2000, 0), NewColoredData(color.NRGBA{0, 0, 255, 255})), test.ShouldBeNil)
+	var buf bytes.Buffer
+	test.That(t, ToPCD(cloud, &buf, outputType), test.ShouldBeNil)
+	return buf.Bytes()
+}
+
+func TestTransformBinaryPCD(t *testing.T) {
+	pose := spatialmath.NewPose(r3.Vector{X: 1000}, &spatialmath.OrientationVectorDegrees{OZ: 1, Theta: 90})
+
+	pcd := testPCDForTransform(t, PCDBinary)
+	ok, err := TransformBinaryPCD(pcd, pose)
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, ok, test.ShouldBeTrue)
+
+	cloud, err := ReadPCD(bytes.NewReader(pcd))
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, cloud.Size(), test.ShouldEqual, 2)
+	d, got := cloud.At(1000, 1000, 0)
+	test.That(t, got, test.ShouldBeTrue)
+	test.That(t, d.Color(), test.ShouldResemble, color.NRGBA{255, 0, 0, 255})
+	d, got = cloud.At(-1000, 0, 0)
+	test.That(t, got, test.ShouldBeTrue)
+	test.That(t, d.Color(), test.ShouldResemble, color.NRGBA{0, 0, 255, 255})
+
+	// ASCII PCDs are left for the decoder.
+	pcd = testPCDForTransform(t, PCDAscii)
+	orig := append([]byte{}, pcd...)
+	ok, err = TransformBinaryPCD(pcd, pose)
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, ok, test.ShouldBeFalse)
+	test.That(t, pcd, test.ShouldResemble, orig)
+}
+
+func TestSetPCDViewpoint(t *testing.T) {
+	pcd := testPCDForTransform(t, PCDBinary)
+	pose := spatialmath.NewPose(r3.Vector{X: 1000}, &spatialmath.OrientationVectorDegrees{OZ: 1, Theta: 90})
+	out, err := SetPCDViewpoint(pcd, pose)
+	test.That(t, err, test.ShouldBeNil)
+
+	header, err := parsePCDHeader(bufio.NewReader(bytes.NewReader(out)))
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, spatialmath.PoseAlmostEqual(header.viewpoint,
+		spatialmath.NewPose(r3.Vector{X: 1}, pose.Orientation())), test.ShouldBeTrue)
+
+	// The points are untouched.
+	test.That(t, out[len(out)-32:], test.ShouldResemble, pcd[len(pcd)-32:])
+}
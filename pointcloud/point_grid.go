@@ -0,0 +1,201 @@
+package pointcloud
+
+import (
+	"math"
+
+	"github.com/golang/geo/r3"
+
+	"go.viam.com/rdk/utils"
+)
+
+// maxGridCellsPerPoint bounds the memory of a pointGrid for very sparse clouds.
+const maxGridCellsPerPoint = 4
+
+// pointGrid bins points into a uniform grid of cubic cells, stored flat: the indices of the points
+// in cell c are order[cellStart[c]:cellStart[c+1]].
+type pointGrid struct {
+	points    []r3.Vector
+	min       r3.Vector
+	cellSize  float64
+	dims      [3]int
+	cellStart []int
+	order     []int
+}
+
+// newPointGrid bins points into cells sized so that each holds about perCell points, given the
+// density of the points over the dimensions they span.
+func newPointGrid(points []r3.Vector, perCell int) *pointGrid {
+	g := &pointGrid{points: points, cellSize: 1}
+	if len(points) == 0 {
+		g.cellStart = []int{0, 0}
+		g.dims = [3]int{1, 1, 1}
+		return g
+	}
+	minPt, maxPt := points[0], points[0]
+	for _, p := range points[1:] {
+		minPt = r3.Vector{math.Min(minPt.X, p.X), math.Min(minPt.Y, p.Y), math.Min(minPt.Z, p.Z)}
+		maxPt = r3.Vector{math.Max(maxPt.X, p.X), math.Max(maxPt.Y, p.Y), math.Max(maxPt.Z, p.Z)}
+	}
+	g.min = minPt
+	extent := maxPt.Sub(minPt)
+
+	// A depth cloud is mostly a surface, so only count the dimensions the points actually span.
+	volume, spanned := 1.0, 0
+	for _, e := range []float64{extent.X, extent.Y, extent.Z} {
+		if e > 0 {
+			volume *= e
+			spanned++
+		}
+	}
+	if spanned > 0 {
+		g.cellSize = math.Pow(volume*float64(perCell)/float64(len(points)), 1/float64(spanned))
+	}
+	maxCells := float64(maxGridCellsPerPoint*len(points) + 1)
+	for {
+		cells := 1.0
+		for a, e := range []float64{extent.X, extent.Y, extent.Z} {
+			g.dims[a] = int(e/g.cellSize) + 1
+			cells *= float64(g.dims[a])
+		}
+		if cells <= maxCells {
+			break
+		}
+		g.cellSize *= math.Pow(cells/maxCells, 1/float64(spanned))
+	}
+
+	// counting sort of the points by cell
+	cellOf := make([]int, len(points))
+	g.cellStart = make([]int, g.dims[0]*g.dims[1]*g.dims[2]+1)
+	for i, p := range points {
+		cellOf[i] = g.cellIndex(g.cell(p))
+		g.cellStart[cellOf[i]+1]++
+	}
+	for c := 1; c < len(g.cellStart); c++ {
+		g.cellStart[c] += g.cellStart[c-1]
+	}
+	next := append([]int{}, g.cellStart[:len(g.cellStart)-1]...)
+	g.order = make([]int, len(points))
+	for i, c := range cellOf {
+		g.order[next[c]] = i
+		next[c]++
+	}
+	return g
+}
+
+func (g *pointGrid) cell(p r3.Vector) [3]int {
+	offset := p.Sub(g.min)
+	cell := [3]int{int(offset.X / g.cellSize), int(offset.Y / g.cellSize), int(offset.Z / g.cellSize)}
+	for a := range cell {
+		if cell[a] >= g.dims[a] {
+			cell[a] = g.dims[a] - 1
+		}
+	}
+	return cell
+}
+
+func (g *pointGrid) cellIndex(cell [3]int) int {
+	return (cell[2]*g.dims[1]+cell[1])*g.dims[0] + cell[0]
+}
+
+// meanNeighborDistance returns the mean distance from point i to its k nearest other points. It
+// searches the shells of cells around the point's cell outwards, until no point in a further shell
+// could be nearer than the k found so far. nearest is scratch space for k distances.
+func (g *pointGrid) meanNeighborDistance(i, k int, nearest *maxDistHeap) float64 {
+	p := g.points[i]
+	center := g.cell(p)
+	nearest.reset(k)
+	maxRing := utils.MaxInt(g.dims[0], utils.MaxInt(g.dims[1], g.dims[2]))
+	visit := func(cell [3]int) {
+		c := g.cellIndex(cell)
+		for _, j := range g.order[g.cellStart[c]:g.cellStart[c+1]] {
+			if j != i {
+				nearest.push(p.Sub(g.points[j]).Norm2())
+			}
+		}
+	}
+	for ring := 0; ring < maxRing; ring++ {
+		lo, hi := [3]int{}, [3]int{}
+		for a := range center {
+			lo[a], hi[a] = center[a]-ring, center[a]+ring
+		}
+		for z := utils.MaxInt(lo[2], 0); z <= utils.MinInt(hi[2], g.dims[2]-1); z++ {
+			for y := utils.MaxInt(lo[1], 0); y <= utils.MinInt(hi[1], g.dims[1]-1); y++ {
+				if z != lo[2] && z != hi[2] && y != lo[1] && y != hi[1] {
+					// only the two ends of this row are on the shell
+					if lo[0] >= 0 {
+						visit([3]int{lo[0], y, z})
+					}
+					if hi[0] != lo[0] && hi[0] < g.dims[0] {
+						visit([3]int{hi[0], y, z})
+					}
+					continue
+				}
+				for x := utils.MaxInt(lo[0], 0); x <= utils.MinInt(hi[0], g.dims[0]-1); x++ {
+					visit([3]int{x, y, z})
+				}
+			}
+		}
+		// any point outside of this ring is at least ring cells away along some axis
+		if bound := float64(ring) * g.cellSize; nearest.full() && nearest.max() <= bound*bound {
+			break
+		}
+	}
+
+	sumDist := 0.0
+	for _, d := range nearest.dists {
+		sumDist += math.Sqrt(d)
+	}
+	return sumDist / float64(len(nearest.dists))
+}
+
+// maxDistHeap keeps the k smallest squared distances pushed to it, as a max-heap.
+type maxDistHeap struct {
+	k     int
+	dists []float64
+}
+
+func (h *maxDistHeap) reset(k int) {
+	h.k = k
+	h.dists = h.dists[:0]
+}
+
+func (h *maxDistHeap) full() bool {
+	return len(h.dists) == h.k
+}
+
+func (h *maxDistHeap) max() float64 {
+	return h.dists[0]
+}
+
+func (h *maxDistHeap) push(d float64) {
+	if len(h.dists) < h.k {
+		h.dists = append(h.dists, d)
+		for i := len(h.dists) - 1; i > 0; {
+			parent := (i - 1) / 2
+			if h.dists[parent] >= h.dists[i] {
+				break
+			}
+			h.dists[parent], h.dists[i] = h.dists[i], h.dists[parent]
+			i = parent
+		}
+		return
+	}
+	if d >= h.dists[0] {
+		return
+	}
+	h.dists[0] = d
+	for i := 0; ; {
+		largest := i
+		if left := 2*i + 1; left < len(h.dists) && h.dists[left] > h.dists[largest] {
+			largest = left
+		}
+		if right := 2*i + 2; right < len(h.dists) && h.dists[right] > h.dists[largest] {
+			largest = right
+		}
+		if largest == i {
+			return
+		}
+		h.dists[i], h.dists[largest] = h.dists[largest], h.dists[i]
+		i = largest
+	}
+}
@@ -8,6 +8,7 @@ import (
 	"gonum.org/v1/gonum/stat"
 
 	"go.viam.com/rdk/spatialmath"
+	"go.viam.com/rdk/utils"
 )
 
 // BoundingBoxFromPointCloud returns a Geometry object that encompasses all the points in the given point cloud.
@@ -44,9 +45,15 @@ func PrunePointClouds(clouds []PointCloud, nMin int) []PointCloud {
 	return pruned
 }
 
+// statisticalOutlierChunk is how many points each worker of StatisticalOutlierFilter takes at a time.
+const statisticalOutlierChunk = 1024
+
 // StatisticalOutlierFilter implements the function from PCL to remove noisy points from a point cloud.
 // https://pcl.readthedocs.io/projects/tutorials/en/latest/statistical_outlier.html
 // This returns a function that can be used to filter on point clouds.
+// The points are binned into a uniform grid sized to hold about meanK points per cell, and the mean
+// distance from each point to its meanK nearest neighbors is found by searching the cells around it,
+// split across goroutines.
 // NOTE(bh): Returns a new point cloud, but could be modified to filter and change the original point cloud.
 func StatisticalOutlierFilter(meanK int, stdDevThresh float64) (func(PointCloud) (PointCloud, error), error) {
 	if meanK <= 0 {
@@ -56,38 +63,36 @@ func StatisticalOutlierFilter(meanK int, stdDevThresh float64) (func(PointCloud)
 		return nil, errors.Errorf("argument stdDevThresh must be a positive float, got %.2f", stdDevThresh)
 	}
 	filterFunc := func(pc PointCloud) (PointCloud, error) {
-		// create data type that can do nearest neighbors
-		kd, ok := pc.(*KDTree)
-		if !ok {
-			kd = ToKDTree(pc)
-		}
-		// get the statistical information
-		avgDistances := make([]float64, 0, kd.Size())
-		points := make([]PointAndData, 0, kd.Size())
-		kd.Iterate(0, 0, func(v r3.Vector, d Data) bool {
-			neighbors := kd.KNearestNeighbors(v, meanK, false)
-			sumDist := 0.0
-			for _, p := range neighbors {
-				sumDist += v.Distance(p.P)
-			}
-			avgDistances = append(avgDistances, sumDist/float64(len(neighbors)))
+		points := make([]PointAndData, 0, pc.Size())
+		vectors := make([]r3.Vector, 0, pc.Size())
+		pc.Iterate(0, 0, func(v r3.Vector, d Data) bool {
 			points = append(points, PointAndData{v, d})
+			vectors = append(vectors, v)
 			return true
 		})
 
+		// get the statistical information
+		grid := newPointGrid(vectors, meanK+1)
+		avgDistances := make([]float64, len(points))
+		numChunks := (len(points) + statisticalOutlierChunk - 1) / statisticalOutlierChunk
+		utils.ParallelForEachRow(numChunks, func(chunk int) {
+			var nearest maxDistHeap
+			end := utils.MinInt((chunk+1)*statisticalOutlierChunk, len(points))
+			for i := chunk * statisticalOutlierChunk; i < end; i++ {
+				avgDistances[i] = grid.meanNeighborDistance(i, meanK, &nearest)
+			}
+		})
+
 		mean, stddev := stat.MeanStdDev(avgDistances, nil)
 		threshold := mean + stdDevThresh*stddev
-		// filter using the statistical information
-		filteredCloud := New()
-		for i := 0; i < len(avgDistances); i++ {
+		// filter using the statistical information, keeping the points in place
+		kept := points[:0]
+		for i, p := range points {
 			if avgDistances[i] < threshold {
-				err := filteredCloud.Set(points[i].P, points[i].D)
-				if err != nil {
-					return nil, err
-				}
+				kept = append(kept, p)
 			}
 		}
-		return filteredCloud, nil
+		return newBasicPointCloudFromPoints(kept), nil
 	}
 	return filterFunc, nil
 }
@@ -1,6 +1,9 @@
 package pointcloud
 
 import (
+	"image/color"
+	"math"
+	"math/rand"
 	"testing"
 
 	"github.com/golang/geo/r3"
@@ -70,3 +73,69 @@ func TestPrune(t *testing.T) {
 	test.That(t, len(clouds), test.ShouldEqual, 1)
 	test.That(t, clouds[0].Size(), test.ShouldEqual, 5)
 }
+
+// makeNoisySurface returns a noisy bumpy surface of n points, with a few points scattered far
+// off of it.
+func makeNoisySurface(n int) PointCloud {
+	r := rand.New(rand.NewSource(0))
+	cloud := NewWithPrealloc(n)
+	for cloud.Size() < n {
+		var p r3.Vector
+		if r.Intn(50) == 0 {
+			p = r3.Vector{r.Float64() * 1000, r.Float64() * 1000, r.Float64() * 1000}
+		} else {
+			x, y := r.Float64()*1000, r.Float64()*1000
+			p = r3.Vector{x, y, 500 + 20*math.Sin(x/100) + r.NormFloat64()}
+		}
+		cloud.Set(p, NewColoredData(color.NRGBA{uint8(r.Intn(256)), 0, 0, 255}))
+	}
+	return cloud
+}
+
+func TestStatisticalOutlierFilterGrid(t *testing.T) {
+	// A 10x10 grid of points one apart, and three points far from it and from each other.
+	cloud := New()
+	for x := 0; x < 10; x++ {
+		for y := 0; y < 10; y++ {
+			test.That(t, cloud.Set(NewVector(float64(x), float64(y), 0),
+				NewColoredData(color.NRGBA{uint8(x), uint8(y), 0, 255})), test.ShouldBeNil)
+		}
+	}
+	for _, p := range []r3.Vector{{1000, 0, 0}, {0, 1000, 0}, {0, 0, 1000}} {
+		test.That(t, cloud.Set(p, nil), test.ShouldBeNil)
+	}
+
+	for _, meanK := range []int{1, 4, 16} {
+		filter, err := StatisticalOutlierFilter(meanK, 1.0)
+		test.That(t, err, test.ShouldBeNil)
+		filtered, err := filter(cloud)
+		test.That(t, err, test.ShouldBeNil)
+
+		// only the far points are removed, and the grid keeps its data
+		test.That(t, filtered.Size(), test.ShouldEqual, 100)
+		filtered.Iterate(0, 0, func(p r3.Vector, d Data) bool {
+			test.That(t, p.Z, test.ShouldEqual, 0)
+			test.That(t, d, test.ShouldResemble, NewColoredData(color.NRGBA{uint8(p.X), uint8(p.Y), 0, 255}))
+			return true
+		})
+	}
+
+	// a cloud of one point has no neighbors to measure
+	single := New()
+	test.That(t, single.Set(NewVector(1, 2, 3), nil), test.ShouldBeNil)
+	filter, err := StatisticalOutlierFilter(3, 1.0)
+	test.That(t, err, test.ShouldBeNil)
+	filtered, err := filter(single)
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, filtered.Size(), test.ShouldEqual, 0)
+}
+
+func BenchmarkStatisticalOutlierFilter(b *testing.B) {
+	cloud := makeNoisySurface(100000)
+	filter, err := StatisticalOutlierFilter(16, 1.0)
+	test.That(b, err, test.ShouldBeNil)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		filter(cloud)
+	}
+}
@@ -11,6 +11,8 @@ import (
 	"go-hep.org/x/hep/hbook"
 	"go-hep.org/x/hep/hplot"
 	vecg "gonum.org/v1/plot/vg"
+
+	"go.viam.com/rdk/utils"
 )
 
 /* In this file are functions to create a Voxel, a Voxel Grid from a point cloud
@@ -457,6 +459,8 @@ func (vg *VoxelGrid) ConvertToPointCloudWithValue() (PointCloud, error) {
 }
 
 // NewVoxelGridFromPointCloud creates and fills a VoxelGrid from a point cloud.
+// The positions of the points are also gathered into one slice, contiguous per voxel, and the
+// plane of each voxel is fit from its range of it in parallel.
 func NewVoxelGridFromPointCloud(pc PointCloud, voxelSize, lam float64) *VoxelGrid {
 	meta := pc.MetaData()
 	voxelMap := NewVoxelGrid(voxelSize, lam)
@@ -468,13 +472,25 @@ func NewVoxelGridFromPointCloud(pc PointCloud, voxelSize, lam float64) *VoxelGri
 
 	defaultResidual := 1.0
 
+	// voxels holds the voxels of voxelMap in creation order, and pointVoxel the index in it of the
+	// voxel of each point
+	voxels := make([]*Voxel, 0, len(voxelMap.Voxels))
+	voxelIndex := make(map[VoxelCoords]int, len(voxelMap.Voxels))
+	for k, vox := range voxelMap.Voxels {
+		voxelIndex[k] = len(voxels)
+		voxels = append(voxels, vox)
+	}
+	points := make([]r3.Vector, 0, pc.Size())
+	pointVoxel := make([]int, 0, pc.Size())
 	pc.Iterate(0, 0, func(pt r3.Vector, d Data) bool {
 		coords := GetVoxelCoordinates(pt, ptMin, voxelSize)
-		vox, ok := voxelMap.Voxels[coords]
+		idx, ok := voxelIndex[coords]
 		// if voxel key does not exist yet, create voxel at this key with current point, voxel coordinates and maximum
 		// possible residual for planes
 		if !ok {
-			voxelMap.Voxels[coords] = &Voxel{
+			idx = len(voxels)
+			voxelIndex[coords] = idx
+			vox := &Voxel{
 				Key:             coords,
 				Label:           0,
 				Points:          map[r3.Vector]Data{pt: d},
@@ -486,30 +502,47 @@ func NewVoxelGridFromPointCloud(pc PointCloud, voxelSize, lam float64) *VoxelGri
 				SortedWeightIdx: 0,
 				PointLabels:     nil,
 			}
+			voxels = append(voxels, vox)
+			voxelMap.Voxels[coords] = vox
 		} else {
 			// if voxel coordinates is in the keys of voxelMap, add point to slice
-			vox.Points[pt] = d
+			voxels[idx].Points[pt] = d
 		}
+		points = append(points, pt)
+		pointVoxel = append(pointVoxel, idx)
 		return true
 	})
 
+	// sort the positions by voxel, so that the positions of voxel i are
+	// positions[voxelStart[i]:voxelStart[i+1]]
+	voxelStart := make([]int, len(voxels)+1)
+	for _, idx := range pointVoxel {
+		voxelStart[idx+1]++
+	}
+	for i := 1; i < len(voxelStart); i++ {
+		voxelStart[i] += voxelStart[i-1]
+	}
+	next := append([]int{}, voxelStart[:len(voxels)]...)
+	positions := make([]r3.Vector, len(points))
+	for i, idx := range pointVoxel {
+		positions[next[idx]] = points[i]
+		next[idx]++
+	}
+
 	// All points are now assigned to a voxel in the voxel grid
 	// Compute voxel attributes
-	for k, vox := range voxelMap.Voxels {
-		// Voxel must have enough point to make relevant computations
-		vox.Key = k
-		center := GetVoxelCenter(vox.Positions())
-		vox.Center.X = center.X
-		vox.Center.Y = center.Y
-		vox.Center.Z = center.Z
+	utils.ParallelForEachRow(len(voxels), func(i int) {
+		vox := voxels[i]
+		voxPositions := positions[voxelStart[i]:voxelStart[i+1]]
+		vox.Center = GetVoxelCenter(voxPositions)
 
 		// below 5 points, normal and center estimation are not relevant
-		if len(vox.Points) > 5 {
-			vox.Normal = estimatePlaneNormalFromPoints(vox.Positions())
+		if len(voxPositions) > 5 {
+			vox.Normal = estimatePlaneNormalFromPoints(voxPositions)
 			vox.Offset = GetOffset(vox.Center, vox.Normal)
-			vox.Residual = GetResidual(vox.Positions(), vox.GetPlane())
-			vox.Weight = GetWeight(vox.Positions(), lam, vox.Residual)
+			vox.Residual = GetResidual(voxPositions, &voxelPlane{normal: vox.Normal, offset: vox.Offset})
+			vox.Weight = GetWeight(voxPositions, lam, vox.Residual)
 		}
-	}
+	})
 	return voxelMap
 }
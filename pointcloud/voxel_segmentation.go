@@ -1,60 +1,119 @@
 package pointcloud
 
 import (
-	"container/list"
 	"sort"
 
 	"github.com/golang/geo/r3"
-
-	"go.viam.com/rdk/utils"
 )
 
+// voxelNeighborOffsets are the offsets to the 26-connected neighbors of a voxel, in the order
+// GetAdjacentVoxels returns them.
+var voxelNeighborOffsets = func() []VoxelCoords {
+	offsets := make([]VoxelCoords, 0, 26)
+	for i := int64(-1); i <= 1; i++ {
+		for j := int64(-1); j <= 1; j++ {
+			for k := int64(-1); k <= 1; k++ {
+				if i != 0 || j != 0 || k != 0 {
+					offsets = append(offsets, VoxelCoords{i, j, k})
+				}
+			}
+		}
+	}
+	return offsets
+}()
+
+// voxelArray is a flat view of the voxels of a VoxelGrid, in which voxels are referred to by their
+// index. The indices of the neighbors of voxel i are neighbors[neighborStart[i]:neighborStart[i+1]].
+type voxelArray struct {
+	voxels        VoxelSlice
+	index         map[VoxelCoords]int
+	neighborStart []int
+	neighbors     []int
+}
+
+// newVoxelArray indexes the given voxels, and finds their neighbors amongst them.
+func newVoxelArray(voxels VoxelSlice) *voxelArray {
+	va := &voxelArray{
+		voxels:        voxels,
+		index:         make(map[VoxelCoords]int, len(voxels)),
+		neighborStart: make([]int, len(voxels)+1),
+	}
+	for i, vox := range voxels {
+		va.index[vox.Key] = i
+	}
+	for i, vox := range voxels {
+		for _, offset := range voxelNeighborOffsets {
+			c := VoxelCoords{vox.Key.I + offset.I, vox.Key.J + offset.J, vox.Key.K + offset.K}
+			if nb, ok := va.index[c]; ok {
+				va.neighbors = append(va.neighbors, nb)
+			}
+		}
+		va.neighborStart[i+1] = len(va.neighbors)
+	}
+	return va
+}
+
+// voxelSlice returns all of the voxels of vg.
+func (vg *VoxelGrid) voxelSlice() VoxelSlice {
+	s := make(VoxelSlice, 0, len(vg.Voxels))
+	for _, vox := range vg.Voxels {
+		s = append(s, vox)
+	}
+	return s
+}
+
 // LabelVoxels performs voxel plane labeling
 // If a voxel contains points from one plane, voxel propagation is done to the neighboring voxels that are also planar
 // and share the same plane equation.
 func (vg *VoxelGrid) LabelVoxels(sortedKeys []VoxelCoords, wTh, thetaTh, phiTh float64) {
-	currentLabel := 1
-	visited := make(map[VoxelCoords]bool)
-	// nZeroWeight := 0
+	va := newVoxelArray(vg.voxelSlice())
+	seeds := make([]int, 0, len(sortedKeys))
 	for _, k := range sortedKeys {
+		if i, ok := va.index[k]; ok {
+			seeds = append(seeds, i)
+		}
+	}
+	vg.labelVoxels(va, seeds, wTh, thetaTh, phiTh)
+}
+
+// labelVoxels labels the connected components grown from each of the seeds in turn.
+func (vg *VoxelGrid) labelVoxels(va *voxelArray, seeds []int, wTh, thetaTh, phiTh float64) {
+	currentLabel := 1
+	visited := make([]bool, len(va.voxels))
+	queue := make([]int, 0, len(va.voxels))
+	for _, i := range seeds {
+		vox := va.voxels[i]
 		// If current voxel has a weight above threshold (plane data is relevant)
 		// and has not been visited yet
-		if vg.Voxels[k].Weight > wTh && !visited[k] && vg.Voxels[k].Label == 0 {
+		if vox.Weight > wTh && !visited[i] && vox.Label == 0 {
 			// BFS traversal
-			vg.labelComponentBFS(vg.Voxels[k], currentLabel, wTh, thetaTh, phiTh, visited)
+			queue = va.labelComponentBFS(i, currentLabel, wTh, thetaTh, phiTh, visited, queue[:0])
 			vg.maxLabel = currentLabel
 			currentLabel++
 		}
 	}
 }
 
-// labelComponentBFS is a helper function to perform BFS per connected component.
-func (vg *VoxelGrid) labelComponentBFS(vox *Voxel, label int, wTh, thetaTh, phiTh float64, visited map[VoxelCoords]bool) {
-	queue := list.New()
-	queue.PushBack(vox.Key)
-	visited[vox.Key] = true
-	for queue.Len() > 0 {
-		e := queue.Front() // First element
-		coords, err := utils.AssertType[VoxelCoords](e.Value)
-		if err != nil {
-			panic(err)
-		}
+// labelComponentBFS is a helper function to perform BFS per connected component. It returns queue,
+// which is only used as scratch space.
+func (va *voxelArray) labelComponentBFS(start, label int, wTh, thetaTh, phiTh float64, visited []bool, queue []int) []int {
+	queue = append(queue, start)
+	visited[start] = true
+	for head := 0; head < len(queue); head++ {
+		vox := va.voxels[queue[head]]
 		// Set label of Voxel
-		vg.Voxels[coords].SetLabel(label)
-		// Add current key to visited set
-		// Get adjacent voxels
-		neighbors := vg.GetAdjacentVoxels(vg.Voxels[coords])
-		for _, c := range neighbors {
+		vox.SetLabel(label)
+		for _, nb := range va.neighbors[va.neighborStart[queue[head]]:va.neighborStart[queue[head]+1]] {
 			// if pair voxels satisfies smoothness and continuity constraints and
 			// neighbor voxel plane data is relevant enough
 			// and neighbor is not visited yet
-			if vg.Voxels[coords].CanMerge(vg.Voxels[c], thetaTh, phiTh) && vg.Voxels[c].Weight > wTh && !visited[c] {
-				queue.PushBack(c)
-				visited[c] = true
+			if !visited[nb] && va.voxels[nb].Weight > wTh && vox.CanMerge(va.voxels[nb], thetaTh, phiTh) {
+				queue = append(queue, nb)
+				visited[nb] = true
 			}
 		}
-		queue.Remove(e)
 	}
+	return queue
 }
 
 // GetUnlabeledVoxels gathers in a slice all voxels whose label is 0.
@@ -143,16 +202,26 @@ func (vg *VoxelGrid) GetPlanesFromLabels() ([]Plane, PointCloud, error) {
 // if a voxel contains no plane, the minimum distance of a point to one of the surrounding plane should be above
 // the threshold dTh.
 func (vg *VoxelGrid) LabelNonPlanarVoxels(unlabeledVoxels []VoxelCoords, dTh float64) {
+	va := newVoxelArray(vg.voxelSlice())
+	unlabeled := make([]int, 0, len(unlabeledVoxels))
 	for _, k := range unlabeledVoxels {
-		vox := vg.Voxels[k]
+		if i, ok := va.index[k]; ok {
+			unlabeled = append(unlabeled, i)
+		}
+	}
+	va.labelNonPlanarVoxels(unlabeled, dTh)
+}
+
+func (va *voxelArray) labelNonPlanarVoxels(unlabeled []int, dTh float64) {
+	for _, v := range unlabeled {
+		vox := va.voxels[v]
 		vox.PointLabels = make([]int, len(vox.Points))
-		nbVoxels := vg.GetAdjacentVoxels(vox)
 		plane := vox.GetPlane()
 		for i, pt := range vox.Positions() {
 			dMin := 100000.0
 			outLabel := 0
-			for _, nb := range nbVoxels {
-				voxNb := vg.Voxels[nb]
+			for _, nb := range va.neighbors[va.neighborStart[v]:va.neighborStart[v+1]] {
+				voxNb := va.voxels[nb]
 				if voxNb.Label > 0 {
 					d := plane.Distance(pt)
 					if d < dMin {
@@ -190,10 +259,22 @@ func (vg *VoxelGrid) GetKeysByDecreasingOrderWeights() []VoxelCoords {
 // This segmentation only takes into account the coordinates of the points.
 func (vg *VoxelGrid) SegmentPlanesRegionGrowing(wTh, thetaTh, phiTh, dTh float64) {
 	// Sort voxels by decreasing order of relevance weights
-	decreasingKeys := vg.GetKeysByDecreasingOrderWeights()
+	voxels := vg.voxelSlice()
+	sort.Sort(voxels)
+	ReverseVoxelSlice(voxels)
+	va := newVoxelArray(voxels)
+	seeds := make([]int, len(va.voxels))
+	for i := range seeds {
+		seeds[i] = i
+	}
 	// Planar voxels labeling by region growing
-	vg.LabelVoxels(decreasingKeys, wTh, thetaTh, phiTh)
+	vg.labelVoxels(va, seeds, wTh, thetaTh, phiTh)
 	// For remaining voxels, labels points that are likely to belong to a plane
-	unlabeledVoxels := vg.GetUnlabeledVoxels()
-	vg.LabelNonPlanarVoxels(unlabeledVoxels, dTh)
+	unlabeled := make([]int, 0, len(va.voxels))
+	for i, vox := range va.voxels {
+		if vox.Label == 0 {
+			unlabeled = append(unlabeled, i)
+		}
+	}
+	va.labelNonPlanarVoxels(unlabeled, dTh)
 }
@@ -88,3 +88,40 @@ func TestVoxelPlaneSegmentationCube(t *testing.T) {
 	// Labeling should find 6 planes
 	test.That(t, vg.maxLabel, test.ShouldEqual, 6)
 }
+
+func TestVoxelArrayNeighbors(t *testing.T) {
+	voxels := VoxelSlice{
+		NewVoxel(VoxelCoords{0, 0, 0}),
+		NewVoxel(VoxelCoords{1, 0, 0}),
+		NewVoxel(VoxelCoords{1, 1, 1}),
+		NewVoxel(VoxelCoords{3, 0, 0}),
+	}
+	va := newVoxelArray(voxels)
+	neighbors := func(i int) []VoxelCoords {
+		coords := []VoxelCoords{}
+		for _, nb := range va.neighbors[va.neighborStart[i]:va.neighborStart[i+1]] {
+			coords = append(coords, va.voxels[nb].Key)
+		}
+		return coords
+	}
+	// voxels touching by a face, an edge or a corner are neighbors, and farther ones are not
+	test.That(t, neighbors(0), test.ShouldHaveLength, 2)
+	test.That(t, neighbors(0), test.ShouldContain, VoxelCoords{1, 0, 0})
+	test.That(t, neighbors(0), test.ShouldContain, VoxelCoords{1, 1, 1})
+	test.That(t, neighbors(1), test.ShouldHaveLength, 2)
+	test.That(t, neighbors(1), test.ShouldContain, VoxelCoords{0, 0, 0})
+	test.That(t, neighbors(1), test.ShouldContain, VoxelCoords{1, 1, 1})
+	test.That(t, neighbors(2), test.ShouldHaveLength, 2)
+	test.That(t, neighbors(2), test.ShouldContain, VoxelCoords{0, 0, 0})
+	test.That(t, neighbors(2), test.ShouldContain, VoxelCoords{1, 0, 0})
+	test.That(t, neighbors(3), test.ShouldBeEmpty)
+}
+
+func BenchmarkVoxelPlaneSegmentation(b *testing.B) {
+	pc := GenerateCubeTestData(100000)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		vg := NewVoxelGridFromPointCloud(pc, 0.1, 0.01)
+		vg.SegmentPlanesRegionGrowing(0.7, 25, 0.1, 1.0)
+	}
+}
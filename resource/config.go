@@ -36,7 +36,8 @@ type Config struct {
 
 // A LogConfig describes the LogConfig config object.
 type LogConfig struct {
-	Level logging.Level `json:"level"`
+	Level    logging.Level           `json:"level"`
+	Sampling *logging.SamplingConfig `json:"sampling,omitempty"`
 }
 
 // NOTE: This data must be maintained with what is in Config.
@@ -307,6 +308,13 @@ func (conf *Config) validate(path, defaultAPIType string) ([]string, error) {
 	if err := conf.API.Validate(); err != nil {
 		return nil, err
 	}
+
+	if conf.LogConfiguration.Sampling != nil {
+		if err := conf.LogConfiguration.Sampling.Validate(); err != nil {
+			return nil, NewConfigValidationError(path, err)
+		}
+	}
+
 	if conf.ConvertedAttributes != nil {
 		validatedDeps, err := conf.ConvertedAttributes.Validate(path)
 		if err != nil {
@@ -63,6 +63,10 @@ type GraphNode struct {
 	needsDependencyResolution bool
 
 	logger logging.Logger
+	// logSampling is the sampling config last applied to logger, valid once logSamplingSet is true.
+	// Reapplying a config would reset its counters.
+	logSampling    *logging.SamplingConfig
+	logSamplingSet bool
 
 	// state stores the current lifecycle state for a resource node.
 	state NodeState
@@ -163,6 +167,10 @@ func (w *GraphNode) InitializeLogger(parent logging.Logger, subname string, leve
 	logger := parent.Sublogger(subname)
 	logger.SetLevel(level)
 	w.logger = logger
+
+	w.mu.Lock()
+	w.logSampling, w.logSamplingSet = nil, false
+	w.mu.Unlock()
 }
 
 // Logger returns the logger object associated with this resource node. This is expected to be the logger
@@ -180,6 +188,23 @@ func (w *GraphNode) SetLogLevel(level logging.Level) {
 	}
 }
 
+// SetLogSampling changes the duplicate suppression config of the logger (if available). A nil
+// config disables sampling. The logger is left alone, keeping its counts of suppressed entries, if
+// the config did not change.
+func (w *GraphNode) SetLogSampling(config *logging.SamplingConfig) {
+	if w.logger == nil {
+		return
+	}
+
+	w.mu.Lock()
+	defer w.mu.Unlock()
+	if w.logSamplingSet && w.logSampling.Equal(config) {
+		return
+	}
+	w.logSampling, w.logSamplingSet = config, true
+	w.logger.SetSampling(config)
+}
+
 // UnsafeResource always returns the underlying resource, if
 // initialized, even if it is in an error state. This should
 // only be called during reconfiguration.
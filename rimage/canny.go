@@ -0,0 +1,192 @@
+package rimage
+
+import (
+	"image"
+	"math"
+	"sync"
+
+	"github.com/pkg/errors"
+
+	"go.viam.com/rdk/utils"
+)
+
+// cannyPlanes are the per-pixel buffers of an edge detection, reused across detections.
+type cannyPlanes struct {
+	// lum is the luminance of each pixel of a color image, times 1000 so that it is exact
+	lum      []int32
+	mag      []float64
+	rowMax   []float64
+	rowCount []int
+	stack    []int
+}
+
+var cannyPlanesPool = sync.Pool{New: func() any { return &cannyPlanes{} }}
+
+func (p *cannyPlanes) resize(width, height int) {
+	if cap(p.mag) < width*height {
+		p.mag = make([]float64, width*height)
+	}
+	p.mag = p.mag[:width*height]
+	if cap(p.rowMax) < height {
+		p.rowMax = make([]float64, height)
+		p.rowCount = make([]int, height)
+	}
+	p.rowMax = p.rowMax[:height]
+	p.rowCount = p.rowCount[:height]
+	p.stack = p.stack[:0]
+}
+
+// colorGradientMagnitude fills mag with the magnitude of the forward gradient of the luminance of
+// img, as ForwardGradient does, and rowMax with the maximum of each row.
+func (p *cannyPlanes) colorGradientMagnitude(img *Image) {
+	width, height := img.Width(), img.Height()
+	if cap(p.lum) < width*height {
+		p.lum = make([]int32, width*height)
+	}
+	p.lum = p.lum[:width*height]
+	utils.ParallelForEachRow(height, func(y int) {
+		row := y * width
+		for x, c := range img.data[row : row+width] {
+			r, g, b := c.RGB255()
+			p.lum[row+x] = 299*int32(r) + 587*int32(g) + 114*int32(b)
+		}
+	})
+	utils.ParallelForEachRow(height, func(y int) {
+		row := y * width
+		rowMax := 0.0
+		for x := 0; x < width; x++ {
+			// the same float operations as ForwardGradient, so that the edges are identical
+			c0 := float64(p.lum[row+x]) / 1000
+			var magX, magY float64
+			if x < width-1 {
+				d := float64(p.lum[row+x+1])/1000 - c0
+				magX = d * d
+			}
+			if y < height-1 {
+				d := float64(p.lum[row+width+x])/1000 - c0
+				magY = d * d
+			}
+			mag := math.Sqrt(magX + magY)
+			p.mag[row+x] = mag
+			rowMax = math.Max(rowMax, mag)
+		}
+		p.rowMax[y] = rowMax
+	})
+}
+
+// depthGradientMagnitude fills mag with the magnitude of the forward gradient of dm, as
+// ForwardDepthGradient does, and rowMax with the maximum of each row.
+func (p *cannyPlanes) depthGradientMagnitude(dm *DepthMap) {
+	width, height := dm.Width(), dm.Height()
+	utils.ParallelForEachRow(height, func(y int) {
+		row := y * width
+		rowMax := 0.0
+		for x := 0; x < width; x++ {
+			i := row + x
+			sX, sY := 0, 0
+			if d := int(dm.data[i]); d != 0 {
+				if x+1 < width && dm.data[i+1] != 0 {
+					sX = int(dm.data[i+1]) - d
+				}
+				if y+1 < height && dm.data[i+width] != 0 {
+					sY = int(dm.data[i+width]) - d
+				}
+			}
+			mag := math.Sqrt(float64(sX*sX + sY*sY))
+			p.mag[i] = mag
+			rowMax = math.Max(rowMax, mag)
+		}
+		p.rowMax[y] = rowMax
+	})
+}
+
+// hysteresisThresholds computes the thresholds GetHysteresisThresholds does from mag, counting the
+// values in the upper bins of its histogram directly rather than building it. ok is false if the
+// gradient is too weak to histogram.
+func (p *cannyPlanes) hysteresisThresholds(width, height int, ratioHigh, ratioLow float64) (low, high float64, ok bool) {
+	maxMag := 0.0
+	for _, m := range p.rowMax {
+		maxMag = math.Max(maxMag, m)
+	}
+	// Get one bin per possible pixel value
+	nBins := int(math.Round(maxMag))
+	if nBins == 0 {
+		return 0, 0, false
+	}
+	// everything from the second bin divider up is non zero
+	nonZeroFrom := (maxMag + 1) / float64(nBins)
+	utils.ParallelForEachRow(height, func(y int) {
+		count := 0
+		for _, m := range p.mag[y*width : (y+1)*width] {
+			if m >= nonZeroFrom {
+				count++
+			}
+		}
+		p.rowCount[y] = count
+	})
+	nNonZero := 0
+	for _, count := range p.rowCount {
+		nNonZero += count
+	}
+	high = float64(nNonZero) * ratioHigh * 100 / float64(width*height)
+	low = high*ratioLow + 0.5
+	return low, high, true
+}
+
+// hysteresis keeps the pixels of mag above high, and the pixels above low connected to them, as
+// EdgeHysteresisFiltering does. Like GetConnectivity8Neighbors, weak pixels are never reached
+// through a step up or left into the first row or column.
+func (p *cannyPlanes) hysteresis(width, height int, low, high float64) *image.Gray {
+	edges := image.NewGray(image.Rect(0, 0, width, height))
+	stack := p.stack[:0]
+	for i, m := range p.mag {
+		if m > high {
+			edges.Pix[i] = 255
+			stack = append(stack, i)
+		}
+	}
+	for len(stack) > 0 {
+		i := stack[len(stack)-1]
+		stack = stack[:len(stack)-1]
+		y, x := i/width, i%width
+		for dy := -1; dy <= 1; dy++ {
+			ny := y + dy
+			if (dy < 0 && ny < 1) || ny >= height {
+				continue
+			}
+			for dx := -1; dx <= 1; dx++ {
+				nx := x + dx
+				if (dx == 0 && dy == 0) || (dx < 0 && nx < 1) || nx >= width {
+					continue
+				}
+				n := ny*width + nx
+				if edges.Pix[n] == 0 && p.mag[n] > low {
+					edges.Pix[n] = 255
+					stack = append(stack, n)
+				}
+			}
+		}
+	}
+	p.stack = stack
+	return edges
+}
+
+// detectEdges runs the thresholding and hysteresis of the detector on the gradient magnitude
+// filled in by gradient.
+func (cd *CannyEdgeDetector) detectEdges(width, height int, gradient func(p *cannyPlanes)) (*image.Gray, error) {
+	if width*height == 0 {
+		return nil, errors.New("cannot detect the edges of an empty image")
+	}
+	p, ok := cannyPlanesPool.Get().(*cannyPlanes)
+	if !ok {
+		p = &cannyPlanes{}
+	}
+	defer cannyPlanesPool.Put(p)
+	p.resize(width, height)
+	gradient(p)
+	low, high, ok := p.hysteresisThresholds(width, height, cd.highRatio, cd.lowRatio)
+	if !ok {
+		return image.NewGray(image.Rect(0, 0, width, height)), nil
+	}
+	return p.hysteresis(width, height, low, high), nil
+}
@@ -0,0 +1,118 @@
+package rimage
+
+import (
+	"image"
+	"math/rand"
+	"testing"
+
+	"go.viam.com/test"
+)
+
+// makeCannyTestImages returns a noisy image and depth map of rectangles.
+func makeCannyTestImages(width, height int) (*Image, *DepthMap) {
+	r := rand.New(rand.NewSource(0))
+	img := NewImage(width, height)
+	dm := NewEmptyDepthMap(width, height)
+	for i := 0; i < 20; i++ {
+		x0, y0 := r.Intn(width), r.Intn(height)
+		x1, y1 := x0+r.Intn(width/2), y0+r.Intn(height/2)
+		c := NewColor(uint8(r.Intn(256)), uint8(r.Intn(256)), uint8(r.Intn(256)))
+		d := Depth(r.Intn(5000))
+		for y := y0; y < y1 && y < height; y++ {
+			for x := x0; x < x1 && x < width; x++ {
+				img.SetXY(x, y, c)
+				dm.Set(x, y, d)
+			}
+		}
+	}
+	for i := range img.data {
+		if r.Intn(10) == 0 {
+			img.data[i] = NewColor(uint8(r.Intn(256)), uint8(r.Intn(256)), uint8(r.Intn(256)))
+		}
+		if r.Intn(10) == 0 {
+			dm.data[i] = 0
+		}
+	}
+	return img, dm
+}
+
+// edgeRows returns the rows of an edge image, for comparison against the expected edges.
+func edgeRows(edges *image.Gray) [][]uint8 {
+	var rows [][]uint8
+	for y := edges.Rect.Min.Y; y < edges.Rect.Max.Y; y++ {
+		rows = append(rows, edges.Pix[y*edges.Stride:y*edges.Stride+edges.Rect.Dx()])
+	}
+	return rows
+}
+
+func TestCannyEdges(t *testing.T) {
+	// A bright square with a faint pixel in the corner. The forward gradient marks the pixels
+	// just before each step.
+	img := NewImage(8, 6)
+	for y := 1; y < 5; y++ {
+		for x := 2; x < 6; x++ {
+			img.SetXY(x, y, NewColor(200, 200, 200))
+		}
+	}
+	img.SetXY(7, 0, NewColor(60, 60, 60))
+	edges, err := NewCannyDericheEdgeDetector().DetectEdges(img, 0)
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, edgeRows(edges), test.ShouldResemble, [][]uint8{
+		{0, 0, 255, 255, 255, 255, 255, 255},
+		{0, 255, 0, 0, 0, 255, 0, 0},
+		{0, 255, 0, 0, 0, 255, 0, 0},
+		{0, 255, 0, 0, 0, 255, 0, 0},
+		{0, 255, 255, 255, 255, 255, 0, 0},
+		{0, 0, 0, 0, 0, 0, 0, 0},
+	})
+
+	// a flat image has no edges
+	edges, err = NewCannyDericheEdgeDetector().DetectEdges(NewImage(4, 3), 0)
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, edges.Pix, test.ShouldResemble, make([]uint8, 12))
+}
+
+func TestCannyDepthEdges(t *testing.T) {
+	// A step in depth, with a weak ridge connected to it and a hole, which is not an edge.
+	dm := NewEmptyDepthMap(8, 6)
+	for y := 0; y < 6; y++ {
+		for x := 0; x < 8; x++ {
+			d := Depth(1000)
+			if x >= 4 {
+				d = 1500
+			} else if y == 4 && x >= 1 && x < 3 {
+				d = 1020
+			}
+			dm.Set(x, y, d)
+		}
+	}
+	dm.Set(1, 1, 0)
+	edges, err := NewCannyDericheEdgeDetectorWithParameters(0.85, 0.33, false).DetectDepthEdges(dm, 0)
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, edgeRows(edges), test.ShouldResemble, [][]uint8{
+		{0, 0, 0, 255, 0, 0, 0, 0},
+		{0, 0, 0, 255, 0, 0, 0, 0},
+		{0, 0, 0, 255, 0, 0, 0, 0},
+		{0, 255, 255, 255, 0, 0, 0, 0},
+		{255, 255, 255, 255, 0, 0, 0, 0},
+		{0, 0, 0, 255, 0, 0, 0, 0},
+	})
+}
+
+func BenchmarkDetectEdges(b *testing.B) {
+	img, _ := makeCannyTestImages(640, 480)
+	cd := NewCannyDericheEdgeDetector()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		cd.DetectEdges(img, 0)
+	}
+}
+
+func BenchmarkDetectDepthEdges(b *testing.B) {
+	_, dm := makeCannyTestImages(640, 480)
+	cd := NewCannyDericheEdgeDetectorWithParameters(0.85, 0.33, false)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		cd.DetectDepthEdges(dm, 0)
+	}
+}
@@ -92,17 +92,21 @@ func ConvolveGray(img *image.Gray, kernel *Kernel, anchor image.Point, border Bo
 	}
 	originalSize := img.Bounds().Size()
 	resultImage := image.NewGray(img.Bounds())
-	utils.ParallelForEachPixel(originalSize, func(x, y int) {
-		sum := float64(0)
-		for ky := 0; ky < kernelSize.Y; ky++ {
-			for kx := 0; kx < kernelSize.X; kx++ {
-				pixel := padded.GrayAt(x+kx, y+ky)
-				kE := kernel.At(kx, ky)
-				sum += float64(pixel.Y) * kE
+	utils.ParallelForEachRowSpan(originalSize.Y, func(from, to int) {
+		for y := from; y < to; y++ {
+			for x := 0; x < originalSize.X; x++ {
+				sum := float64(0)
+				for ky := 0; ky < kernelSize.Y; ky++ {
+					for kx := 0; kx < kernelSize.X; kx++ {
+						pixel := padded.GrayAt(x+kx, y+ky)
+						kE := kernel.At(kx, ky)
+						sum += float64(pixel.Y) * kE
+					}
+				}
+				sum = utils.Clamp(sum, 0, 255)
+				resultImage.Set(x, y, color.Gray{uint8(sum)})
 			}
 		}
-		sum = utils.Clamp(sum, 0, 255)
-		resultImage.Set(x, y, color.Gray{uint8(sum)})
 	})
 	return resultImage, nil
 }
@@ -118,17 +122,21 @@ func ConvolveGrayFloat64(m *mat.Dense, filter *Kernel) (*mat.Dense, error) {
 		return nil, err
 	}
 
-	utils.ParallelForEachPixel(image.Point{w, h}, func(x, y int) {
-		sum := float64(0)
-		for ky := 0; ky < kernelSize.Y; ky++ {
-			for kx := 0; kx < kernelSize.X; kx++ {
-				pixel := padded.At(y+ky, x+kx)
-				kE := filter.At(ky, kx)
-				sum += pixel * kE
+	utils.ParallelForEachRowSpan(h, func(from, to int) {
+		for y := from; y < to; y++ {
+			row := result.RawRowView(y)
+			for x := range row {
+				sum := float64(0)
+				for ky := 0; ky < kernelSize.Y; ky++ {
+					for kx := 0; kx < kernelSize.X; kx++ {
+						pixel := padded.At(y+ky, x+kx)
+						kE := filter.At(ky, kx)
+						sum += pixel * kE
+					}
+				}
+				row[x] = math.Floor(sum)
 			}
 		}
-		sum = math.Floor(sum)
-		result.Set(y, x, sum)
 	})
 	return result, nil
 }
@@ -433,9 +433,13 @@ func (dm *DepthMap) Warp(m TransformationMatrix, newSize image.Point) *DepthMap
 // same dimensions.
 func (dm *DepthMap) ConvertDepthMapToLuminanceFloat() *mat.Dense {
 	out := mat.NewDense(dm.height, dm.width, nil)
-	utils.ParallelForEachPixel(image.Point{dm.width, dm.height}, func(x, y int) {
-		d := dm.GetDepth(x, y)
-		out.Set(y, x, float64(d))
+	utils.ParallelForEachRowSpan(dm.height, func(from, to int) {
+		for y := from; y < to; y++ {
+			row := out.RawRowView(y)
+			for x, d := range dm.data[y*dm.width : (y+1)*dm.width] {
+				row[x] = float64(d)
+			}
+		}
 	})
 	return out
 }
@@ -50,23 +50,10 @@ func (cd *CannyEdgeDetector) DetectDepthEdges(dmIn *DepthMap, blur float64) (*im
 		dm = dmIn
 	}
 
-	vectorField := ForwardDepthGradient(dm)
-	dmMagnitude, dmDirection := vectorField.MagnitudeField(), vectorField.DirectionField()
-
-	nms, err := GradientNonMaximumSuppressionC8(dmMagnitude, dmDirection)
-	if err != nil {
-		return nil, err
-	}
-	low, high, err := GetHysteresisThresholds(dmMagnitude, nms, cd.highRatio, cd.lowRatio)
-	if err != nil {
-		return nil, err
-	}
-	// low, high =
-	edges, err := EdgeHysteresisFiltering(dmMagnitude, low, high)
-	if err != nil {
-		return nil, err
-	}
-	return edges, nil
+	// see DetectEdges
+	return cd.detectEdges(dm.Width(), dm.Height(), func(p *cannyPlanes) {
+		p.depthGradientMagnitude(dm)
+	})
 }
 
 // MissingDepthData outputs a binary map where white represents where data is, and black is where data is missing.
@@ -138,16 +125,7 @@ func GaussianSmoothing(dm *DepthMap, sigma float64) (*DepthMap, error) {
 		return outDM, nil
 	}
 	filter := gaussianFilter(sigma)
-	for y := 0; y < height; y++ {
-		for x := 0; x < width; x++ {
-			if dm.GetDepth(x, y) == 0 {
-				continue
-			}
-			point := image.Point{x, y}
-			val := filter(point, dm)
-			outDM.Set(point.X, point.Y, Depth(val))
-		}
-	}
+	smoothDepthMap(dm, outDM, filter)
 	return outDM, nil
 }
 
@@ -165,16 +143,17 @@ func SavitskyGolaySmoothing(dm *DepthMap, validPoints *image.Gray, radius, polyO
 		return nil, err
 	}
 	dmForConv := expandDepthMapForConvolution(dm, radius)
-	zero := color.Gray{0}
+	// Each result is written back into dmForConv, where later pixels read it, so the pixels are
+	// filtered in order rather than in parallel.
 	for y := 0; y < height; y++ {
+		valid := validPoints.Pix[validPoints.PixOffset(0, y):]
 		for x := 0; x < width; x++ {
-			if validPoints.At(x, y) == zero {
+			if valid[x] == 0 {
 				continue
 			}
-			pointForConv := image.Point{x + radius, y + radius}
-			val := filter(pointForConv, dmForConv)
-			dmForConv.Set(x, y, Depth(val))
-			outDM.Set(x, y, Depth(val))
+			val := Depth(filter(dmForConv, x+radius, y+radius))
+			dmForConv.data[y*dmForConv.width+x] = val
+			outDM.data[y*width+x] = val
 		}
 	}
 	return outDM, nil
@@ -185,19 +164,25 @@ func SavitskyGolaySmoothing(dm *DepthMap, validPoints *image.Gray, radius, polyO
 // smooth across large differences in depth.
 func JointBilateralSmoothing(dm *DepthMap, spatialSigma, depthSigma float64) (*DepthMap, error) {
 	filter := jointBilateralFilter(spatialSigma, depthSigma)
-	width, height := dm.Width(), dm.Height()
-	outDM := NewEmptyDepthMap(width, height)
-	for y := 0; y < height; y++ {
-		for x := 0; x < width; x++ {
-			if dm.GetDepth(x, y) == 0 {
+	outDM := NewEmptyDepthMap(dm.Width(), dm.Height())
+	smoothDepthMap(dm, outDM, filter)
+	return outDM, nil
+}
+
+// smoothDepthMap sets every pixel of outDM with a depth in dm to the filtered depth, splitting the
+// rows across goroutines.
+func smoothDepthMap(dm, outDM *DepthMap, filter depthFilterFunc) {
+	width := dm.Width()
+	utils.ParallelForEachRow(dm.Height(), func(y int) {
+		row := dm.data[y*width : (y+1)*width]
+		outRow := outDM.data[y*width : (y+1)*width]
+		for x, d := range row {
+			if d == 0 {
 				continue
 			}
-			point := image.Point{x, y}
-			val := filter(point, dm)
-			outDM.Set(point.X, point.Y, Depth(val))
+			outRow[x] = Depth(filter(dm, x, y))
 		}
-	}
-	return outDM, nil
+	})
 }
 
 // expandDepthMapForConvolution pads an input depth map on every side with a mirror image of the data. This is so evaluation
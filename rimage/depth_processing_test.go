@@ -1,6 +1,8 @@
 package rimage
 
 import (
+	"image/color"
+	"math/rand"
 	"testing"
 
 	"github.com/golang/geo/r2"
@@ -71,3 +73,152 @@ func TestInterpolations(t *testing.T) {
 	d = BilinearInterpolationDepth(pt, dm)
 	test.That(t, d, test.ShouldBeNil)
 }
+
+// noisyDepthMap returns a depth map of two planes at different depths, with noise and holes.
+func noisyDepthMap(width, height int) *DepthMap {
+	//nolint:gosec
+	r := rand.New(rand.NewSource(1))
+	dm := NewEmptyDepthMap(width, height)
+	for y := 0; y < height; y++ {
+		for x := 0; x < width; x++ {
+			if r.Intn(20) == 0 {
+				continue
+			}
+			d := 1000 + x
+			if x > width/2 {
+				d = 3000 + y
+			}
+			dm.Set(x, y, Depth(d+r.Intn(50)))
+		}
+	}
+	return dm
+}
+
+// depthMapsAlmostEqual checks that two depth maps only differ by rounding, since the order in
+// which the weights are summed is not part of the expected behavior.
+func depthMapsAlmostEqual(t *testing.T, got, expected *DepthMap) {
+	t.Helper()
+	test.That(t, got.Bounds(), test.ShouldResemble, expected.Bounds())
+	for i, d := range got.Data() {
+		diff := int(d) - int(expected.Data()[i])
+		test.That(t, diff, test.ShouldBeBetweenOrEqual, -1, 1)
+	}
+}
+
+// stepDepthMap returns a 7x5 depth map that rises along x and then steps up to 2000, with a hole.
+func stepDepthMap() *DepthMap {
+	dm := NewEmptyDepthMap(7, 5)
+	for y := 0; y < 5; y++ {
+		for x := 0; x < 7; x++ {
+			d := 1000 + 10*x
+			if x >= 4 {
+				d = 2000
+			}
+			dm.Set(x, y, Depth(d))
+		}
+	}
+	dm.Set(2, 2, 0)
+	return dm
+}
+
+// depthMapFromRows returns a depth map with the given rows.
+func depthMapFromRows(rows [][]Depth) *DepthMap {
+	dm := NewEmptyDepthMap(len(rows[0]), len(rows))
+	for y, row := range rows {
+		for x, d := range row {
+			dm.Set(x, y, d)
+		}
+	}
+	return dm
+}
+
+func TestGaussianSmoothingStep(t *testing.T) {
+	smoothed, err := GaussianSmoothing(stepDepthMap(), 1)
+	test.That(t, err, test.ShouldBeNil)
+	depthMapsAlmostEqual(t, smoothed, depthMapFromRows([][]Depth{
+		{1005, 1015, 1076, 1317, 1706, 1939, 1993},
+		{1005, 1015, 1076, 1317, 1706, 1939, 1993},
+		{1005, 1015, 0, 1317, 1706, 1939, 1993},
+		{1005, 1015, 1076, 1318, 1707, 1939, 1993},
+		{1005, 1015, 1078, 1323, 1709, 1939, 1993},
+	}))
+}
+
+func TestJointBilateralSmoothingStep(t *testing.T) {
+	// without a depth sigma, depth differences are not weighed, so the step is smoothed over
+	smoothed, err := JointBilateralSmoothing(stepDepthMap(), 1, 0)
+	test.That(t, err, test.ShouldBeNil)
+	depthMapsAlmostEqual(t, smoothed, depthMapFromRows([][]Depth{
+		{1005, 1015, 1078, 1323, 1709, 1940, 1993},
+		{1004, 1015, 1082, 1337, 1716, 1940, 1993},
+		{1004, 1015, 0, 1349, 1721, 1941, 1993},
+		{1004, 1015, 1082, 1337, 1716, 1940, 1993},
+		{1005, 1015, 1078, 1323, 1709, 1940, 1993},
+	}))
+
+	// with a small depth sigma, the step is kept
+	smoothed, err = JointBilateralSmoothing(stepDepthMap(), 1, 5)
+	test.That(t, err, test.ShouldBeNil)
+	depthMapsAlmostEqual(t, smoothed, depthMapFromRows([][]Depth{
+		{1000, 1009, 1019, 1029, 2000, 2000, 2000},
+		{1000, 1009, 1019, 1029, 2000, 1999, 1999},
+		{1000, 1009, 0, 1029, 2000, 1999, 1999},
+		{1000, 1009, 1019, 1029, 2000, 1999, 1999},
+		{1000, 1009, 1019, 1029, 2000, 2000, 1999},
+	}))
+}
+
+func TestSavitskyGolaySmoothingFlat(t *testing.T) {
+	// a least squares fit of a flat depth map is flat, and only the valid points are filtered
+	dm := NewEmptyDepthMap(6, 5)
+	for i := range dm.data {
+		dm.data[i] = 1000
+	}
+	validPoints := MissingDepthData(dm)
+	validPoints.SetGray(3, 2, color.Gray{0})
+	smoothed, err := SavitskyGolaySmoothing(dm, validPoints, 1, 2)
+	test.That(t, err, test.ShouldBeNil)
+	expected := NewEmptyDepthMap(6, 5)
+	for i := range expected.data {
+		expected.data[i] = 1000
+	}
+	expected.Set(3, 2, 0)
+	depthMapsAlmostEqual(t, smoothed, expected)
+}
+
+func TestKernelWindow(t *testing.T) {
+	i0, i1, j0, j1 := kernelWindow(5, 5, 20, 20, 5)
+	test.That(t, []int{i0, i1, j0, j1}, test.ShouldResemble, []int{0, 5, 0, 5})
+	i0, i1, j0, j1 = kernelWindow(0, 19, 20, 20, 5)
+	test.That(t, []int{i0, i1, j0, j1}, test.ShouldResemble, []int{2, 5, 0, 3})
+	i0, i1, j0, j1 = kernelWindow(1, 1, 2, 2, 7)
+	test.That(t, []int{i0, i1, j0, j1}, test.ShouldResemble, []int{2, 4, 2, 4})
+}
+
+func BenchmarkGaussianSmoothing(b *testing.B) {
+	dm := noisyDepthMap(640, 480)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		_, err := GaussianSmoothing(dm, 1)
+		test.That(b, err, test.ShouldBeNil)
+	}
+}
+
+func BenchmarkJointBilateralSmoothing(b *testing.B) {
+	dm := noisyDepthMap(640, 480)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		_, err := JointBilateralSmoothing(dm, 1, 500)
+		test.That(b, err, test.ShouldBeNil)
+	}
+}
+
+func BenchmarkSavitskyGolaySmoothing(b *testing.B) {
+	dm := noisyDepthMap(640, 480)
+	validPoints := MissingDepthData(dm)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		_, err := SavitskyGolaySmoothing(dm, validPoints, 3, 3)
+		test.That(b, err, test.ShouldBeNil)
+	}
+}
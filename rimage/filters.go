@@ -75,28 +75,52 @@ func gaussianKernel(sigma float64) [][]float64 {
 	return kernel
 }
 
-// Filters for convolutions, used in their corresponding smoothing functions
+// Filters for convolutions, used in their corresponding smoothing functions. They read the raw data
+// of the depth map, clipping the window of the kernel to the depth map once per pixel rather than
+// checking whether each neighbor is within it.
+
+// depthFilterFunc returns the filtered depth of pixel (x, y) of dm.
+type depthFilterFunc func(dm *DepthMap, x, y int) float64
+
+// kernelWindow returns the columns [i0, i1) and rows [j0, j1) of a k x k kernel, centered on pixel
+// (x, y), that lie within a width x height depth map.
+func kernelWindow(x, y, width, height, k int) (i0, i1, j0, j1 int) {
+	r := k / 2
+	i0, i1, j0, j1 = 0, k, 0, k
+	if x < r {
+		i0 = r - x
+	}
+	if x+k-r > width {
+		i1 = width - x + r
+	}
+	if y < r {
+		j0 = r - y
+	}
+	if y+k-r > height {
+		j1 = height - y + r
+	}
+	return i0, i1, j0, j1
+}
 
 // using just spatial information to fill the kernel values.
-func gaussianFilter(sigma float64) func(p image.Point, dm *DepthMap) float64 {
+func gaussianFilter(sigma float64) depthFilterFunc {
 	kernel := gaussianKernel(sigma)
 	k := len(kernel)
-	xRange, yRange := makeRangeArray(k), makeRangeArray(k)
-	filter := func(p image.Point, dm *DepthMap) float64 {
+	r := k / 2
+	filter := func(dm *DepthMap, x, y int) float64 {
+		i0, i1, j0, j1 := kernelWindow(x, y, dm.width, dm.height, k)
 		val := 0.0
 		weight := 0.0
-		for i, dx := range xRange {
-			for j, dy := range yRange {
-				if !dm.Contains(p.X+dx, p.Y+dy) {
-					continue
-				}
-				d := float64(dm.GetDepth(p.X+dx, p.Y+dy))
-				if d == 0.0 {
+		for j := j0; j < j1; j++ {
+			// rows are height j, columns are width i
+			weights := kernel[j][i0:i1]
+			start := (y+j-r)*dm.width + x + i0 - r
+			for i, d := range dm.data[start : start+len(weights)] {
+				if d == 0 {
 					continue
 				}
-				// rows are height j, columns are width i
-				val += kernel[j][i] * d
-				weight += kernel[j][i]
+				val += weights[i] * float64(d)
+				weight += weights[i]
 			}
 		}
 		return math.Max(0, val/weight)
@@ -104,28 +128,42 @@ func gaussianFilter(sigma float64) func(p image.Point, dm *DepthMap) float64 {
 	return filter
 }
 
-// Uses both spatial and depth information to fill the kernel values.
-func jointBilateralFilter(spatialSigma, depthSigma float64) func(p image.Point, dm *DepthMap) float64 {
+// Uses both spatial and depth information to fill the kernel values. The spatial weights are
+// computed once for the whole kernel, and the depth weights once for every possible difference in
+// depth.
+func jointBilateralFilter(spatialSigma, depthSigma float64) depthFilterFunc {
 	spatialFilter := gaussianFunction2D(spatialSigma)
-	depthFilter := gaussianFunction1D(depthSigma)
 	k := utils.MaxInt(3, 1+2*int(3.*spatialSigma)) // 3 sigma worth of area
-	xRange, yRange := makeRangeArray(k), makeRangeArray(k)
-	filter := func(p image.Point, dm *DepthMap) float64 {
+	r := k / 2
+	spatialWeights := make([][]float64, k)
+	for j := range spatialWeights {
+		spatialWeights[j] = make([]float64, k)
+		for i := range spatialWeights[j] {
+			spatialWeights[j][i] = spatialFilter(float64(i-r), float64(j-r))
+		}
+	}
+	depthWeights := depthDifferenceWeights(depthSigma)
+	filter := func(dm *DepthMap, x, y int) float64 {
+		i0, i1, j0, j1 := kernelWindow(x, y, dm.width, dm.height, k)
 		newDepth := 0.0
 		totalWeight := 0.0
-		center := float64(dm.GetDepth(p.X, p.Y))
-		for _, dx := range xRange {
-			for _, dy := range yRange {
-				if !dm.Contains(p.X+dx, p.Y+dy) {
+		center := int(dm.data[y*dm.width+x])
+		for j := j0; j < j1; j++ {
+			weights := spatialWeights[j][i0:i1]
+			start := (y+j-r)*dm.width + x + i0 - r
+			for i, d := range dm.data[start : start+len(weights)] {
+				if d == 0 {
 					continue
 				}
-				d := float64(dm.GetDepth(p.X+dx, p.Y+dy))
-				if d == 0.0 {
+				diff := center - int(d)
+				if diff < 0 {
+					diff = -diff
+				}
+				if diff >= len(depthWeights) {
 					continue
 				}
-				weight := spatialFilter(float64(dx), float64(dy))
-				weight *= depthFilter(center - d)
-				newDepth += d * weight
+				weight := weights[i] * depthWeights[diff]
+				newDepth += float64(d) * weight
 				totalWeight += weight
 			}
 		}
@@ -134,6 +172,22 @@ func jointBilateralFilter(spatialSigma, depthSigma float64) func(p image.Point,
 	return filter
 }
 
+// depthDifferenceWeights returns the gaussian weight of every possible difference between two depths,
+// up to where the weight underflows to zero.
+func depthDifferenceWeights(sigma float64) []float64 {
+	depthFilter := gaussianFunction1D(sigma)
+	n := int(MaxDepth) + 1
+	if sigma > 0. {
+		// exp(-0.5*40^2) is below the smallest float64
+		n = utils.MinInt(n, int(math.Ceil(40.*sigma)))
+	}
+	weights := make([]float64, n)
+	for i := range weights {
+		weights[i] = depthFilter(float64(i))
+	}
+	return weights
+}
+
 // Sobel filters are used to approximate the gradient of the image intensity. One filter for each direction.
 
 var (
@@ -223,22 +277,22 @@ func vectorBlurFilter(k int) func(p image.Point, vf *VectorField2D) Vec2D {
 // Note that x and y are equal to zero at the central point. The parameters for the fit are gotten from
 // the SavitskyGolayKernel.
 // 3. The output value is computed with the calculated fit parameters multiplied times the input data.
-func savitskyGolayFilter(radius, polyOrder int) (func(p image.Point, dm *DepthMap) float64, error) {
+func savitskyGolayFilter(radius, polyOrder int) (depthFilterFunc, error) {
 	kernel, err := savitskyGolayKernel(radius, polyOrder)
 	if err != nil {
 		return nil, err
 	}
 	k := len(kernel)
-	xRange, yRange := makeRangeArray(k), makeRangeArray(k)
-	filter := func(p image.Point, dm *DepthMap) float64 {
+	r := k / 2
+	filter := func(dm *DepthMap, x, y int) float64 {
+		i0, i1, j0, j1 := kernelWindow(x, y, dm.width, dm.height, k)
 		val := 0.0
-		for i, dx := range xRange {
-			for j, dy := range yRange {
-				if !dm.Contains(p.X+dx, p.Y+dy) {
-					continue
-				}
-				// rows are height j, columns are width i
-				val += kernel[j][i] * float64(dm.GetDepth(p.X+dx, p.Y+dy))
+		for j := j0; j < j1; j++ {
+			// rows are height j, columns are width i
+			weights := kernel[j][i0:i1]
+			start := (y+j-r)*dm.width + x + i0 - r
+			for i, d := range dm.data[start : start+len(weights)] {
+				val += weights[i] * float64(d)
 			}
 		}
 		return math.Max(0, val)
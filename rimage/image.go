@@ -149,10 +149,13 @@ func (i *Image) SubImage(r image.Rectangle) *Image {
 // ConvertColorImageToLuminanceFloat convert an Image to a gray level image as a float dense matrix.
 func ConvertColorImageToLuminanceFloat(img *Image) *mat.Dense {
 	out := mat.NewDense(img.height, img.width, nil)
-	utils.ParallelForEachPixel(image.Point{img.width, img.height}, func(x, y int) {
-		c := img.GetXY(x, y)
-		l := math.Floor(Luminance(c))
-		out.Set(y, x, l)
+	utils.ParallelForEachRowSpan(img.height, func(from, to int) {
+		for y := from; y < to; y++ {
+			row := out.RawRowView(y)
+			for x, c := range img.data[y*img.width : (y+1)*img.width] {
+				row[x] = math.Floor(Luminance(c))
+			}
+		}
 	})
 	return out
 }
@@ -239,25 +239,18 @@ func NewCannyDericheEdgeDetectorWithParameters(hiRatio, loRatio float64, preproc
 	return &CannyEdgeDetector{hiRatio, loRatio, preproc}
 }
 
-// DetectEdges TODO.
+// DetectEdges finds the edges of img with the forward gradient of its luminance, thresholded with
+// hysteresis. It produces the same edges as running ForwardGradient, GetHysteresisThresholds and
+// EdgeHysteresisFiltering, but on flat reusable buffers, split into rows across goroutines.
+// The thresholds come from the histogram of the gradient magnitude, not of its non maximum
+// suppression, so the suppression is skipped.
 func (cd *CannyEdgeDetector) DetectEdges(img *Image, blur float64) (*image.Gray, error) {
-	imgGradient, err := ForwardGradient(img, blur, cd.preprocessImage)
-	if err != nil {
-		return nil, err
-	}
-	nms, err := GradientNonMaximumSuppressionC8(imgGradient.Magnitude, imgGradient.Direction)
-	if err != nil {
-		return nil, err
-	}
-	low, high, err := GetHysteresisThresholds(imgGradient.Magnitude, nms, cd.highRatio, cd.lowRatio)
-	if err != nil {
-		return nil, err
-	}
-	edges, err := EdgeHysteresisFiltering(imgGradient.Magnitude, low, high)
-	if err != nil {
-		return nil, err
+	if cd.preprocessImage {
+		img = ConvertImage(imaging.Blur(img, blur))
 	}
-	return edges, nil
+	return cd.detectEdges(img.Width(), img.Height(), func(p *cannyPlanes) {
+		p.colorGradientMagnitude(img)
+	})
 }
 
 // Luminance computes the luminance value from the R,G and B values.
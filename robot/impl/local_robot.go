@@ -19,6 +19,7 @@ import (
 	goutils "go.viam.com/utils"
 	"go.viam.com/utils/pexec"
 	"go.viam.com/utils/rpc"
+	"golang.org/x/sync/errgroup"
 	"google.golang.org/grpc/codes"
 	"google.golang.org/grpc/status"
 
@@ -42,11 +43,12 @@ import (
 
 var _ = robot.LocalRobot(&localRobot{})
 
+// remoteStatusTimeout bounds how long Status waits for any one remote's statuses.
+const remoteStatusTimeout = 5 * time.Second
+
 // localRobot satisfies robot.LocalRobot and defers most
 // logic to its manager.
 type localRobot struct {
-	// statusLock guards calls to the Status method.
-	statusLock    sync.Mutex
 	manager       *resourceManager
 	mostRecentCfg atomic.Value // config.Config
 
@@ -256,9 +258,6 @@ func remoteNameByResource(resourceName resource.Name) (string, bool) {
 }
 
 func (r *localRobot) Status(ctx context.Context, resourceNames []resource.Name) ([]robot.Status, error) {
-	r.statusLock.Lock()
-	defer r.statusLock.Unlock()
-
 	// If no resource names are specified, return status of all resources.
 	namesToDedupe := resourceNames
 	if len(resourceNames) == 0 {
@@ -287,8 +286,10 @@ func (r *localRobot) Status(ctx context.Context, resourceNames []resource.Name)
 		remoteResources[remoteName] = mappings
 	}
 
-	// Loop through remotes and get remote resource statuses through remotes.
+	// Request the statuses of remote resources from all remotes at once, each with its own timeout.
+	var remoteStatusesMu sync.Mutex
 	combinedRemoteResourceStatuses := make(map[resource.Name]robot.Status)
+	remoteGroup, remoteCtx := errgroup.WithContext(ctx)
 	for remoteName, resourceNameMappings := range remoteResources {
 		remote, ok := r.RemoteByName(remoteName)
 		if !ok {
@@ -302,25 +303,37 @@ func (r *localRobot) Status(ctx context.Context, resourceNames []resource.Name)
 			remoteResourceNames = append(remoteResourceNames, remoteResourceName)
 		}
 
-		// Request status of resources associated with the remote from the remote.
-		remoteResourceStatuses, err := remote.Status(ctx, remoteResourceNames)
-		if err != nil {
-			return nil, err
-		}
-		for _, remoteResourceStatus := range remoteResourceStatuses {
-			mappedName, ok := resourceNameMappings[remoteResourceStatus.Name]
-			if !ok {
-				// should never happen
-				r.Logger().CErrorw(ctx,
-					"failed to find corresponding resource name for remote resource name while creating status",
-					"resource", remoteResourceStatus.Name,
-				)
-				continue
+		resourceNameMappings := resourceNameMappings
+		remoteGroup.Go(func() error {
+			// Request status of resources associated with the remote from the remote.
+			ctx, cancel := context.WithTimeout(remoteCtx, remoteStatusTimeout)
+			defer cancel()
+			remoteResourceStatuses, err := remote.Status(ctx, remoteResourceNames)
+			if err != nil {
+				return err
 			}
-			// Set name to have remote prefix and add to remoteStatuses.
-			remoteResourceStatus.Name = mappedName
-			combinedRemoteResourceStatuses[mappedName] = remoteResourceStatus
-		}
+
+			remoteStatusesMu.Lock()
+			defer remoteStatusesMu.Unlock()
+			for _, remoteResourceStatus := range remoteResourceStatuses {
+				mappedName, ok := resourceNameMappings[remoteResourceStatus.Name]
+				if !ok {
+					// should never happen
+					r.Logger().CErrorw(ctx,
+						"failed to find corresponding resource name for remote resource name while creating status",
+						"resource", remoteResourceStatus.Name,
+					)
+					continue
+				}
+				// Set name to have remote prefix and add to remoteStatuses.
+				remoteResourceStatus.Name = mappedName
+				combinedRemoteResourceStatuses[mappedName] = remoteResourceStatus
+			}
+			return nil
+		})
+	}
+	if err := remoteGroup.Wait(); err != nil {
+		return nil, err
 	}
 
 	// Loop through entire resourceNameSet and get status for any local resources.
@@ -606,6 +606,7 @@ func (manager *resourceManager) completeConfig(
 						gNode.InitializeLogger(
 							manager.logger, resName.String(), conf.LogConfiguration.Level,
 						)
+						gNode.SetLogSampling(conf.LogConfiguration.Sampling)
 					} else {
 						verb = "reconfiguring"
 					}
@@ -933,6 +934,7 @@ func (manager *resourceManager) processResource(
 		}
 
 		gNode.SetLogLevel(conf.LogConfiguration.Level)
+		gNode.SetLogSampling(conf.LogConfiguration.Sampling)
 		err = currentRes.Reconfigure(ctx, deps, conf)
 		if err == nil {
 			return currentRes, false, nil
@@ -8,6 +8,7 @@ import (
 	"hash"
 	"hash/crc32"
 	"io"
+	"io/fs"
 	"net/http"
 	"net/url"
 	"os"
@@ -29,6 +30,9 @@ import (
 
 const (
 	allowedContentType = "application/x-gzip"
+
+	// maxConcurrentPackageSyncs bounds how many packages are downloaded and unpacked at once.
+	maxConcurrentPackageSyncs = 4
 )
 
 var (
@@ -45,6 +49,7 @@ type cloudManager struct {
 	packagesDataDir string
 	packagesDir     string
 	cloudConfig     config.Cloud
+	contentStore    *contentStore
 
 	managedPackages map[PackageName]*config.PackageConfig
 	mu              sync.RWMutex
@@ -78,6 +83,12 @@ func NewCloudManager(
 		return nil, err
 	}
 
+	logger = logger.Sublogger("package_manager")
+	store, err := newContentStore(packagesDir, logger)
+	if err != nil {
+		return nil, err
+	}
+
 	return &cloudManager{
 		Named:           InternalServiceName.AsNamed(),
 		client:          client,
@@ -85,7 +96,8 @@ func NewCloudManager(
 		cloudConfig:     *cloudConfig,
 		packagesDir:     packagesDir,
 		packagesDataDir: packagesDataDir,
-		logger:          logger.Sublogger("package_manager"),
+		contentStore:    store,
+		logger:          logger,
 	}, nil
 }
 
@@ -137,72 +149,46 @@ func (m *cloudManager) Sync(ctx context.Context, packages []config.PackageConfig
 		m.logger.Info("Package changes have been detected, starting sync")
 	}
 
+	// Packages are synced in parallel. Each worker reports its result through `resultsMu`.
+	var resultsMu sync.Mutex
+	var workers sync.WaitGroup
+	workerSlots := make(chan struct{}, maxConcurrentPackageSyncs)
+
 	start := time.Now()
 	for idx, p := range changedPackages {
 		p := p
-		pkgStart := time.Now()
+		idx := idx
 		if err := ctx.Err(); err != nil {
+			workers.Wait()
 			return multierr.Append(outErr, err)
 		}
 
-		m.logger.Debugf("Starting package sync [%d/%d] %s:%s", idx+1, len(changedPackages), p.Package, p.Version)
-
-		// Lookup the packages http url
-		includeURL := true
-
-		packageType, err := config.PackageTypeToProto(p.Type)
-		if err != nil {
-			m.logger.Warnw("failed to get package type", "package", p.Name, "error", err)
-		}
-		resp, err := m.client.GetPackage(ctx, &pb.GetPackageRequest{
-			Id:         p.Package,
-			Version:    p.Version,
-			Type:       packageType,
-			IncludeUrl: &includeURL,
+		workerSlots <- struct{}{}
+		workers.Add(1)
+		utils.PanicCapturingGo(func() {
+			defer func() {
+				<-workerSlots
+				workers.Done()
+			}()
+
+			pkgStart := time.Now()
+			m.logger.Debugf("Starting package sync [%d/%d] %s:%s", idx+1, len(changedPackages), p.Package, p.Version)
+			err := m.syncPackage(ctx, p)
+
+			resultsMu.Lock()
+			defer resultsMu.Unlock()
+			if err != nil {
+				outErr = multierr.Append(outErr, err)
+				return
+			}
+
+			// add to managed packages
+			newManagedPackages[PackageName(p.Name)] = &p
+
+			m.logger.Debugf("Package sync complete [%d/%d] %s:%s after %v", idx+1, len(changedPackages), p.Package, p.Version, time.Since(pkgStart))
 		})
-		if err != nil {
-			m.logger.Errorf("Failed fetching package details for package %s:%s, %s", p.Package, p.Version, err)
-			outErr = multierr.Append(outErr, errors.Wrapf(err, "failed loading package url for %s:%s", p.Package, p.Version))
-			continue
-		}
-
-		m.logger.Debugf("Downloading from %s", sanitizeURLForLogs(resp.Package.Url))
-
-		// download package from a http endpoint
-		err = installPackage(ctx, m.logger, m.packagesDir, resp.Package.Url, p,
-			func(ctx context.Context, url, dstPath string) (string, string, error) {
-				statusFile := packageSyncFile{
-					PackageID:       p.Package,
-					Version:         p.Version,
-					ModifiedTime:    time.Now(),
-					Status:          syncStatusDownloading,
-					TarballChecksum: "",
-				}
-
-				err = writeStatusFile(p, statusFile, m.packagesDir)
-				if err != nil {
-					return "", "", err
-				}
-
-				return m.downloadFileFromGCSURL(ctx, url, dstPath, m.cloudConfig.ID, m.cloudConfig.Secret)
-			},
-		)
-		if err != nil {
-			m.logger.Errorf("Failed downloading package %s:%s from %s, %s", p.Package, p.Version, sanitizeURLForLogs(resp.Package.Url), err)
-			outErr = multierr.Append(outErr, errors.Wrapf(err, "failed downloading package %s:%s from %s",
-				p.Package, p.Version, sanitizeURLForLogs(resp.Package.Url)))
-			continue
-		}
-
-		if p.Type == config.PackageTypeMlModel {
-			outErr = multierr.Append(outErr, m.mLModelSymlinkCreation(p))
-		}
-
-		// add to managed packages
-		newManagedPackages[PackageName(p.Name)] = &p
-
-		m.logger.Debugf("Package sync complete [%d/%d] %s:%s after %v", idx+1, len(changedPackages), p.Package, p.Version, time.Since(pkgStart))
 	}
+	workers.Wait()
 
 	if len(changedPackages) > 0 {
 		m.logger.Infof("Package sync complete after %v", time.Since(start))
@@ -214,6 +200,42 @@ func (m *cloudManager) Sync(ctx context.Context, packages []config.PackageConfig
 	return outErr
 }
 
+// syncPackage looks up the download url for a single package and installs it. Errors are logged
+// and returned.
+func (m *cloudManager) syncPackage(ctx context.Context, p config.PackageConfig) error {
+	// Lookup the packages http url
+	includeURL := true
+
+	packageType, err := config.PackageTypeToProto(p.Type)
+	if err != nil {
+		m.logger.Warnw("failed to get package type", "package", p.Name, "error", err)
+	}
+	resp, err := m.client.GetPackage(ctx, &pb.GetPackageRequest{
+		Id:         p.Package,
+		Version:    p.Version,
+		Type:       packageType,
+		IncludeUrl: &includeURL,
+	})
+	if err != nil {
+		m.logger.Errorf("Failed fetching package details for package %s:%s, %s", p.Package, p.Version, err)
+		return errors.Wrapf(err, "failed loading package url for %s:%s", p.Package, p.Version)
+	}
+
+	m.logger.Debugf("Downloading from %s", sanitizeURLForLogs(resp.Package.Url))
+
+	// download package from a http endpoint
+	if err := m.installPackageFromURL(ctx, resp.Package.Url, p); err != nil {
+		m.logger.Errorf("Failed downloading package %s:%s from %s, %s", p.Package, p.Version, sanitizeURLForLogs(resp.Package.Url), err)
+		return errors.Wrapf(err, "failed downloading package %s:%s from %s",
+			p.Package, p.Version, sanitizeURLForLogs(resp.Package.Url))
+	}
+
+	if p.Type == config.PackageTypeMlModel {
+		return m.mLModelSymlinkCreation(p)
+	}
+	return nil
+}
+
 func (m *cloudManager) validateAndGetChangedPackages(
 	packages []config.PackageConfig,
 ) ([]config.PackageConfig, []config.PackageConfig) {
@@ -258,6 +280,19 @@ func (m *cloudManager) Cleanup(ctx context.Context) error {
 	}
 
 	allErrors = multierr.Append(allErrors, m.mlModelSymlinkCleanup())
+
+	// Drop stored contents that no managed package was installed from.
+	usedContent := map[string]bool{}
+	for _, pkg := range m.managedPackages {
+		statusFile, err := readStatusFile(*pkg, m.packagesDir)
+		if err != nil {
+			continue
+		}
+		if statusFile.ContentKey != "" {
+			usedContent[statusFile.ContentKey] = true
+		}
+	}
+	allErrors = multierr.Append(allErrors, m.contentStore.retainOnly(usedContent))
 	return allErrors
 }
 
@@ -318,70 +353,205 @@ func sanitizeURLForLogs(u string) string {
 	return parsed.String()
 }
 
-func (m *cloudManager) downloadFileFromGCSURL(
-	ctx context.Context,
-	url string,
-	downloadPath string,
-	partID string,
-	partSecret string,
-) (string, string, error) {
-	getReq, err := http.NewRequestWithContext(ctx, http.MethodGet, url, nil)
-	getReq.Header.Add("part_id", partID)
-	getReq.Header.Add("secret", partSecret)
-	if err != nil {
-		return "", "", err
+// installPackageFromURL streams a package tarball from GCS into the package's data directory. The
+// tarball is unpacked as it downloads into a staging directory, its checksum is verified once the
+// stream ends, and the staging directory is then renamed into place. If the content store already
+// holds the tarball's contents, the download is abandoned after the response headers and the
+// stored contents are linked in instead.
+func (m *cloudManager) installPackageFromURL(ctx context.Context, url string, p config.PackageConfig) error {
+	// Create the parent directory for the package type if it doesn't exist
+	if err := os.MkdirAll(p.LocalDataParentDirectory(m.packagesDir), 0o700); err != nil {
+		return err
 	}
 
-	//nolint:bodyclose /// closed in UncheckedErrorFunc
-	resp, err := m.httpClient.Do(getReq)
+	// Force redownload of package archive.
+	if err := cleanup(m.packagesDir, p); err != nil {
+		m.logger.Debug(err)
+	}
+
+	if p.Type == config.PackageTypeMlModel {
+		symlinkPath, err := rutils.SafeJoinDir(m.packagesDir, p.Name)
+		if err == nil {
+			if err := os.Remove(symlinkPath); err != nil {
+				utils.UncheckedError(err)
+			}
+		}
+	}
+
+	statusFile := packageSyncFile{
+		PackageID:    p.Package,
+		Version:      p.Version,
+		ModifiedTime: time.Now(),
+		Status:       syncStatusDownloading,
+	}
+	if err := writeStatusFile(p, statusFile, m.packagesDir); err != nil {
+		return err
+	}
+
+	resp, err := m.openGCSDownload(ctx, url, m.cloudConfig.ID, m.cloudConfig.Secret)
 	if err != nil {
-		return "", "", err
+		return err
 	}
 	defer utils.UncheckedErrorFunc(resp.Body.Close)
 
-	if resp.StatusCode != http.StatusOK {
-		return "", "", fmt.Errorf("invalid status code %d", resp.StatusCode)
+	if contentType := resp.Header.Get("Content-Type"); contentType != allowedContentType {
+		utils.UncheckedError(cleanup(m.packagesDir, p))
+		return fmt.Errorf("unknown content-type for package %s", contentType)
 	}
 
-	contentType := resp.Header.Get("Content-Type")
 	checksum := getGoogleHash(resp.Header, "crc32c")
+	checksumBytes, err := base64.StdEncoding.DecodeString(checksum)
+	if err != nil {
+		utils.UncheckedError(cleanup(m.packagesDir, p))
+		return errors.Wrapf(err, "failed to decode expected checksum: %s", checksum)
+	}
 
-	//nolint:gosec // safe
-	out, err := os.Create(downloadPath)
+	// unpack to temp directory to ensure we do an atomic rename once finished.
+	stagingDir, err := os.MkdirTemp(p.LocalDataParentDirectory(m.packagesDir), "*.tmp")
 	if err != nil {
-		return checksum, contentType, err
+		return errors.Wrap(err, "failed to create temp data dir path")
+	}
+	defer func() {
+		if err := os.RemoveAll(stagingDir); err != nil {
+			m.logger.Debug(err)
+		}
+	}()
+
+	contentKey := contentKeyFromHeaders(resp.Header)
+	reused := false
+	if contentKey != "" {
+		unlock := m.contentStore.lock(contentKey)
+		defer unlock()
+
+		if reused, err = m.contentStore.materialize(ctx, contentKey, stagingDir); err != nil {
+			m.logger.Debugw("failed to reuse stored package contents, downloading", "package", p.Name, "error", err)
+			reused = false
+			utils.UncheckedError(os.RemoveAll(stagingDir))
+		}
 	}
-	defer utils.UncheckedErrorFunc(out.Close)
 
-	hash := crc32Hash()
-	w := io.MultiWriter(out, hash)
+	if reused {
+		m.logger.Debugf("Reusing stored contents for package %s:%s", p.Package, p.Version)
+	} else {
+		stored, err := m.unpackAndStore(ctx, resp.Body, checksumBytes, stagingDir, contentKey)
+		if err != nil {
+			utils.UncheckedError(cleanup(m.packagesDir, p))
+			return err
+		}
+		if !stored {
+			contentKey = ""
+		}
+	}
 
-	_, err = io.CopyN(w, resp.Body, maxPackageSize)
-	if err != nil && !errors.Is(err, io.EOF) {
-		utils.UncheckedError(os.Remove(downloadPath))
-		return checksum, contentType, err
+	if err := os.Rename(stagingDir, p.LocalDataDirectory(m.packagesDir)); err != nil {
+		utils.UncheckedError(cleanup(m.packagesDir, p))
+		return err
 	}
 
-	checksumBytes, err := base64.StdEncoding.DecodeString(checksum)
+	statusFile.ModifiedTime = time.Now()
+	statusFile.Status = syncStatusDone
+	statusFile.TarballChecksum = checksum
+	statusFile.ContentKey = contentKey
+	if err := writeStatusFile(p, statusFile, m.packagesDir); err != nil {
+		utils.UncheckedError(cleanup(m.packagesDir, p))
+		return err
+	}
+
+	return nil
+}
+
+// unpackAndStore unpacks the tarball in `body` into `toDir`. When `contentKey` is set, the verified
+// tarball is also kept in the content store under it. The returned bool reports whether it was
+// kept. Failing to keep it does not fail the install.
+func (m *cloudManager) unpackAndStore(
+	ctx context.Context, body io.Reader, expected []byte, toDir, contentKey string,
+) (bool, error) {
+	if contentKey == "" {
+		return false, unpackVerifiedStream(ctx, body, expected, toDir)
+	}
+
+	archive, err := m.contentStore.createTemp()
 	if err != nil {
-		return "", "", errors.Wrapf(err, "failed to decode expected checksum: %s", checksum)
+		m.logger.Debugw("failed to store package contents for reuse", "error", err)
+		return false, unpackVerifiedStream(ctx, body, expected, toDir)
 	}
+	defer func() {
+		// The file is gone once it was added to the store.
+		if err := os.Remove(archive.Name()); err != nil && !errors.Is(err, fs.ErrNotExist) {
+			m.logger.Debug(err)
+		}
+	}()
 
-	trimmedChecksumBytes := trimLeadingZeroes(checksumBytes)
+	err = unpackVerifiedStream(ctx, io.TeeReader(body, archive), expected, toDir)
+	closeErr := archive.Close()
+	if err != nil {
+		return false, err
+	}
+	if closeErr == nil {
+		closeErr = m.contentStore.add(contentKey, archive.Name())
+	}
+	if closeErr != nil {
+		m.logger.Debugw("failed to store package contents for reuse", "error", closeErr)
+		return false, nil
+	}
+	return true, nil
+}
+
+// unpackVerifiedStream unpacks a tgz stream into `toDir` while computing its crc32c checksum. The
+// stream is read to the end and an error is returned if its checksum does not match `expected`.
+func unpackVerifiedStream(ctx context.Context, body io.Reader, expected []byte, toDir string) error {
+	hash := crc32Hash()
+	src := io.TeeReader(io.LimitReader(body, maxPackageSize), hash)
+	if err := unpackStream(ctx, src, toDir); err != nil {
+		return err
+	}
+
+	// The archive may end before the stream does, e.g. with tar padding. Those bytes are part of the
+	// checksum.
+	if _, err := io.Copy(io.Discard, src); err != nil {
+		return err
+	}
+
+	trimmedChecksumBytes := trimLeadingZeroes(expected)
 	trimmedOutHashBytes := trimLeadingZeroes(hash.Sum(nil))
 
 	if !bytes.Equal(trimmedOutHashBytes, trimmedChecksumBytes) {
-		utils.UncheckedError(os.Remove(downloadPath))
-		return checksum, contentType, errors.Errorf(
+		return errors.Errorf(
 			"download did not match expected hash:\n"+
 				"  pre-trimmed: %x vs. %x\n"+
 				"  trimmed:     %x vs. %x",
-			checksumBytes, hash.Sum(nil),
+			expected, hash.Sum(nil),
 			trimmedChecksumBytes, trimmedOutHashBytes,
 		)
 	}
+	return nil
+}
 
-	return checksum, contentType, nil
+// openGCSDownload issues the GET request for a package tarball. The caller must close the response
+// body.
+func (m *cloudManager) openGCSDownload(
+	ctx context.Context,
+	url string,
+	partID string,
+	partSecret string,
+) (*http.Response, error) {
+	getReq, err := http.NewRequestWithContext(ctx, http.MethodGet, url, nil)
+	if err != nil {
+		return nil, err
+	}
+	getReq.Header.Add("part_id", partID)
+	getReq.Header.Add("secret", partSecret)
+
+	resp, err := m.httpClient.Do(getReq)
+	if err != nil {
+		return nil, err
+	}
+
+	if resp.StatusCode != http.StatusOK {
+		utils.UncheckedError(resp.Body.Close())
+		return nil, fmt.Errorf("invalid status code %d", resp.StatusCode)
+	}
+	return resp, nil
 }
 
 func trimLeadingZeroes(data []byte) []byte {
@@ -235,6 +235,64 @@ func TestCloud(t *testing.T) {
 		test.That(t, downloadCount, test.ShouldEqual, 2)
 	})
 
+	t.Run("identical tarballs are stored once", func(t *testing.T) {
+		packageDir, pm := newPackageManager(t, client, fakeServer, logger, "")
+		defer utils.UncheckedErrorFunc(func() error { return pm.Close(context.Background()) })
+
+		// The fake server serves the same tarball for every package.
+		input := []config.PackageConfig{
+			{Name: "some-name", Package: "org1/test-model", Version: "v1", Type: "ml_model"},
+			{Name: "some-name-2", Package: "org1/test-model", Version: "v2", Type: "ml_model"},
+			{Name: "some-name-3", Package: "org1/other-model", Version: "v1", Type: "ml_model"},
+		}
+		fakeServer.StorePackage(input...)
+
+		err = pm.Sync(ctx, input, []config.Module{})
+		test.That(t, err, test.ShouldBeNil)
+		validatePackageDir(t, packageDir, input)
+
+		storeEntries, err := os.ReadDir(filepath.Join(packageDir, contentStoreDirName))
+		test.That(t, err, test.ShouldBeNil)
+		test.That(t, len(storeEntries), test.ShouldEqual, 1)
+		// Only the tarball is kept, not a second unpacked copy of the package.
+		test.That(t, storeEntries[0].Type().IsRegular(), test.ShouldBeTrue)
+
+		var firstPath string
+		for _, p := range input {
+			statusFile, err := readStatusFile(p, packageDir)
+			test.That(t, err, test.ShouldBeNil)
+			test.That(t, statusFile.ContentKey, test.ShouldEqual, storeEntries[0].Name())
+
+			putils.ValidateContentsOfPPackage(t, p.LocalDataDirectory(packageDir))
+			path := filepath.Join(p.LocalDataDirectory(packageDir), "some-text.txt")
+			if firstPath == "" {
+				firstPath = path
+				continue
+			}
+			firstInfo, err := os.Stat(firstPath)
+			test.That(t, err, test.ShouldBeNil)
+			info, err := os.Stat(path)
+			test.That(t, err, test.ShouldBeNil)
+			test.That(t, os.SameFile(firstInfo, info), test.ShouldBeFalse)
+		}
+
+		// Writing inside of one package leaves the store and the other packages alone.
+		test.That(t, os.WriteFile(firstPath, []byte("changed"), 0o600), test.ShouldBeNil)
+		for _, p := range input[1:] {
+			putils.ValidateContentsOfPPackage(t, p.LocalDataDirectory(packageDir))
+		}
+
+		// Once no package references the stored contents, cleanup removes them.
+		err = pm.Sync(ctx, []config.PackageConfig{}, []config.Module{})
+		test.That(t, err, test.ShouldBeNil)
+		err = pm.Cleanup(ctx)
+		test.That(t, err, test.ShouldBeNil)
+
+		storeEntries, err = os.ReadDir(filepath.Join(packageDir, contentStoreDirName))
+		test.That(t, err, test.ShouldBeNil)
+		test.That(t, storeEntries, test.ShouldBeEmpty)
+	})
+
 	t.Run("upgrade version", func(t *testing.T) {
 		packageDir, pm := newPackageManager(t, client, fakeServer, logger, "")
 		defer utils.UncheckedErrorFunc(func() error { return pm.Close(context.Background()) })
@@ -397,8 +455,8 @@ func validatePackageDir(t *testing.T, dir string, input []config.PackageConfig)
 			continue
 		}
 
-		// skip over any directories including the data
-		if f.IsDir() && f.Name() == "data" {
+		// skip over any directories including the data and the content store
+		if f.IsDir() && (f.Name() == "data" || f.Name() == contentStoreDirName) {
 			continue
 		}
 
@@ -0,0 +1,184 @@
+package packages
+
+import (
+	"context"
+	"encoding/base64"
+	"encoding/hex"
+	"io/fs"
+	"net/http"
+	"os"
+	"path/filepath"
+	"sync"
+
+	"github.com/pkg/errors"
+	"go.uber.org/multierr"
+	"go.viam.com/utils"
+
+	"go.viam.com/rdk/logging"
+	rutils "go.viam.com/rdk/utils"
+)
+
+// contentStoreDirName is the directory inside of the packages directory that holds verified package
+// tarballs keyed by their hashes.
+const contentStoreDirName = ".content"
+
+// contentStore keeps the tarball of every distinct package that has been installed. Installing a
+// package whose tarball is already in the store unpacks the stored tarball into the package's data
+// directory rather than downloading it again. This covers the same tarball uploaded under several
+// versions or package names. Only the compressed tarball is kept, never a second unpacked tree, and
+// every package gets its own files so that writes inside one package never reach the store or any
+// other package.
+//
+// Entries are keyed by the hashes the storage backend advertises for the object. The crc32c hash is
+// verified while downloading, so an entry only ever holds a tarball that matched its key.
+type contentStore struct {
+	dir    string
+	logger logging.Logger
+
+	// mu guards keyLocks. A key is locked while it is being looked up or populated such that two
+	// packages with identical contents syncing in parallel only download them once.
+	mu       sync.Mutex
+	keyLocks map[string]*keyLock
+}
+
+// keyLock is the lock of a single key, along with how many callers hold or wait on it such that it
+// can be dropped once none do.
+type keyLock struct {
+	sync.Mutex
+	refs int
+}
+
+func newContentStore(packagesDir string, logger logging.Logger) (*contentStore, error) {
+	dir := filepath.Join(packagesDir, contentStoreDirName)
+	if err := os.MkdirAll(dir, 0o700); err != nil {
+		return nil, err
+	}
+
+	return &contentStore{
+		dir:      dir,
+		logger:   logger,
+		keyLocks: make(map[string]*keyLock),
+	}, nil
+}
+
+// contentKeyFromHeaders returns the store key for a GCS download response. An empty string is
+// returned when the response does not advertise enough hashes to address its contents.
+func contentKeyFromHeaders(headers http.Header) string {
+	md5Hash, err := base64.StdEncoding.DecodeString(getGoogleHash(headers, "md5"))
+	if err != nil || len(md5Hash) == 0 {
+		return ""
+	}
+
+	crcHash, err := base64.StdEncoding.DecodeString(getGoogleHash(headers, "crc32c"))
+	if err != nil || len(crcHash) == 0 {
+		return ""
+	}
+
+	return "md5-" + hex.EncodeToString(md5Hash) + "-crc32c-" + hex.EncodeToString(trimLeadingZeroes(crcHash))
+}
+
+// lock serializes all work on `key` and returns the matching unlock function.
+func (cs *contentStore) lock(key string) func() {
+	cs.mu.Lock()
+	kl, ok := cs.keyLocks[key]
+	if !ok {
+		kl = &keyLock{}
+		cs.keyLocks[key] = kl
+	}
+	kl.refs++
+	cs.mu.Unlock()
+
+	kl.Lock()
+	return func() {
+		kl.Unlock()
+
+		cs.mu.Lock()
+		defer cs.mu.Unlock()
+		kl.refs--
+		if kl.refs == 0 {
+			delete(cs.keyLocks, key)
+		}
+	}
+}
+
+func (cs *contentStore) path(key string) (string, error) {
+	return rutils.SafeJoinDir(cs.dir, key)
+}
+
+// materialize unpacks the stored tarball for `key` into `toDir`. It returns false if the store does
+// not have the key.
+func (cs *contentStore) materialize(ctx context.Context, key, toDir string) (bool, error) {
+	entryPath, err := cs.path(key)
+	if err != nil {
+		return false, err
+	}
+
+	//nolint:gosec // path sanitized with rutils.SafeJoinDir
+	archive, err := os.Open(entryPath)
+	if err != nil {
+		if errors.Is(err, fs.ErrNotExist) {
+			return false, nil
+		}
+		return false, err
+	}
+	defer utils.UncheckedErrorFunc(archive.Close)
+
+	if err := unpackStream(ctx, archive, toDir); err != nil {
+		// Drop an unreadable entry, e.g. one left by an older layout, so that the next download
+		// replaces it.
+		if ctx.Err() == nil {
+			utils.UncheckedError(os.RemoveAll(entryPath))
+		}
+		return true, err
+	}
+	return true, nil
+}
+
+// createTemp returns a new temporary file in the store to download a tarball into. The file is
+// either handed to add or removed by the caller.
+func (cs *contentStore) createTemp() (*os.File, error) {
+	return os.CreateTemp(cs.dir, "*.tmp")
+}
+
+// add records the verified tarball at `tmpPath`, created with createTemp, under `key`. The tarball is
+// renamed into place such that a partially written entry is never visible.
+func (cs *contentStore) add(key, tmpPath string) error {
+	entryPath, err := cs.path(key)
+	if err != nil {
+		return err
+	}
+
+	if err := os.Rename(tmpPath, entryPath); err != nil {
+		// Another process may have stored the same contents first. That is as good as ours.
+		if _, statErr := os.Stat(entryPath); statErr == nil {
+			return nil
+		}
+		return err
+	}
+	return nil
+}
+
+// retainOnly removes every entry whose key is not in `keep`, including any leftover temporary
+// files.
+func (cs *contentStore) retainOnly(keep map[string]bool) error {
+	entries, err := os.ReadDir(cs.dir)
+	if err != nil {
+		return err
+	}
+
+	var allErrors error
+	for _, entry := range entries {
+		if keep[entry.Name()] {
+			continue
+		}
+
+		entryPath, err := cs.path(entry.Name())
+		if err != nil {
+			allErrors = multierr.Append(allErrors, err)
+			continue
+		}
+		cs.logger.Debugf("Removing unused package contents %s", entry.Name())
+		allErrors = multierr.Append(allErrors, os.RemoveAll(entryPath))
+	}
+	return allErrors
+}
@@ -118,10 +118,6 @@ func cleanup(packagesDir string, p config.PackageConfig) error {
 
 // unpackFile extracts a tgz to a directory.
 func unpackFile(ctx context.Context, fromFile, toDir string) error {
-	if err := os.MkdirAll(toDir, 0o700); err != nil {
-		return err
-	}
-
 	//nolint:gosec // safe
 	f, err := os.Open(fromFile)
 	if err != nil {
@@ -129,7 +125,17 @@ func unpackFile(ctx context.Context, fromFile, toDir string) error {
 	}
 	defer utils.UncheckedErrorFunc(f.Close)
 
-	archive, err := gzip.NewReader(f)
+	return unpackStream(ctx, f, toDir)
+}
+
+// unpackStream extracts a tgz read from `src` to a directory. The archive is extracted as it is
+// read, so `src` may be a network stream. `src` is not necessarily read to EOF.
+func unpackStream(ctx context.Context, src io.Reader, toDir string) error {
+	if err := os.MkdirAll(toDir, 0o700); err != nil {
+		return err
+	}
+
+	archive, err := gzip.NewReader(src)
 	if err != nil {
 		return err
 	}
@@ -302,6 +308,8 @@ type packageSyncFile struct {
 	ModifiedTime    time.Time  `json:"modified_time"`
 	Status          syncStatus `json:"sync_status"`
 	TarballChecksum string     `json:"tarball_checksum"`
+	// ContentKey is the content store entry the package was installed from, if any.
+	ContentKey string `json:"content_key,omitempty"`
 }
 
 var statusFileExt = ".status.json"
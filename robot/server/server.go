@@ -18,7 +18,9 @@ import (
 	vprotoutils "go.viam.com/utils/protoutils"
 	"go.viam.com/utils/rpc"
 	"google.golang.org/grpc/codes"
+	"google.golang.org/grpc/metadata"
 	grpcstatus "google.golang.org/grpc/status"
+	"google.golang.org/protobuf/proto"
 	"google.golang.org/protobuf/types/known/durationpb"
 	"google.golang.org/protobuf/types/known/structpb"
 	"google.golang.org/protobuf/types/known/timestamppb"
@@ -31,6 +33,7 @@ import (
 	"go.viam.com/rdk/resource"
 	"go.viam.com/rdk/robot"
 	"go.viam.com/rdk/session"
+	"go.viam.com/rdk/spatialmath"
 )
 
 // logTSKey is the key used in conjunction with the timestamp of logs received
@@ -41,13 +44,15 @@ const logTSKey = "log_ts"
 // a robot.Robot as a gRPC server.
 type Server struct {
 	pb.UnimplementedRobotServiceServer
-	robot robot.Robot
+	robot    robot.Robot
+	statuses *statusAggregator
 }
 
 // New constructs a gRPC service server for a Robot.
 func New(robot robot.Robot) pb.RobotServiceServer {
 	return &Server{
-		robot: robot,
+		robot:    robot,
+		statuses: newStatusAggregator(robot),
 	}
 }
 
@@ -248,11 +253,29 @@ func (s *Server) TransformPose(ctx context.Context, req *pb.TransformPoseRequest
 // TransformPCD will transform the pointcloud to the desired frame in the robot's frame system.
 // Do not move the robot between the generation of the initial pointcloud and the receipt
 // of the transformed pointcloud because that will make the transformations inaccurate.
-// TODO(RSDK-1123): PCD files have a field called VIEWPOINT which encodes an offset as a translation+quaternion.
-// if we used VIEWPOINT, you only need to query the frame system to get the transform between the source and destination frame.
-// Then, you put that transform as a translation+quaternion in the VIEWPOINT field. You would only change one line in the PCD file,
-// rather than having to decode and then encode every point in the PCD. Would be a considerable speed up.
+// Binary PCDs are transformed in place without decoding them, and any other PCD is decoded,
+// transformed and re-encoded as a binary PCD.
 func (s *Server) TransformPCD(ctx context.Context, req *pb.TransformPCDRequest) (*pb.TransformPCDResponse, error) {
+	if req.Source != "" {
+		dst := req.Destination
+		if dst == "" {
+			dst = referenceframe.World
+		}
+		// get transform pose needed to get to destination frame
+		sourceFrameZero := referenceframe.NewPoseInFrame(req.Source, spatialmath.NewZeroPose())
+		theTransform, err := s.robot.TransformPose(ctx, sourceFrameZero, dst, nil)
+		if err != nil {
+			return nil, err
+		}
+		ok, err := pointcloud.TransformBinaryPCD(req.PointCloudPcd, theTransform.Pose())
+		if err != nil {
+			return nil, err
+		}
+		if ok {
+			return &pb.TransformPCDResponse{PointCloudPcd: req.PointCloudPcd}, nil
+		}
+	}
+
 	// transform PCD bytes to pointcloud
 	pc, err := pointcloud.ReadPCD(bytes.NewReader(req.PointCloudPcd))
 	if err != nil {
@@ -275,65 +298,91 @@ func (s *Server) TransformPCD(ctx context.Context, req *pb.TransformPCDRequest)
 
 // GetStatus takes a list of resource names and returns their corresponding statuses. If no names are passed in, return all statuses.
 func (s *Server) GetStatus(ctx context.Context, req *pb.GetStatusRequest) (*pb.GetStatusResponse, error) {
-	resourceNames := make([]resource.Name, 0, len(req.ResourceNames))
-	for _, name := range req.ResourceNames {
-		resourceNames = append(resourceNames, protoutils.ResourceNameFromProto(name))
-	}
-
-	statuses, err := s.robot.Status(ctx, resourceNames)
+	statuses, err := robotStatus(ctx, s.robot, req.ResourceNames)
 	if err != nil {
 		return nil, err
 	}
-
-	statusesP := make([]*pb.Status, 0, len(statuses))
-	for _, status := range statuses {
-		statusP, err := vprotoutils.StructToStructPb(status.Status)
-		if err != nil {
-			return nil, err
-		}
-		statusesP = append(
-			statusesP,
-			&pb.Status{
-				Name:             protoutils.ResourceNameToProto(status.Name),
-				LastReconfigured: timestamppb.New(status.LastReconfigured),
-				Status:           statusP,
-			},
-		)
-	}
-
-	return &pb.GetStatusResponse{Status: statusesP}, nil
+	return &pb.GetStatusResponse{Status: statuses}, nil
 }
 
 const defaultStreamInterval = 1 * time.Second
 
+// StatusChangesOnlyMetadataKey is the metadata key a client sets to "true" on a StreamStatus call to
+// be sent only the statuses that changed since the previous message, rather than all of them. A
+// resource that is no longer reported is sent once with only its name. No message is sent for a
+// tick on which nothing changed.
+const StatusChangesOnlyMetadataKey = "viam-status-changes-only"
+
 // StreamStatus periodically sends the status of all statuses requested. An empty request signifies all resources.
+// Streams from the same caller requesting the same resources at the same interval share the statuses
+// computed each tick.
 func (s *Server) StreamStatus(req *pb.StreamStatusRequest, streamServer pb.RobotService_StreamStatusServer) error {
 	every := defaultStreamInterval
 	if reqEvery := req.Every.AsDuration(); reqEvery != time.Duration(0) {
 		every = reqEvery
 	}
-	ticker := time.NewTicker(every)
-	defer ticker.Stop()
+	var sent map[string]*pb.Status
+	if md, ok := metadata.FromIncomingContext(streamServer.Context()); ok {
+		if values := md.Get(StatusChangesOnlyMetadataKey); len(values) > 0 && values[0] == "true" {
+			sent = map[string]*pb.Status{}
+		}
+	}
+
+	snapshots, unsubscribe := s.statuses.subscribe(streamServer.Context(), req.ResourceNames, every)
+	defer unsubscribe()
 	for {
-		if !utils.SelectContextOrWaitChan(streamServer.Context(), ticker.C) {
+		var snapshot statusSnapshot
+		select {
+		case <-streamServer.Context().Done():
 			return streamServer.Context().Err()
+		case snapshot = <-snapshots:
 		}
 
-		status, err := s.GetStatus(streamServer.Context(), &pb.GetStatusRequest{ResourceNames: req.ResourceNames})
 		switch {
-		case err == nil:
-		case grpcstatus.Code(err) == codes.Unimplemented:
+		case snapshot.err == nil:
+		case grpcstatus.Code(snapshot.err) == codes.Unimplemented:
 			return nil
 		default:
-			return err
+			return snapshot.err
 		}
 
-		if err := streamServer.Send(&pb.StreamStatusResponse{Status: status.Status}); err != nil {
+		statuses := snapshot.statuses
+		if sent != nil {
+			statuses = changedStatuses(sent, statuses)
+			if len(statuses) == 0 {
+				continue
+			}
+		}
+		if err := streamServer.Send(&pb.StreamStatusResponse{Status: statuses}); err != nil {
 			return err
 		}
 	}
 }
 
+// changedStatuses returns the statuses that differ from the ones last sent, along with a status
+// holding only the name of each resource sent before that is no longer reported, and records them
+// as sent.
+func changedStatuses(sent map[string]*pb.Status, statuses []*pb.Status) []*pb.Status {
+	var changed []*pb.Status
+	reported := make(map[string]struct{}, len(statuses))
+	for _, status := range statuses {
+		key := protoutils.ResourceNameFromProto(status.Name).String()
+		reported[key] = struct{}{}
+		if prev, ok := sent[key]; ok && proto.Equal(prev, status) {
+			continue
+		}
+		sent[key] = status
+		changed = append(changed, status)
+	}
+	for key, prev := range sent {
+		if _, ok := reported[key]; !ok {
+			delete(sent, key)
+			changed = append(changed, &pb.Status{Name: prev.Name})
+		}
+	}
+	return changed
+}
+
 // StopAll will stop all current and outstanding operations for the robot and stops all actuators and movement.
 func (s *Server) StopAll(ctx context.Context, req *pb.StopAllRequest) (*pb.StopAllResponse, error) {
 	extra := map[resource.Name]map[string]interface{}{}
@@ -19,6 +19,7 @@ import (
 	"go.viam.com/test"
 	vprotoutils "go.viam.com/utils/protoutils"
 	"google.golang.org/grpc"
+	"google.golang.org/grpc/metadata"
 	"google.golang.org/grpc/peer"
 	"google.golang.org/protobuf/types/known/durationpb"
 	"google.golang.org/protobuf/types/known/timestamppb"
@@ -686,6 +687,58 @@ func TestServerGetStatus(t *testing.T) {
 	})
 }
 
+func TestServerStreamStatusShared(t *testing.T) {
+	injectRobot := &inject.Robot{}
+	srv := server.New(injectRobot)
+	var mu sync.Mutex
+	calls := 0
+	injectRobot.StatusFunc = func(ctx context.Context, resourceNames []resource.Name) ([]robot.Status, error) {
+		mu.Lock()
+		defer mu.Unlock()
+		calls++
+		return []robot.Status{
+			{Name: arm.Named("still"), Status: map[string]interface{}{}},
+			{Name: arm.Named("moving"), Status: map[string]interface{}{"calls": calls}},
+		}, nil
+	}
+
+	cancelCtx, cancel := context.WithCancel(context.Background())
+	defer cancel()
+	dur := 100 * time.Millisecond
+	stream := func(ctx context.Context, messageCh chan *pb.StreamStatusResponse) chan error {
+		errCh := make(chan error, 1)
+		go func() {
+			//nolint:staticcheck // the status API is deprecated
+			errCh <- srv.StreamStatus(&pb.StreamStatusRequest{Every: durationpb.New(dur)},
+				&statusStreamServer{ctx: ctx, messageCh: messageCh})
+		}()
+		return errCh
+	}
+
+	// A stream asking for changes only gets every status first, and then just the one that changes.
+	changesCh := make(chan *pb.StreamStatusResponse)
+	changesErr := stream(metadata.NewIncomingContext(cancelCtx,
+		metadata.Pairs(server.StatusChangesOnlyMetadataKey, "true")), changesCh)
+	fullCh := make(chan *pb.StreamStatusResponse)
+	fullErr := stream(cancelCtx, fullCh)
+
+	for i := 0; i < 3; i++ {
+		full := <-fullCh
+		test.That(t, len(full.Status), test.ShouldEqual, 2)
+		changes := <-changesCh
+		if i == 0 {
+			test.That(t, len(changes.Status), test.ShouldEqual, 2)
+		} else {
+			test.That(t, len(changes.Status), test.ShouldEqual, 1)
+			test.That(t, changes.Status[0].Name.Name, test.ShouldEqual, "moving")
+		}
+	}
+
+	cancel()
+	test.That(t, <-changesErr, test.ShouldEqual, context.Canceled)
+	test.That(t, <-fullErr, test.ShouldEqual, context.Canceled)
+}
+
 type statusStreamServer struct {
 	grpc.ServerStream // not set
 	ctx               context.Context
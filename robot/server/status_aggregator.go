@@ -0,0 +1,175 @@
+package server
+
+import (
+	"context"
+	"sort"
+	"strings"
+	"sync"
+	"time"
+
+	commonpb "go.viam.com/api/common/v1"
+	pb "go.viam.com/api/robot/v1"
+	"go.viam.com/utils"
+	vprotoutils "go.viam.com/utils/protoutils"
+	"go.viam.com/utils/rpc"
+	"google.golang.org/protobuf/types/known/timestamppb"
+
+	"go.viam.com/rdk/protoutils"
+	"go.viam.com/rdk/resource"
+	"go.viam.com/rdk/robot"
+	"go.viam.com/rdk/session"
+)
+
+// statusSnapshot is the status of a set of resources at one tick of a feed, already converted to
+// protobuf. Its statuses are shared by every stream it is sent on and must not be modified.
+type statusSnapshot struct {
+	// at is when the statuses were computed.
+	at       time.Time
+	statuses []*pb.Status
+	err      error
+}
+
+// statusAggregator computes the statuses sent by StreamStatus. Streams from the same caller that
+// request the same resources at the same interval share a feed, which computes one snapshot per
+// tick for all of them rather than each stream querying the robot on its own.
+type statusAggregator struct {
+	robot robot.Robot
+
+	mu    sync.Mutex
+	feeds map[statusFeedKey]*statusFeed
+}
+
+type statusFeedKey struct {
+	// caller is the auth entity and session of the streams, whose context the feed queries with.
+	caller string
+	names  string
+	every  time.Duration
+}
+
+type statusFeed struct {
+	// subscribers each hold at most the latest snapshot not yet taken by their stream.
+	subscribers map[chan statusSnapshot]struct{}
+	latest      statusSnapshot
+	cancel      context.CancelFunc
+}
+
+func newStatusAggregator(r robot.Robot) *statusAggregator {
+	return &statusAggregator{robot: r, feeds: map[statusFeedKey]*statusFeed{}}
+}
+
+// subscribe returns a channel that receives a snapshot of the statuses of the named resources
+// every interval. The robot is queried with the values, such as metadata and session, of the ctx
+// of the stream that started the feed. Call the returned function once done with it.
+func (a *statusAggregator) subscribe(
+	ctx context.Context,
+	names []*commonpb.ResourceName,
+	every time.Duration,
+) (<-chan statusSnapshot, func()) {
+	key := statusFeedKey{caller: statusFeedCaller(ctx), names: statusFeedNames(names), every: every}
+	ch := make(chan statusSnapshot, 1)
+
+	a.mu.Lock()
+	defer a.mu.Unlock()
+	feed, ok := a.feeds[key]
+	if !ok {
+		feedCtx, cancel := context.WithCancel(context.WithoutCancel(ctx))
+		feed = &statusFeed{subscribers: map[chan statusSnapshot]struct{}{}, cancel: cancel}
+		a.feeds[key] = feed
+		utils.PanicCapturingGo(func() { a.runFeed(feedCtx, feed, names, every) })
+	} else if !feed.latest.at.IsZero() && time.Since(feed.latest.at) < every {
+		// A stream joining a running feed starts from its latest snapshot, unless it is older
+		// than a tick and so about to be replaced.
+		ch <- feed.latest
+	}
+	feed.subscribers[ch] = struct{}{}
+
+	return ch, func() {
+		a.mu.Lock()
+		defer a.mu.Unlock()
+		delete(feed.subscribers, ch)
+		if len(feed.subscribers) == 0 {
+			feed.cancel()
+			delete(a.feeds, key)
+		}
+	}
+}
+
+// statusFeedCaller identifies who is streaming such that only streams from the same auth entity and
+// session share a feed, and with it the context the robot is queried with.
+func statusFeedCaller(ctx context.Context) string {
+	var caller string
+	if authEntity, ok := rpc.ContextAuthEntity(ctx); ok {
+		caller = authEntity.Entity
+	}
+	if sess, ok := session.FromContext(ctx); ok {
+		caller += "/" + sess.ID().String()
+	}
+	return caller
+}
+
+// statusFeedNames returns the same string for any two requests for the same set of resources.
+func statusFeedNames(names []*commonpb.ResourceName) string {
+	strs := make([]string, 0, len(names))
+	for _, name := range names {
+		strs = append(strs, protoutils.ResourceNameFromProto(name).String())
+	}
+	sort.Strings(strs)
+	return strings.Join(strs, "\n")
+}
+
+func (a *statusAggregator) runFeed(ctx context.Context, feed *statusFeed, names []*commonpb.ResourceName, every time.Duration) {
+	ticker := time.NewTicker(every)
+	defer ticker.Stop()
+	for {
+		if !utils.SelectContextOrWaitChan(ctx, ticker.C) {
+			return
+		}
+
+		statuses, err := robotStatus(ctx, a.robot, names)
+		snapshot := statusSnapshot{at: time.Now(), statuses: statuses, err: err}
+
+		a.mu.Lock()
+		feed.latest = snapshot
+		for ch := range feed.subscribers {
+			// Replace any snapshot the stream has not taken yet, so a slow stream skips ahead
+			// rather than holding up the others.
+			select {
+			case <-ch:
+			default:
+			}
+			ch <- snapshot
+		}
+		a.mu.Unlock()
+	}
+}
+
+// robotStatus returns the statuses of the named resources, or of all resources if there are no
+// names, converted to protobuf.
+func robotStatus(ctx context.Context, r robot.Robot, names []*commonpb.ResourceName) ([]*pb.Status, error) {
+	resourceNames := make([]resource.Name, 0, len(names))
+	for _, name := range names {
+		resourceNames = append(resourceNames, protoutils.ResourceNameFromProto(name))
+	}
+
+	statuses, err := r.Status(ctx, resourceNames)
+	if err != nil {
+		return nil, err
+	}
+
+	statusesP := make([]*pb.Status, 0, len(statuses))
+	for _, status := range statuses {
+		statusP, err := vprotoutils.StructToStructPb(status.Status)
+		if err != nil {
+			return nil, err
+		}
+		statusesP = append(
+			statusesP,
+			&pb.Status{
+				Name:             protoutils.ResourceNameToProto(status.Name),
+				LastReconfigured: timestamppb.New(status.LastReconfigured),
+				Status:           statusP,
+			},
+		)
+	}
+	return statusesP, nil
+}
@@ -0,0 +1,95 @@
+package server
+
+import (
+	"context"
+	"sync/atomic"
+	"testing"
+	"time"
+
+	pb "go.viam.com/api/robot/v1"
+	"go.viam.com/test"
+
+	"go.viam.com/rdk/components/arm"
+	"go.viam.com/rdk/protoutils"
+	"go.viam.com/rdk/resource"
+	"go.viam.com/rdk/robot"
+)
+
+type statusFuncRobot struct {
+	robot.Robot
+	statusFunc func(ctx context.Context, resourceNames []resource.Name) ([]robot.Status, error)
+}
+
+func (r *statusFuncRobot) Status(ctx context.Context, resourceNames []resource.Name) ([]robot.Status, error) {
+	return r.statusFunc(ctx, resourceNames)
+}
+
+func TestStatusAggregatorSharesTicks(t *testing.T) {
+	// Each Status call waits to be released, so that every tick is one call.
+	release := make(chan struct{})
+	var calls atomic.Int64
+	r := &statusFuncRobot{statusFunc: func(ctx context.Context, resourceNames []resource.Name) ([]robot.Status, error) {
+		select {
+		case <-release:
+		case <-ctx.Done():
+			return nil, ctx.Err()
+		}
+		n := calls.Add(1)
+		return []robot.Status{{Name: arm.Named("a"), Status: map[string]interface{}{"calls": float64(n)}}}, nil
+	}}
+	aggregator := newStatusAggregator(r)
+	every := 10 * time.Millisecond
+
+	const numStreams = 5
+	var snapshotChs []<-chan statusSnapshot
+	for i := 0; i < numStreams; i++ {
+		ch, unsubscribe := aggregator.subscribe(context.Background(), nil, every)
+		defer unsubscribe()
+		snapshotChs = append(snapshotChs, ch)
+	}
+
+	for tick := 1; tick <= 3; tick++ {
+		release <- struct{}{}
+		var first statusSnapshot
+		for i, ch := range snapshotChs {
+			snapshot := <-ch
+			test.That(t, snapshot.err, test.ShouldBeNil)
+			test.That(t, snapshot.statuses[0].Status.AsMap()["calls"], test.ShouldEqual, float64(tick))
+			if i == 0 {
+				first = snapshot
+				continue
+			}
+			// every stream is sent the very same statuses
+			test.That(t, snapshot.at, test.ShouldEqual, first.at)
+			test.That(t, snapshot.statuses[0], test.ShouldEqual, first.statuses[0])
+		}
+		test.That(t, calls.Load(), test.ShouldEqual, tick)
+	}
+
+	// A stream joining after the latest snapshot has gone stale waits for the next one.
+	time.Sleep(2 * every)
+	late, unsubscribe := aggregator.subscribe(context.Background(), nil, every)
+	defer unsubscribe()
+	select {
+	case <-late:
+		t.Fatal("late stream was sent a stale snapshot")
+	default:
+	}
+}
+
+func TestChangedStatuses(t *testing.T) {
+	still := &pb.Status{Name: protoutils.ResourceNameToProto(arm.Named("still"))}
+	gone := &pb.Status{Name: protoutils.ResourceNameToProto(arm.Named("gone"))}
+	sent := map[string]*pb.Status{}
+
+	changed := changedStatuses(sent, []*pb.Status{still, gone})
+	test.That(t, changed, test.ShouldResemble, []*pb.Status{still, gone})
+	test.That(t, changedStatuses(sent, []*pb.Status{still, gone}), test.ShouldBeEmpty)
+
+	// A resource that disappears is reported once by name.
+	changed = changedStatuses(sent, []*pb.Status{still})
+	test.That(t, len(changed), test.ShouldEqual, 1)
+	test.That(t, changed[0].Name, test.ShouldResemble, gone.Name)
+	test.That(t, changed[0].Status, test.ShouldBeNil)
+	test.That(t, changedStatuses(sent, []*pb.Status{still}), test.ShouldBeEmpty)
+}
@@ -381,6 +381,19 @@ func (ms *builtIn) ListPlanStatuses(
 	return ms.state.ListPlanStatuses(req)
 }
 
+// WatchPlanStatus implements motion.PlanStatusWatcher.
+func (ms *builtIn) WatchPlanStatus(
+	ctx context.Context,
+	req motion.PlanHistoryReq,
+) (<-chan motion.PlanStatusWithID, error) {
+	if err := ctx.Err(); err != nil {
+		return nil, err
+	}
+	ms.mu.RLock()
+	defer ms.mu.RUnlock()
+	return ms.state.WatchPlanStatus(ctx, req)
+}
+
 func (ms *builtIn) PlanHistory(
 	ctx context.Context,
 	req motion.PlanHistoryReq,
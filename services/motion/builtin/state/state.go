@@ -95,6 +95,15 @@ func (cs componentState) lastExecutionID() motion.ExecutionID {
 	return cs.executionIDHistory[0]
 }
 
+// execution returns the execution with the given ID, or the last execution if the ID is uuid.Nil.
+func (cs componentState) execution(executionID motion.ExecutionID) (stateExecution, bool) {
+	if executionID == uuid.Nil {
+		return cs.lastExecution(), true
+	}
+	ex, exists := cs.executionsByID[executionID]
+	return ex, exists
+}
+
 // execution represents the state of a motion planning execution.
 // it only ever exists in state.StartExecution function & the go routine created.
 type execution[R any] struct {
@@ -289,9 +298,11 @@ type State struct {
 	cancelFunc context.CancelFunc
 	logger     logging.Logger
 	ttl        time.Duration
-	// mu protects the componentStateByComponent
+	// mu protects the componentStateByComponent & planStatusChanged
 	mu                        sync.RWMutex
 	componentStateByComponent map[resource.Name]componentState
+	// planStatusChanged is closed & replaced whenever the status of a plan changes
+	planStatusChanged chan struct{}
 }
 
 // NewState creates a new state.
@@ -325,6 +336,7 @@ func NewState(
 		cancelFunc:                cancelFunc,
 		waitGroup:                 &sync.WaitGroup{},
 		componentStateByComponent: make(map[resource.Name]componentState),
+		planStatusChanged:         make(chan struct{}),
 		ttl:                       ttl,
 		logger:                    logger,
 	}
@@ -438,12 +450,7 @@ func (s *State) PlanHistory(req motion.PlanHistoryReq) ([]motion.PlanWithStatus,
 
 	// last plan only
 	if req.LastPlanOnly {
-		if ex := cs.lastExecution(); executionID == uuid.Nil || executionID == ex.id {
-			return renderableHistory(ex.history[:1]), nil
-		}
-
-		// if executionID is provided & doesn't match the last execution for the component
-		if ex, exists := cs.executionsByID[executionID]; exists {
+		if ex, exists := cs.execution(executionID); exists {
 			return renderableHistory(ex.history[:1]), nil
 		}
 		return nil, resource.NewNotFoundError(req.ComponentName)
@@ -460,6 +467,80 @@ func (s *State) PlanHistory(req motion.PlanHistoryReq) ([]motion.PlanWithStatus,
 	return renderableHistory(cs.lastExecution().history), nil
 }
 
+// WatchPlanStatus returns a channel which receives the current status of the plan PlanHistory would
+// return with LastPlanOnly set, and then the status of the last plan of the same execution each time it changes
+// (including when a replan replaces the plan). The channel is closed once a terminal status has
+// been sent, or when ctx is done, which the caller must ensure happens if it stops receiving early.
+func (s *State) WatchPlanStatus(ctx context.Context, req motion.PlanHistoryReq) (<-chan motion.PlanStatusWithID, error) {
+	last, changed, err := s.planStatus(req)
+	if err != nil {
+		return nil, err
+	}
+	// keep watching this execution even if the component starts another one
+	req.ExecutionID = last.ExecutionID
+
+	statuses := make(chan motion.PlanStatusWithID, 1)
+	statuses <- last
+	utils.PanicCapturingGo(func() {
+		defer close(statuses)
+		for {
+			if _, terminal := motion.TerminalStateSet[last.Status.State]; terminal {
+				return
+			}
+			select {
+			case <-ctx.Done():
+				return
+			case <-changed:
+			}
+
+			status, next, err := s.planStatus(req)
+			if err != nil {
+				s.logger.CDebugf(ctx, "stopped watching the plan status of execution %s: %s", req.ExecutionID, err)
+				return
+			}
+			changed = next
+			if status.PlanID == last.PlanID && status.Status.State == last.Status.State {
+				continue
+			}
+			select {
+			case <-ctx.Done():
+				return
+			case statuses <- status:
+				last = status
+			}
+		}
+	})
+	return statuses, nil
+}
+
+// planStatus returns the status PlanStatus returns, along with the channel which will be closed
+// the next time a plan status changes after it.
+func (s *State) planStatus(req motion.PlanHistoryReq) (motion.PlanStatusWithID, <-chan struct{}, error) {
+	s.mu.RLock()
+	defer s.mu.RUnlock()
+	cs, exists := s.componentStateByComponent[req.ComponentName]
+	if !exists {
+		return motion.PlanStatusWithID{}, nil, resource.NewNotFoundError(req.ComponentName)
+	}
+	ex, exists := cs.execution(req.ExecutionID)
+	if !exists {
+		return motion.PlanStatusWithID{}, nil, resource.NewNotFoundError(req.ComponentName)
+	}
+	last := ex.history[0]
+	return motion.PlanStatusWithID{
+		PlanID:        last.Plan.ID,
+		ComponentName: ex.componentName,
+		ExecutionID:   ex.id,
+		Status:        last.StatusHistory[0],
+	}, s.planStatusChanged, nil
+}
+
+// notifyPlanStatusChanged wakes up everything watching a plan status. Hold the write lock to call this.
+func (s *State) notifyPlanStatusChanged() {
+	close(s.planStatusChanged)
+	s.planStatusChanged = make(chan struct{})
+}
+
 // visualHistory returns the history struct that has had its plans Offset by.
 func renderableHistory(history []motion.PlanWithStatus) []motion.PlanWithStatus {
 	newHistory := make([]motion.PlanWithStatus, len(history))
@@ -553,6 +634,7 @@ func (s *State) updateStateNewExecution(newE stateExecution) {
 }
 
 func (s *State) updateStateNewPlan(newPlan planMsg) {
+	defer s.notifyPlanStatusChanged()
 	if newPlan.planStatus.State != motion.PlanStateInProgress {
 		err := errors.New("handleNewPlan received a plan status other than in progress")
 		s.logger.Error(err.Error())
@@ -575,6 +657,7 @@ func (s *State) updateStateNewPlan(newPlan planMsg) {
 }
 
 func (s *State) updateStateStatusUpdate(update stateUpdateMsg) {
+	defer s.notifyPlanStatusChanged()
 	switch update.planStatus.State {
 	// terminal states
 	case motion.PlanStateSucceeded, motion.PlanStateFailed, motion.PlanStateStopped:
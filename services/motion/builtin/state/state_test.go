@@ -1051,3 +1051,83 @@ func pollUntil[T any](ctx context.Context, f func() (T, bool)) (T, bool) {
 		}
 	}
 }
+
+func TestWatchPlanStatus(t *testing.T) {
+	logger := logging.NewTestLogger(t)
+	myBase := base.Named("mybase")
+	ctx := context.Background()
+
+	s, err := state.NewState(ttl, ttlCheckInterval, logger)
+	test.That(t, err, test.ShouldBeNil)
+	defer s.Stop()
+
+	req := motion.PlanHistoryReq{ComponentName: myBase}
+	_, err = s.WatchPlanStatus(ctx, req)
+	test.That(t, err, test.ShouldBeError, resource.NewNotFoundError(myBase))
+
+	// each execute waits to be told whether to replan
+	replan := make(chan bool)
+	constructor := func(
+		ctx context.Context,
+		_ motion.MoveOnGlobeReq,
+		_ motionplan.Plan,
+		_ int,
+	) (state.PlannerExecutor, error) {
+		return &testPlannerExecutor{executeFunc: func(ctx context.Context, plan motionplan.Plan) (state.ExecuteResponse, error) {
+			select {
+			case <-ctx.Done():
+				return state.ExecuteResponse{}, ctx.Err()
+			case r := <-replan:
+				return state.ExecuteResponse{Replan: r, ReplanReason: replanReason}, nil
+			}
+		}}, nil
+	}
+	executionID, err := state.StartExecution(ctx, s, myBase, motion.MoveOnGlobeReq{ComponentName: myBase}, constructor)
+	test.That(t, err, test.ShouldBeNil)
+
+	timeoutCtx, timeoutFn := context.WithTimeout(ctx, 5*time.Second)
+	defer timeoutFn()
+	statuses, err := s.WatchPlanStatus(timeoutCtx, req)
+	test.That(t, err, test.ShouldBeNil)
+	status := <-statuses
+	ph, err := s.PlanHistory(motion.PlanHistoryReq{ComponentName: myBase, LastPlanOnly: true})
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, status, test.ShouldResemble, motion.PlanStatusWithID{
+		PlanID:        ph[0].Plan.ID,
+		ComponentName: myBase,
+		ExecutionID:   executionID,
+		Status:        ph[0].StatusHistory[0],
+	})
+
+	// a replan is seen as the new plan in progress
+	replan <- true
+	replanned := <-statuses
+	test.That(t, replanned.ExecutionID, test.ShouldEqual, executionID)
+	test.That(t, replanned.PlanID, test.ShouldNotEqual, status.PlanID)
+	test.That(t, replanned.Status.State, test.ShouldEqual, motion.PlanStateInProgress)
+
+	replan <- false
+	succeeded := <-statuses
+	test.That(t, succeeded.PlanID, test.ShouldEqual, replanned.PlanID)
+	test.That(t, succeeded.Status.State, test.ShouldEqual, motion.PlanStateSucceeded)
+	_, open := <-statuses
+	test.That(t, open, test.ShouldBeFalse)
+
+	// watching a plan which has already ended only sends its status
+	statuses, err = s.WatchPlanStatus(ctx, motion.PlanHistoryReq{ComponentName: myBase, ExecutionID: executionID})
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, <-statuses, test.ShouldResemble, succeeded)
+	_, open = <-statuses
+	test.That(t, open, test.ShouldBeFalse)
+
+	// cancelling the watch closes the channel
+	_, err = state.StartExecution(ctx, s, myBase, motion.MoveOnGlobeReq{ComponentName: myBase}, constructor)
+	test.That(t, err, test.ShouldBeNil)
+	cancelCtx, cancelFn := context.WithCancel(ctx)
+	statuses, err = s.WatchPlanStatus(cancelCtx, req)
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, (<-statuses).Status.State, test.ShouldEqual, motion.PlanStateInProgress)
+	cancelFn()
+	_, open = <-statuses
+	test.That(t, open, test.ShouldBeFalse)
+}
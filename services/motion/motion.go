@@ -10,6 +10,7 @@ import (
 	geo "github.com/kellydunn/golang-geo"
 	"github.com/pkg/errors"
 	pb "go.viam.com/api/service/motion/v1"
+	"go.viam.com/utils"
 	"google.golang.org/protobuf/types/known/timestamppb"
 
 	"go.viam.com/rdk/motionplan"
@@ -474,8 +475,19 @@ func (ps PlanState) String() string {
 	}
 }
 
-// PollHistoryUntilSuccessOrError polls `PlanHistory()` with `req` every `interval`
-// until a terminal state is reached.
+// PlanStatusWatcher is implemented by motion services which can push the status of a plan as it
+// changes, rather than having their PlanHistory polled.
+type PlanStatusWatcher interface {
+	// WatchPlanStatus returns a channel which receives the status of the last plan of the execution
+	// req refers to, first as it is and then each time it changes. The channel is closed once a
+	// terminal status has been sent or ctx is done.
+	WatchPlanStatus(ctx context.Context, req PlanHistoryReq) (<-chan PlanStatusWithID, error)
+}
+
+// PollHistoryUntilSuccessOrError waits until the plan history `req` refers to reaches a
+// terminal state. If `m` is a PlanStatusWatcher the status is watched. Otherwise `PlanHistory()`
+// is called once to find the execution, whose status is then polled every `interval` through
+// `ListPlanStatuses()`, which does not send the plans themselves.
 // An error is returned if the terminal state is Failed, Stopped or an invalid state
 // or if the context has an error.
 // nil is returned if the terminal state is Succeeded.
@@ -485,37 +497,99 @@ func PollHistoryUntilSuccessOrError(
 	interval time.Duration,
 	req PlanHistoryReq,
 ) error {
+	if err := ctx.Err(); err != nil {
+		return err
+	}
+	if w, ok := m.(PlanStatusWatcher); ok {
+		return watchUntilSuccessOrError(ctx, w, req)
+	}
+
+	ph, err := m.PlanHistory(ctx, req)
+	if err != nil {
+		return err
+	}
+	if done, err := planStatusOutcome(ph[0].StatusHistory[0]); done {
+		return err
+	}
+
+	executionID := ph[0].Plan.ExecutionID
 	for {
-		if err := ctx.Err(); err != nil {
-			return err
+		if !utils.SelectContextOrWait(ctx, interval) {
+			return ctx.Err()
 		}
 
-		ph, err := m.PlanHistory(ctx, req)
+		statuses, err := m.ListPlanStatuses(ctx, ListPlanStatusesReq{Extra: req.Extra})
 		if err != nil {
 			return err
 		}
+		status, ok := executionStatus(statuses, executionID)
+		if !ok {
+			return fmt.Errorf("no plan status found for execution %s", executionID)
+		}
+		if done, err := planStatusOutcome(status); done {
+			return err
+		}
+	}
+}
 
-		status := ph[0].StatusHistory[0]
+// executionStatus returns the status of the execution with the given ID out of the statuses of
+// all plans. An execution is in progress while any of its plans is, and otherwise has the status
+// its plans ended with last.
+func executionStatus(statuses []PlanStatusWithID, executionID ExecutionID) (PlanStatus, bool) {
+	var status PlanStatus
+	found := false
+	for _, s := range statuses {
+		if s.ExecutionID != executionID {
+			continue
+		}
+		if s.Status.State == PlanStateInProgress {
+			return s.Status, true
+		}
+		if !found || s.Status.Timestamp.After(status.Timestamp) {
+			status = s.Status
+			found = true
+		}
+	}
+	return status, found
+}
 
-		switch status.State {
-		case PlanStateInProgress:
-		case PlanStateFailed:
-			err := errors.New("plan failed")
-			if reason := status.Reason; reason != nil {
-				err = errors.Wrap(err, *reason)
-			}
+func watchUntilSuccessOrError(ctx context.Context, w PlanStatusWatcher, req PlanHistoryReq) error {
+	cancelCtx, cancelFn := context.WithCancel(ctx)
+	defer cancelFn()
+	statuses, err := w.WatchPlanStatus(cancelCtx, req)
+	if err != nil {
+		return err
+	}
+	for status := range statuses {
+		if done, err := planStatusOutcome(status.Status); done {
 			return err
+		}
+	}
+	if err := ctx.Err(); err != nil {
+		return err
+	}
+	return errors.New("plan status watch ended before the plan reached a terminal state")
+}
 
-		case PlanStateStopped:
-			return errors.New("plan stopped")
+// planStatusOutcome returns whether status is terminal, and the error the plan ended with if so.
+func planStatusOutcome(status PlanStatus) (bool, error) {
+	switch status.State {
+	case PlanStateInProgress:
+		return false, nil
+	case PlanStateFailed:
+		err := errors.New("plan failed")
+		if reason := status.Reason; reason != nil {
+			err = errors.Wrap(err, *reason)
+		}
+		return true, err
 
-		case PlanStateSucceeded:
-			return nil
+	case PlanStateStopped:
+		return true, errors.New("plan stopped")
 
-		default:
-			return fmt.Errorf("invalid plan state %d", status.State)
-		}
+	case PlanStateSucceeded:
+		return true, nil
 
-		time.Sleep(interval)
+	default:
+		return true, fmt.Errorf("invalid plan state %d", status.State)
 	}
 }
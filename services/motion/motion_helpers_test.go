@@ -5,6 +5,7 @@ import (
 	"testing"
 	"time"
 
+	"github.com/google/uuid"
 	"github.com/pkg/errors"
 	"go.viam.com/test"
 
@@ -73,15 +74,36 @@ func TestPollHistoryUntilSuccessOrError(t *testing.T) {
 		test.That(t, err, test.ShouldBeNil)
 	})
 
-	t.Run("returns polls until a terminal state is reached", func(t *testing.T) {
-		var callCount int
+	t.Run("polls plan statuses until a terminal state is reached", func(t *testing.T) {
+		executionID := uuid.New()
+		var historyCount int
 		ms.PlanHistoryFunc = func(ctx context.Context, req motion.PlanHistoryReq) ([]motion.PlanWithStatus, error) {
-			callCount++
-			switch callCount {
+			historyCount++
+			return []motion.PlanWithStatus{{
+				Plan:          motion.PlanWithMetadata{ExecutionID: executionID},
+				StatusHistory: []motion.PlanStatus{{State: motion.PlanStateInProgress}},
+			}}, nil
+		}
+		now := time.Now()
+		var statusCount int
+		ms.ListPlanStatusesFunc = func(ctx context.Context, req motion.ListPlanStatusesReq) ([]motion.PlanStatusWithID, error) {
+			statusCount++
+			// A replan fails the old plan, and another execution is in progress throughout.
+			statuses := []motion.PlanStatusWithID{
+				{ExecutionID: uuid.New(), Status: motion.PlanStatus{State: motion.PlanStateInProgress}},
+				{ExecutionID: executionID, Status: motion.PlanStatus{State: motion.PlanStateFailed, Timestamp: now}},
+			}
+			switch statusCount {
 			case 1:
-				return []motion.PlanWithStatus{{StatusHistory: []motion.PlanStatus{{State: motion.PlanStateInProgress}}}}, nil
+				return append(statuses, motion.PlanStatusWithID{
+					ExecutionID: executionID,
+					Status:      motion.PlanStatus{State: motion.PlanStateInProgress, Timestamp: now},
+				}), nil
 			case 2:
-				return []motion.PlanWithStatus{{StatusHistory: []motion.PlanStatus{{State: motion.PlanStateSucceeded}}}}, nil
+				return append(statuses, motion.PlanStatusWithID{
+					ExecutionID: executionID,
+					Status:      motion.PlanStatus{State: motion.PlanStateSucceeded, Timestamp: now.Add(time.Second)},
+				}), nil
 			default:
 				t.Error("should not be called")
 				t.FailNow()
@@ -90,5 +112,58 @@ func TestPollHistoryUntilSuccessOrError(t *testing.T) {
 		}
 		err := motion.PollHistoryUntilSuccessOrError(ctx, ms, time.Millisecond, motion.PlanHistoryReq{})
 		test.That(t, err, test.ShouldBeNil)
+		test.That(t, historyCount, test.ShouldEqual, 1)
+		test.That(t, statusCount, test.ShouldEqual, 2)
+	})
+
+	t.Run("returns an error if the execution has no plan statuses", func(t *testing.T) {
+		ms.PlanHistoryFunc = func(ctx context.Context, req motion.PlanHistoryReq) ([]motion.PlanWithStatus, error) {
+			return []motion.PlanWithStatus{{StatusHistory: []motion.PlanStatus{{State: motion.PlanStateInProgress}}}}, nil
+		}
+		ms.ListPlanStatusesFunc = func(ctx context.Context, req motion.ListPlanStatusesReq) ([]motion.PlanStatusWithID, error) {
+			return nil, nil
+		}
+		err := motion.PollHistoryUntilSuccessOrError(ctx, ms, time.Millisecond, motion.PlanHistoryReq{})
+		test.That(t, err, test.ShouldNotBeNil)
 	})
 }
+
+type watchingMotionService struct {
+	*inject.MotionService
+	statuses []motion.PlanStatus
+}
+
+func (ms *watchingMotionService) WatchPlanStatus(
+	ctx context.Context,
+	req motion.PlanHistoryReq,
+) (<-chan motion.PlanStatusWithID, error) {
+	statuses := make(chan motion.PlanStatusWithID, len(ms.statuses))
+	for _, status := range ms.statuses {
+		statuses <- motion.PlanStatusWithID{Status: status}
+	}
+	close(statuses)
+	return statuses, nil
+}
+
+func TestPollHistoryUntilSuccessOrErrorWatcher(t *testing.T) {
+	ctx := context.Background()
+	ms := &watchingMotionService{MotionService: inject.NewMotionService("my motion")}
+	ms.PlanHistoryFunc = func(ctx context.Context, req motion.PlanHistoryReq) ([]motion.PlanWithStatus, error) {
+		t.Error("should not be called")
+		t.FailNow()
+		return nil, nil
+	}
+
+	ms.statuses = []motion.PlanStatus{{State: motion.PlanStateInProgress}, {State: motion.PlanStateSucceeded}}
+	err := motion.PollHistoryUntilSuccessOrError(ctx, ms, time.Millisecond, motion.PlanHistoryReq{})
+	test.That(t, err, test.ShouldBeNil)
+
+	reason := "this is the fail reason"
+	ms.statuses = []motion.PlanStatus{{State: motion.PlanStateInProgress}, {State: motion.PlanStateFailed, Reason: &reason}}
+	err = motion.PollHistoryUntilSuccessOrError(ctx, ms, time.Millisecond, motion.PlanHistoryReq{})
+	test.That(t, err, test.ShouldBeError, errors.Wrap(errors.New("plan failed"), reason))
+
+	ms.statuses = []motion.PlanStatus{{State: motion.PlanStateInProgress}}
+	err = motion.PollHistoryUntilSuccessOrError(ctx, ms, time.Millisecond, motion.PlanHistoryReq{})
+	test.That(t, err, test.ShouldBeError, errors.New("plan status watch ended before the plan reached a terminal state"))
+}
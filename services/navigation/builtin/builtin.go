@@ -605,6 +605,7 @@ func (svc *builtIn) moveToWaypoint(ctx context.Context, wp navigation.Waypoint,
 		}
 	}()
 
+	// the plan status is watched if the motion service supports it, and only polled otherwise
 	err = motion.PollHistoryUntilSuccessOrError(cancelCtx, svc.motionService, planHistoryPollFrequency,
 		motion.PlanHistoryReq{
 			ComponentName: req.ComponentName,
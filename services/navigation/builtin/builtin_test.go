@@ -641,6 +641,7 @@ func setupStartWaypoint(ctx context.Context, t *testing.T, logger logging.Logger
 		},
 	}
 	injectMS := inject.NewMotionService("test_motion")
+	injectMS.ListPlanStatusesFunc = planStatusesFromHistory(injectMS)
 	deps := resource.Dependencies{
 		injectMS.Name():             injectMS,
 		fakeBase.Name():             fakeBase,
@@ -659,6 +660,30 @@ func setupStartWaypoint(ctx context.Context, t *testing.T, logger logging.Logger
 	}
 }
 
+// planStatusesFromHistory returns a ListPlanStatuses implementation which reports the current
+// status of every plan the injected PlanHistory returns, such that tests only need to inject the
+// latter.
+func planStatusesFromHistory(
+	injectMS *inject.MotionService,
+) func(context.Context, motion.ListPlanStatusesReq) ([]motion.PlanStatusWithID, error) {
+	return func(ctx context.Context, req motion.ListPlanStatusesReq) ([]motion.PlanStatusWithID, error) {
+		history, err := injectMS.PlanHistory(ctx, motion.PlanHistoryReq{})
+		if err != nil {
+			return nil, err
+		}
+		statuses := make([]motion.PlanStatusWithID, 0, len(history))
+		for _, p := range history {
+			statuses = append(statuses, motion.PlanStatusWithID{
+				PlanID:        p.Plan.ID,
+				ComponentName: p.Plan.ComponentName,
+				ExecutionID:   p.Plan.ExecutionID,
+				Status:        p.StatusHistory[0],
+			})
+		}
+		return statuses, nil
+	}
+}
+
 func setupStartWaypointExplore(ctx context.Context, t *testing.T, logger logging.Logger) startWaypointState {
 	fsSvc, err := framesystem.New(ctx, nil, logger)
 	test.That(t, err, test.ShouldBeNil)
@@ -692,6 +717,7 @@ func setupStartWaypointExplore(ctx context.Context, t *testing.T, logger logging
 		},
 	}
 	injectMS := inject.NewMotionService("test_motion")
+	injectMS.ListPlanStatusesFunc = planStatusesFromHistory(injectMS)
 	deps := resource.Dependencies{
 		injectMS.Name():             injectMS,
 		fakeBase.Name():             fakeBase,
@@ -1,11 +1,13 @@
 // Package obstaclesdistance uses an underlying camera to fulfill vision service methods, specifically
-// GetObjectPointClouds, which performs several queries of NextPointCloud and returns a median point.
+// GetObjectPointClouds, which performs several queries of NextPointCloud (or samples it in the
+// background) and returns a median point.
 package obstaclesdistance
 
 import (
 	"context"
 	"math"
 	"sort"
+	"time"
 
 	"github.com/golang/geo/r3"
 	"github.com/pkg/errors"
@@ -31,6 +33,14 @@ const DefaultNumQueries = 10
 // for the obstacle distance detection service.
 type DistanceDetectorConfig struct {
 	NumQueries int `json:"num_queries"`
+	// If SamplingFrequencyHz is set, each camera is queried in the background at that rate once it
+	// is first asked about, and requests are answered from the closest points of its last
+	// NumQueries point clouds rather than by querying it NumQueries times.
+	SamplingFrequencyHz float64 `json:"sampling_frequency_hz,omitempty"`
+	// MaxStalenessMs is how old a background reading can be and still be used. If no reading is
+	// recent enough, the camera is queried directly. Defaults to the time taken to fill the window.
+	// Only valid along with SamplingFrequencyHz.
+	MaxStalenessMs int `json:"max_staleness_ms,omitempty"`
 }
 
 func init() {
@@ -46,7 +56,7 @@ func init() {
 			if err != nil {
 				return nil, err
 			}
-			return registerObstacleDistanceDetector(ctx, c.ResourceName(), attrs, actualR)
+			return registerObstacleDistanceDetector(ctx, c.ResourceName(), attrs, actualR, logger)
 		},
 	})
 }
@@ -60,6 +70,15 @@ func (config *DistanceDetectorConfig) Validate(path string) ([]string, error) {
 	if config.NumQueries < 1 || config.NumQueries > 20 {
 		return nil, errors.New("invalid number of queries, pick a number between 1 and 20")
 	}
+	if config.SamplingFrequencyHz < 0 {
+		return nil, errors.New("sampling_frequency_hz cannot be negative")
+	}
+	if config.MaxStalenessMs < 0 {
+		return nil, errors.New("max_staleness_ms cannot be negative")
+	}
+	if config.MaxStalenessMs > 0 && config.SamplingFrequencyHz == 0 {
+		return nil, errors.New("max_staleness_ms requires sampling_frequency_hz to be set")
+	}
 	return deps, nil
 }
 
@@ -68,6 +87,7 @@ func registerObstacleDistanceDetector(
 	name resource.Name,
 	conf *DistanceDetectorConfig,
 	r robot.Robot,
+	logger logging.Logger,
 ) (svision.Service, error) {
 	_, span := trace.StartSpan(ctx, "service::vision::registerObstacleDistanceDetector")
 	defer span.End()
@@ -75,26 +95,32 @@ func registerObstacleDistanceDetector(
 		return nil, errors.New("config for obstacles_distance cannot be nil")
 	}
 
-	segmenter := func(ctx context.Context, src camera.VideoSource) ([]*vision.Object, error) {
-		clouds := make([]pointcloud.PointCloud, 0, conf.NumQueries)
+	var samplers *closestPointSamplers
+	var closer func(ctx context.Context) error
+	if conf.SamplingFrequencyHz > 0 {
+		interval := time.Duration(float64(time.Second) / conf.SamplingFrequencyHz)
+		maxStaleness := time.Duration(conf.MaxStalenessMs) * time.Millisecond
+		if maxStaleness == 0 {
+			maxStaleness = time.Duration(conf.NumQueries) * interval
+		}
+		samplers = newClosestPointSamplers(conf.NumQueries, interval, maxStaleness, logger)
+		closer = samplers.Close
+	}
 
-		for i := 0; i < conf.NumQueries; i++ {
-			nxtPC, err := src.NextPointCloud(ctx)
+	segmenter := func(ctx context.Context, src camera.VideoSource) ([]*vision.Object, error) {
+		var median r3.Vector
+		if res, ok := src.(resource.Resource); ok && samplers != nil {
+			var err error
+			median, err = samplers.median(ctx, res.Name().String(), src, conf.NumQueries)
 			if err != nil {
 				return nil, err
 			}
-			if nxtPC.Size() == 0 {
-				continue
+		} else {
+			closestPoints, err := queryClosestPoints(ctx, src, conf.NumQueries)
+			if err != nil {
+				return nil, err
 			}
-			clouds = append(clouds, nxtPC)
-		}
-		if len(clouds) == 0 {
-			return nil, errors.New("none of the input point clouds contained any points")
-		}
-
-		median, err := medianFromPointClouds(ctx, clouds)
-		if err != nil {
-			return nil, err
+			median = getMedianPoint(closestPoints)
 		}
 
 		// package the result into a vision.Object
@@ -103,7 +129,7 @@ func registerObstacleDistanceDetector(
 
 		pcToReturn := pointcloud.New()
 		basicData := pointcloud.NewBasicData()
-		err = pcToReturn.Set(vector, basicData)
+		err := pcToReturn.Set(vector, basicData)
 		if err != nil {
 			return nil, err
 		}
@@ -113,10 +139,32 @@ func registerObstacleDistanceDetector(
 
 		return toReturn, nil
 	}
-	return svision.NewService(name, r, nil, nil, nil, segmenter)
+	return svision.NewService(name, r, closer, nil, nil, segmenter)
+}
+
+// queryClosestPoints queries src numQueries times and returns the closest point of each point cloud
+// that has any points.
+func queryClosestPoints(ctx context.Context, src camera.VideoSource, numQueries int) ([]r3.Vector, error) {
+	clouds := make([]pointcloud.PointCloud, 0, numQueries)
+
+	for i := 0; i < numQueries; i++ {
+		nxtPC, err := src.NextPointCloud(ctx)
+		if err != nil {
+			return nil, err
+		}
+		if nxtPC.Size() == 0 {
+			continue
+		}
+		clouds = append(clouds, nxtPC)
+	}
+	if len(clouds) == 0 {
+		return nil, errors.New("none of the input point clouds contained any points")
+	}
+
+	return closestPointsOfClouds(ctx, clouds)
 }
 
-func medianFromPointClouds(ctx context.Context, clouds []pointcloud.PointCloud) (r3.Vector, error) {
+func closestPointsOfClouds(ctx context.Context, clouds []pointcloud.PointCloud) ([]r3.Vector, error) {
 	var results [][]r3.Vector // a slice for each process, which will contain a slice of vectors
 	err := utils.GroupWorkParallel(
 		ctx,
@@ -135,16 +183,16 @@ func medianFromPointClouds(ctx context.Context, clouds []pointcloud.PointCloud)
 		},
 	)
 	if err != nil {
-		return r3.Vector{}, err
+		return nil, err
 	}
 	candidates := make([]r3.Vector, 0, len(clouds))
 	for _, r := range results {
 		candidates = append(candidates, r...)
 	}
 	if len(candidates) == 0 {
-		return r3.Vector{}, errors.New("point cloud list is empty, could not find median point")
+		return nil, errors.New("point cloud list is empty, could not find median point")
 	}
-	return getMedianPoint(candidates), nil
+	return candidates, nil
 }
 
 func getClosestPoint(cloud pointcloud.PointCloud) r3.Vector {
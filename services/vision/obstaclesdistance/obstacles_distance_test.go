@@ -3,13 +3,18 @@ package obstaclesdistance
 import (
 	"context"
 	"image/color"
+	"sync/atomic"
 	"testing"
+	"time"
 
+	"github.com/golang/geo/r3"
 	"github.com/pkg/errors"
 	"go.viam.com/test"
 	"go.viam.com/utils/artifact"
+	"go.viam.com/utils/testutils"
 
 	"go.viam.com/rdk/components/camera"
+	"go.viam.com/rdk/logging"
 	pc "go.viam.com/rdk/pointcloud"
 	"go.viam.com/rdk/resource"
 	"go.viam.com/rdk/rimage"
@@ -49,7 +54,7 @@ func TestObstacleDist(t *testing.T) {
 		}
 	}
 	name := vision.Named("test_odd")
-	srv, err := registerObstacleDistanceDetector(ctx, name, &inp, r)
+	srv, err := registerObstacleDistanceDetector(ctx, name, &inp, r, logging.NewTestLogger(t))
 	test.That(t, err, test.ShouldBeNil)
 	test.That(t, srv.Name(), test.ShouldResemble, name)
 	img, err := rimage.NewImageFromFile(artifact.MustPath("vision/objectdetection/detection_test.jpg"))
@@ -126,6 +131,87 @@ func TestObstacleDist(t *testing.T) {
 	test.That(t, isPoint, test.ShouldBeTrue)
 
 	// with error - nil parameters
-	_, err = registerObstacleDistanceDetector(ctx, name, nil, r)
+	_, err = registerObstacleDistanceDetector(ctx, name, nil, r, logging.NewTestLogger(t))
 	test.That(t, err.Error(), test.ShouldContainSubstring, "cannot be nil")
 }
+
+func TestObstacleDistSampling(t *testing.T) {
+	ctx := context.Background()
+	r := &inject.Robot{}
+	cam := inject.NewCamera("fakeCamera")
+
+	var count atomic.Int64
+	nums := []float64{10, 9, 4, 5, 3}
+	cam.NextPointCloudFunc = func(ctx context.Context) (pc.PointCloud, error) {
+		cloud := pc.New()
+		err := cloud.Set(pc.NewVector(0, 0, nums[int(count.Add(1)-1)%len(nums)]), pc.NewBasicData())
+		return cloud, err
+	}
+	r.ResourceNamesFunc = func() []resource.Name {
+		return []resource.Name{camera.Named("fakeCamera")}
+	}
+	r.ResourceByNameFunc = func(n resource.Name) (resource.Resource, error) {
+		return cam, nil
+	}
+
+	conf := &DistanceDetectorConfig{NumQueries: 5, SamplingFrequencyHz: 200, MaxStalenessMs: 60000}
+	_, err := conf.Validate("")
+	test.That(t, err, test.ShouldBeNil)
+	srv, err := registerObstacleDistanceDetector(ctx, vision.Named("test_sampling"), conf, r, logging.NewTestLogger(t))
+	test.That(t, err, test.ShouldBeNil)
+	defer func() {
+		test.That(t, srv.Close(ctx), test.ShouldBeNil)
+	}()
+
+	// the first request queries the camera directly, and then starts sampling it
+	objects, err := srv.GetObjectPointClouds(ctx, "fakeCamera", nil)
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, objects[0].Geometry.Pose().Point(), test.ShouldResemble, r3.Vector{0, 0, 5})
+	queried := count.Load()
+	test.That(t, queried, test.ShouldBeGreaterThanOrEqualTo, 5)
+
+	// The sampler only queries the camera again once it has added its last reading, so once it
+	// has started a query past a full window, the window holds only its own readings.
+	testutils.WaitForAssertion(t, func(tb testing.TB) {
+		tb.Helper()
+		test.That(tb, count.Load(), test.ShouldBeGreaterThan, queried+int64(len(nums)))
+	})
+	// the window holds the closest point of each of the last 5 clouds, whichever they were
+	objects, err = srv.GetObjectPointClouds(ctx, "fakeCamera", nil)
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, len(objects), test.ShouldEqual, 1)
+	test.That(t, objects[0].Geometry.Pose().Point(), test.ShouldResemble, r3.Vector{0, 0, 5})
+
+	conf = &DistanceDetectorConfig{SamplingFrequencyHz: -1}
+	_, err = conf.Validate("")
+	test.That(t, err, test.ShouldNotBeNil)
+
+	// max_staleness_ms only applies to background sampling
+	conf = &DistanceDetectorConfig{MaxStalenessMs: 100}
+	_, err = conf.Validate("")
+	test.That(t, err, test.ShouldNotBeNil)
+}
+
+func TestClosestPointSampler(t *testing.T) {
+	sampler := newClosestPointSampler(nil, 3, time.Second, logging.NewTestLogger(t))
+	_, ok := sampler.median(time.Minute)
+	test.That(t, ok, test.ShouldBeFalse)
+
+	now := time.Now()
+	sampler.add(closestPointReading{r3.Vector{0, 0, 1}, now.Add(-time.Hour)})
+	sampler.add(closestPointReading{r3.Vector{0, 0, 7}, now})
+	sampler.add(closestPointReading{r3.Vector{0, 0, 3}, now})
+	median, ok := sampler.median(time.Minute)
+	test.That(t, ok, test.ShouldBeTrue)
+	test.That(t, median, test.ShouldResemble, r3.Vector{0, 0, 3})
+
+	// the oldest reading is replaced
+	sampler.add(closestPointReading{r3.Vector{0, 0, 2}, now})
+	median, ok = sampler.median(2 * time.Hour)
+	test.That(t, ok, test.ShouldBeTrue)
+	test.That(t, median, test.ShouldResemble, r3.Vector{0, 0, 3})
+	sampler.add(closestPointReading{r3.Vector{0, 0, 1}, now})
+	median, ok = sampler.median(time.Minute)
+	test.That(t, ok, test.ShouldBeTrue)
+	test.That(t, median, test.ShouldResemble, r3.Vector{0, 0, 2})
+}
@@ -0,0 +1,186 @@
+package obstaclesdistance
+
+import (
+	"context"
+	"sync"
+	"time"
+
+	"github.com/golang/geo/r3"
+
+	"go.viam.com/rdk/components/camera"
+	"go.viam.com/rdk/logging"
+	"go.viam.com/rdk/utils"
+)
+
+// closestPointReading is the closest point of a point cloud, and when the point cloud was taken.
+type closestPointReading struct {
+	point r3.Vector
+	taken time.Time
+}
+
+// closestPointSampler queries a camera in the background, keeping the closest points of the last
+// point clouds it returned so that their median can be found without waiting on the camera.
+type closestPointSampler struct {
+	interval time.Duration
+	logger   logging.Logger
+
+	startOnce sync.Once
+
+	mu  sync.Mutex
+	src camera.VideoSource
+	// readings is a ring buffer of the most recent readings, the oldest at next once it is full
+	readings []closestPointReading
+	next     int
+}
+
+func newClosestPointSampler(
+	src camera.VideoSource,
+	windowSize int,
+	interval time.Duration,
+	logger logging.Logger,
+) *closestPointSampler {
+	return &closestPointSampler{
+		interval: interval,
+		logger:   logger,
+		src:      src,
+		readings: make([]closestPointReading, 0, windowSize),
+	}
+}
+
+// setSource replaces the camera that is sampled, such as after it is reconfigured.
+func (s *closestPointSampler) setSource(src camera.VideoSource) {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+	s.src = src
+}
+
+// start starts sampling the camera in the background with workers, unless it already has.
+func (s *closestPointSampler) start(workers utils.StoppableWorkers) {
+	s.startOnce.Do(func() { workers.AddWorkers(s.run) })
+}
+
+// run samples the camera every interval until ctx is done.
+func (s *closestPointSampler) run(ctx context.Context) {
+	ticker := time.NewTicker(s.interval)
+	defer ticker.Stop()
+	for {
+		s.mu.Lock()
+		src := s.src
+		s.mu.Unlock()
+
+		cloud, err := src.NextPointCloud(ctx)
+		switch {
+		case err != nil:
+			if ctx.Err() == nil {
+				s.logger.CDebugw(ctx, "failed to sample point cloud for obstacles_distance", "error", err)
+			}
+		case cloud.Size() > 0:
+			s.add(closestPointReading{point: getClosestPoint(cloud), taken: time.Now()})
+		}
+
+		select {
+		case <-ctx.Done():
+			return
+		case <-ticker.C:
+		}
+	}
+}
+
+func (s *closestPointSampler) add(reading closestPointReading) {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+	if len(s.readings) < cap(s.readings) {
+		s.readings = append(s.readings, reading)
+		return
+	}
+	s.readings[s.next] = reading
+	s.next = (s.next + 1) % len(s.readings)
+}
+
+// median returns the median of the closest points taken no earlier than maxStaleness ago, and false
+// if there are none.
+func (s *closestPointSampler) median(maxStaleness time.Duration) (r3.Vector, bool) {
+	cutoff := time.Now().Add(-maxStaleness)
+	s.mu.Lock()
+	candidates := make([]r3.Vector, 0, len(s.readings))
+	for _, reading := range s.readings {
+		if !reading.taken.Before(cutoff) {
+			candidates = append(candidates, reading.point)
+		}
+	}
+	s.mu.Unlock()
+	if len(candidates) == 0 {
+		return r3.Vector{}, false
+	}
+	return getMedianPoint(candidates), true
+}
+
+// closestPointSamplers holds a sampler for each camera the obstacles_distance service is asked about.
+type closestPointSamplers struct {
+	windowSize   int
+	interval     time.Duration
+	maxStaleness time.Duration
+	logger       logging.Logger
+
+	mu       sync.Mutex
+	samplers map[string]*closestPointSampler
+	workers  utils.StoppableWorkers
+}
+
+func newClosestPointSamplers(
+	windowSize int,
+	interval, maxStaleness time.Duration,
+	logger logging.Logger,
+) *closestPointSamplers {
+	return &closestPointSamplers{
+		windowSize:   windowSize,
+		interval:     interval,
+		maxStaleness: maxStaleness,
+		logger:       logger,
+		samplers:     map[string]*closestPointSampler{},
+		workers:      utils.NewStoppableWorkers(),
+	}
+}
+
+// median returns the median closest point of the camera named name. It is answered from the
+// camera's sampler if it has recent enough readings. Otherwise the camera is queried numQueries
+// times directly, and the closest points found seed the sampler. A camera is only sampled in the
+// background once it has been queried directly the first time, so that the two never compete for it
+// then.
+func (ss *closestPointSamplers) median(
+	ctx context.Context,
+	name string,
+	src camera.VideoSource,
+	numQueries int,
+) (r3.Vector, error) {
+	ss.mu.Lock()
+	sampler, ok := ss.samplers[name]
+	if !ok {
+		sampler = newClosestPointSampler(src, ss.windowSize, ss.interval, ss.logger)
+		ss.samplers[name] = sampler
+	}
+	ss.mu.Unlock()
+	if ok {
+		sampler.setSource(src)
+	}
+	if median, ok := sampler.median(ss.maxStaleness); ok {
+		return median, nil
+	}
+
+	closestPoints, err := queryClosestPoints(ctx, src, numQueries)
+	if err != nil {
+		return r3.Vector{}, err
+	}
+	taken := time.Now()
+	for _, point := range closestPoints {
+		sampler.add(closestPointReading{point: point, taken: taken})
+	}
+	sampler.start(ss.workers)
+	return getMedianPoint(closestPoints), nil
+}
+
+// Close stops sampling every camera.
+func (ss *closestPointSamplers) Close(ctx context.Context) error {
+	ss.workers.Stop()
+	return nil
+}
@@ -7,11 +7,15 @@ import (
 	"image"
 	"math"
 	"runtime"
+	"runtime/debug"
 	"sync"
+	"sync/atomic"
 	"time"
 
 	"go.uber.org/multierr"
 	"go.viam.com/utils"
+
+	"go.viam.com/rdk/logging"
 )
 
 // ParallelFactor controls the max level of parallelization. This might be useful
@@ -40,7 +44,9 @@ type (
 	GroupWorkFunc func(groupNum, groupSize, from, to int) (MemberWorkFunc, GroupWorkDoneFunc)
 )
 
-// GroupWorkParallel parallelizes the given size of work over multiple workers.
+// GroupWorkParallel parallelizes the given size of work over ParallelFactor groups, which are run
+// over the worker pool as ParallelForEachRowSpanContext runs rows. If ctx is done before every
+// group has started, the remaining groups are skipped and its error is returned.
 func GroupWorkParallel(ctx context.Context, totalSize int, before BeforeParallelGroupWorkFunc, groupWork GroupWorkFunc) error {
 	extra := 0
 	if totalSize > ParallelFactor {
@@ -51,74 +57,159 @@ func GroupWorkParallel(ctx context.Context, totalSize int, before BeforeParallel
 	numGroups := ParallelFactor
 	before(numGroups)
 
-	var wait sync.WaitGroup
-	wait.Add(numGroups)
-	for groupNum := 0; groupNum < numGroups; groupNum++ {
-		groupNumCopy := groupNum
-		utils.PanicCapturingGo(func() {
-			defer wait.Done()
-			groupNum := groupNumCopy
-
-			thisGroupSize := groupSize
-			thisExtra := 0
-			if groupNum == (numGroups - 1) {
-				thisExtra = extra
-				thisGroupSize += thisExtra
-			}
-			from := groupSize * groupNum
-			to := (groupSize * (groupNum + 1)) + thisExtra
-			memberWork, groupWorkDone := groupWork(groupNum, thisGroupSize, from, to)
-			if memberWork != nil {
-				memberNum := 0
-				for workNum := from; workNum < to; workNum++ {
-					memberWork(memberNum, workNum)
-					memberNum++
-				}
-			}
-			if groupWorkDone != nil {
-				groupWorkDone()
+	runGroup := func(groupNum int) {
+		thisGroupSize := groupSize
+		thisExtra := 0
+		if groupNum == (numGroups - 1) {
+			thisExtra = extra
+			thisGroupSize += thisExtra
+		}
+		from := groupSize * groupNum
+		to := (groupSize * (groupNum + 1)) + thisExtra
+		memberWork, groupWorkDone := groupWork(groupNum, thisGroupSize, from, to)
+		if memberWork != nil {
+			memberNum := 0
+			for workNum := from; workNum < to; workNum++ {
+				memberWork(memberNum, workNum)
+				memberNum++
 			}
-		})
+		}
+		if groupWorkDone != nil {
+			groupWorkDone()
+		}
 	}
-	wait.Wait()
-	return nil
+	return ParallelForEachRowSpanContext(ctx, numGroups, func(from, to int) {
+		for groupNum := from; groupNum < to; groupNum++ {
+			runGroup(groupNum)
+		}
+	})
 }
 
-// ParallelForEachPixel loops through the image and calls f functions for each [x, y] position.
-// The image is divided into N * N blocks, where N is the number of available processor threads. For each block a
-// parallel Goroutine is started.
+// ParallelForEachPixel calls f for each [x, y] position of an image of the given size. The rows
+// are run in bands as ParallelForEachRowSpan does, with x in the inner loop to follow row-major
+// image layouts.
 func ParallelForEachPixel(size image.Point, f func(x, y int)) {
-	procs := runtime.GOMAXPROCS(0)
-	var waitGroup sync.WaitGroup
-	waitGroup.Add(procs * procs)
-	for i := 0; i < procs; i++ {
-		startX := i * int(math.Floor(float64(size.X)/float64(procs)))
-		var endX int
-		if i < procs-1 {
-			endX = (i + 1) * int(math.Floor(float64(size.X)/float64(procs)))
-		} else {
-			endX = size.X
-		}
-		for j := 0; j < procs; j++ {
-			startY := j * int(math.Floor(float64(size.Y)/float64(procs)))
-			var endY int
-			if j < procs-1 {
-				endY = (j + 1) * int(math.Floor(float64(size.Y)/float64(procs)))
-			} else {
-				endY = size.Y
+	ParallelForEachRowSpan(size.Y, func(from, to int) {
+		for y := from; y < to; y++ {
+			for x := 0; x < size.X; x++ {
+				f(x, y)
 			}
-			sX, eX, sY, eY := startX, endX, startY, endY
+		}
+	})
+}
+
+// ParallelForEachRow calls f for each row in [0, height), in bands as ParallelForEachRowSpan does.
+func ParallelForEachRow(height int, f func(y int)) {
+	ParallelForEachRowSpan(height, func(from, to int) {
+		for y := from; y < to; y++ {
+			f(y)
+		}
+	})
+}
+
+// ParallelForEachRowSpan calls f with spans of rows [from, to) that together cover each row in
+// [0, height) exactly once, as ParallelForEachRowSpanContext does.
+func ParallelForEachRowSpan(height int, f func(from, to int)) {
+	//nolint:errcheck
+	ParallelForEachRowSpanContext(context.Background(), height, f)
+}
+
+// parallelBandsPerWorker is how many bands of rows each participant of a parallel loop gets on
+// average, so that those that finish early take over bands from slower ones.
+const parallelBandsPerWorker = 4
+
+// parallelPool is the process-wide pool of goroutines that parallel loops hand bands of rows to. It
+// is started on first use. Its tasks channel is unbuffered, so a send only succeeds when a worker is
+// idle.
+var parallelPool struct {
+	once  sync.Once
+	tasks chan func()
+}
+
+func parallelPoolTasks() chan<- func() {
+	parallelPool.once.Do(func() {
+		parallelPool.tasks = make(chan func())
+		for i := 0; i < runtime.GOMAXPROCS(0); i++ {
 			utils.PanicCapturingGo(func() {
-				defer waitGroup.Done()
-				for x := sX; x < eX; x++ {
-					for y := sY; y < eY; y++ {
-						f(x, y)
-					}
+				for task := range parallelPool.tasks {
+					task()
 				}
 			})
 		}
+	})
+	return parallelPool.tasks
+}
+
+// ParallelForEachRowSpanContext calls f with spans of rows [from, to) that together cover each row
+// in [0, height) exactly once. The rows are split into contiguous bands, which the caller and up to
+// ParallelFactor-1 idle workers of a process-wide pool claim in turn. Bands are only handed to
+// workers that are idle, so a call made while the pool is busy, such as one nested in f, runs its
+// bands inline rather than oversubscribing the pool or waiting on it. If ctx is done before every
+// band has started, the remaining bands are skipped and its error is returned once the running
+// ones finish.
+func ParallelForEachRowSpanContext(ctx context.Context, height int, f func(from, to int)) error {
+	if height <= 0 {
+		return ctx.Err()
+	}
+	numBands := ParallelFactor * parallelBandsPerWorker
+	if numBands > height {
+		numBands = height
+	}
+	helpers := ParallelFactor - 1
+	if helpers > numBands-1 {
+		helpers = numBands - 1
+	}
+
+	done := ctx.Done()
+	var next atomic.Int64
+	runBands := func() {
+		defer func() {
+			if err := recover(); err != nil {
+				logging.Global().Errorw("panic while running parallel work", "error", err, "stack", string(debug.Stack()))
+			}
+		}()
+		for {
+			if done != nil {
+				select {
+				case <-done:
+					return
+				default:
+				}
+			}
+			band := int(next.Add(1)) - 1
+			if band >= numBands {
+				return
+			}
+			f(band*height/numBands, (band+1)*height/numBands)
+		}
 	}
+
+	var waitGroup sync.WaitGroup
+	if helpers > 0 {
+		tasks := parallelPoolTasks()
+		task := func() {
+			defer waitGroup.Done()
+			runBands()
+		}
+	handOut:
+		for i := 0; i < helpers; i++ {
+			waitGroup.Add(1)
+			select {
+			case tasks <- task:
+			default:
+				waitGroup.Done()
+				break handOut
+			}
+		}
+	}
+	runBands()
 	waitGroup.Wait()
+
+	// every band has been claimed unless a participant stopped for ctx
+	if next.Load() < int64(numBands) {
+		return ctx.Err()
+	}
+	return nil
 }
 
 // SimpleFunc is for RunInParallel.
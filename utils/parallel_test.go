@@ -3,6 +3,8 @@ package utils
 import (
 	"context"
 	"errors"
+	"image"
+	"sync/atomic"
 	"testing"
 	"time"
 
@@ -72,4 +74,97 @@ func TestGroupWorkParallel(t *testing.T) {
 		total += ans
 	}
 	test.That(t, total, test.ShouldEqual, 3*N)
+
+	ctx, cancel := context.WithCancel(context.Background())
+	cancel()
+	err = GroupWorkParallel(ctx, N, func(numGroups int) {}, func(groupNum, groupSize, from, to int) (MemberWorkFunc, GroupWorkDoneFunc) {
+		return nil, nil
+	})
+	test.That(t, err, test.ShouldBeError, context.Canceled)
+}
+
+func TestParallelForEachRow(t *testing.T) {
+	for _, height := range []int{0, 1, 7, 1000} {
+		rows := make([]int, height)
+		ParallelForEachRow(height, func(y int) {
+			rows[y]++
+		})
+		for _, calls := range rows {
+			test.That(t, calls, test.ShouldEqual, 1)
+		}
+	}
+}
+
+func TestParallelForEachRowSpan(t *testing.T) {
+	for _, height := range []int{0, 1, 7, 1000} {
+		rows := make([]int32, height)
+		err := ParallelForEachRowSpanContext(context.Background(), height, func(from, to int) {
+			for y := from; y < to; y++ {
+				atomic.AddInt32(&rows[y], 1)
+				// a nested call runs inline once the pool is busy
+				inner := make([]int32, 50)
+				ParallelForEachRowSpan(len(inner), func(from, to int) {
+					for i := from; i < to; i++ {
+						atomic.AddInt32(&inner[i], 1)
+					}
+				})
+				for _, calls := range inner {
+					test.That(t, calls, test.ShouldEqual, 1)
+				}
+			}
+		})
+		test.That(t, err, test.ShouldBeNil)
+		for _, calls := range rows {
+			test.That(t, calls, test.ShouldEqual, 1)
+		}
+	}
+
+	ctx, cancel := context.WithCancel(context.Background())
+	var bands atomic.Int32
+	err := ParallelForEachRowSpanContext(ctx, 1000, func(from, to int) {
+		bands.Add(1)
+		cancel()
+	})
+	test.That(t, err, test.ShouldBeError, context.Canceled)
+	test.That(t, int(bands.Load()), test.ShouldBeLessThan, ParallelFactor*parallelBandsPerWorker)
+}
+
+func TestParallelForEachPixel(t *testing.T) {
+	size := image.Point{13, 7}
+	pixels := make([]int32, size.X*size.Y)
+	ParallelForEachPixel(size, func(x, y int) {
+		atomic.AddInt32(&pixels[y*size.X+x], 1)
+	})
+	for _, calls := range pixels {
+		test.That(t, calls, test.ShouldEqual, 1)
+	}
+}
+
+func BenchmarkParallelForEachPixel(b *testing.B) {
+	size := image.Point{640, 480}
+	pix := make([]uint8, size.X*size.Y)
+	for i := 0; i < b.N; i++ {
+		ParallelForEachPixel(size, func(x, y int) {
+			pix[y*size.X+x]++
+		})
+	}
+}
+
+func BenchmarkParallelForEachRowSpan(b *testing.B) {
+	size := image.Point{640, 480}
+	pix := make([]uint8, size.X*size.Y)
+	for i := 0; i < b.N; i++ {
+		ParallelForEachRowSpan(size.Y, func(from, to int) {
+			for j := range pix[from*size.X : to*size.X] {
+				pix[from*size.X+j]++
+			}
+		})
+	}
+}
+
+// BenchmarkParallelForEachRowSpanEmpty measures the scheduling overhead alone.
+func BenchmarkParallelForEachRowSpanEmpty(b *testing.B) {
+	for i := 0; i < b.N; i++ {
+		ParallelForEachRowSpan(480, func(from, to int) {})
+	}
 }
@@ -30,23 +30,21 @@ func downscaleNearestGrayImage(img *image.Gray, factor float64) (*image.Gray, er
 		},
 	}
 	downsized := image.NewGray(newRect)
-	utils.ParallelForEachPixel(newRect.Max, func(x, y int) {
-		origXTemp := float64(x) * factor
-		var origX int
-		// round original float coordinates to the closest int coordinates
-		if fraction := origXTemp - float64(int(origXTemp)); fraction >= 0.5 {
-			origX = int(origXTemp + 1)
-		} else {
-			origX = int(origXTemp)
+	// round original float coordinates to the closest int coordinates
+	nearest := func(i int) int {
+		orig := float64(i) * factor
+		if fraction := orig - float64(int(orig)); fraction >= 0.5 {
+			return int(orig + 1)
 		}
-		origYTemp := float64(y) * factor
-		var origY int
-		if fraction := origYTemp - float64(int(origYTemp)); fraction >= 0.5 {
-			origY = int(origYTemp + 1)
-		} else {
-			origY = int(origYTemp)
+		return int(orig)
+	}
+	utils.ParallelForEachRowSpan(newRect.Max.Y, func(from, to int) {
+		for y := from; y < to; y++ {
+			origY := nearest(y)
+			for x := 0; x < newRect.Max.X; x++ {
+				downsized.SetGray(x, y, img.GrayAt(nearest(x), origY))
+			}
 		}
-		downsized.SetGray(x, y, img.GrayAt(origX, origY))
 	})
 	return downsized, nil
 }
@@ -2,6 +2,7 @@ package objectdetection
 
 import (
 	"image"
+	"image/color"
 
 	"github.com/pkg/errors"
 
@@ -60,9 +61,9 @@ func NewColorDetector(cfg *ColorDetectorConfig) (Detector, error) {
 		return nil, errors.Errorf("the chosen color to detect has a value of %.5f which is less than value_cutoff_pct %.5f", v, val)
 	}
 
-	var valid validPixelFunc
+	var lut colorLUT
 	if tol == 1.0 {
-		valid = makeValidColorFunction(0, 360, sat, val)
+		lut = makeColorLUT(0, 360, sat, val)
 	} else {
 		tol = (tol / 2.) * 360.0 // change from percent to degrees
 		hiValid := hue + tol
@@ -73,13 +74,13 @@ func NewColorDetector(cfg *ColorDetectorConfig) (Detector, error) {
 		if loValid < 0. {
 			loValid += 360.
 		}
-		valid = makeValidColorFunction(loValid, hiValid, sat, val)
+		lut = makeColorLUT(loValid, hiValid, sat, val)
 	}
 	label := cfg.Label
 	if label == "" {
 		label = hueToString(hue)
 	}
-	cd := connectedComponentDetector{valid, label}
+	cd := connectedComponentDetector{lut.validRow, label}
 	// define the filter
 	segmentSize := 5000 // default value
 	if cfg.SegmentSize != 0 {
@@ -131,23 +132,75 @@ func hueToString(hue float64) string {
 	}
 }
 
-func makeValidColorFunction(loValid, hiValid, sat, val float64) validPixelFunc {
-	valid := func(v float64) bool { return v == loValid }
+// colorLUTBits is how many of the high bits of a pixel's red, green and blue values index a colorLUT.
+const colorLUTBits = 6
+
+// colorLUT records whether each color, quantized to colorLUTBits bits per channel, passes the color
+// detector's hue, saturation and value criteria, as judged at the center of its bin. Classifying a
+// pixel is then a table lookup rather than an HSV conversion.
+type colorLUT []bool
+
+func makeColorLUT(loValid, hiValid, sat, val float64) colorLUT {
+	validHue := func(v float64) bool { return v == loValid }
 	if hiValid > loValid {
-		valid = func(v float64) bool { return v <= hiValid && v >= loValid }
+		validHue = func(v float64) bool { return v <= hiValid && v >= loValid }
 	} else if loValid > hiValid {
-		valid = func(v float64) bool { return v <= hiValid || v >= loValid }
-	}
-	// create the ValidPixel function
-	return func(img image.Image, pt image.Point) bool {
-		c := rimage.NewColorFromColor(img.At(pt.X, pt.Y))
-		h, s, v := c.HsvNormal()
-		if s < sat {
-			return false
+		validHue = func(v float64) bool { return v <= hiValid || v >= loValid }
+	}
+
+	const levels = 1 << colorLUTBits
+	const shift = 8 - colorLUTBits
+	const center = 1 << (shift - 1)
+	lut := make(colorLUT, levels*levels*levels)
+	for r := 0; r < levels; r++ {
+		for g := 0; g < levels; g++ {
+			for b := 0; b < levels; b++ {
+				c := rimage.NewColor(uint8(r<<shift|center), uint8(g<<shift|center), uint8(b<<shift|center))
+				h, s, v := c.HsvNormal()
+				lut[(r<<colorLUTBits|g)<<colorLUTBits|b] = s >= sat && v >= val && validHue(h)
+			}
+		}
+	}
+	return lut
+}
+
+func (lut colorLUT) valid(r, g, b uint8) bool {
+	const shift = 8 - colorLUTBits
+	return lut[(int(r>>shift)<<colorLUTBits|int(g>>shift))<<colorLUTBits|int(b>>shift)]
+}
+
+// validRow classifies row y of img. The pixel buffers of the common image types are read directly;
+// YCbCr pixels are converted to RGB with integer math before the lookup.
+func (lut colorLUT) validRow(img image.Image, y int, valid []bool) {
+	minX := img.Bounds().Min.X
+	switch im := img.(type) {
+	case *image.NRGBA:
+		pix := im.Pix[im.PixOffset(minX, y):]
+		for x := range valid {
+			valid[x] = lut.valid(pix[4*x], pix[4*x+1], pix[4*x+2])
+		}
+	case *image.RGBA:
+		pix := im.Pix[im.PixOffset(minX, y):]
+		for x := range valid {
+			if pix[4*x+3] == 0xff {
+				valid[x] = lut.valid(pix[4*x], pix[4*x+1], pix[4*x+2])
+				continue
+			}
+			// premultiplied by a partial alpha
+			valid[x] = lut.valid(rimage.NewColorFromColor(im.RGBAAt(minX+x, y)).RGB255())
 		}
-		if v < val {
-			return false
+	case *image.YCbCr:
+		for x := range valid {
+			yi, ci := im.YOffset(minX+x, y), im.COffset(minX+x, y)
+			valid[x] = lut.valid(color.YCbCrToRGB(im.Y[yi], im.Cb[ci], im.Cr[ci]))
+		}
+	case *rimage.Image:
+		for x := range valid {
+			valid[x] = lut.valid(im.GetXY(minX+x, y).RGB255())
+		}
+	default:
+		for x := range valid {
+			valid[x] = lut.valid(rimage.NewColorFromColor(img.At(minX+x, y)).RGB255())
 		}
-		return valid(h)
 	}
 }
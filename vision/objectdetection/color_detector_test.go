@@ -3,6 +3,7 @@ package objectdetection
 import (
 	"context"
 	"image"
+	"image/color"
 	"testing"
 
 	"github.com/pkg/errors"
@@ -114,3 +115,48 @@ func TestHueToString(t *testing.T) {
 	hue, _, _ = theColor.HsvNormal()
 	test.That(t, hueToString(hue), test.ShouldEqual, "rose")
 }
+
+func TestConnectedComponents(t *testing.T) {
+	// A U shape, whose arms only join in the bottom row, and a separate dot.
+	img := image.NewNRGBA(image.Rect(0, 0, 8, 6))
+	set := func(x, y int) { img.Set(x, y, rimage.Red) }
+	for y := 0; y < 5; y++ {
+		set(1, y)
+		set(4, y)
+	}
+	for x := 1; x <= 4; x++ {
+		set(x, 5)
+	}
+	set(7, 0)
+
+	cd := connectedComponentDetector{makeColorLUT(350, 10, 0.2, 0.3).validRow, "red"}
+	result, err := cd.Inference(context.Background(), img)
+	test.That(t, err, test.ShouldBeNil)
+	test.That(t, result, test.ShouldHaveLength, 2)
+	test.That(t, *result[0].BoundingBox(), test.ShouldResemble, image.Rect(1, 0, 4, 5))
+	test.That(t, *result[1].BoundingBox(), test.ShouldResemble, image.Rect(7, 0, 7, 0))
+}
+
+func TestColorLUT(t *testing.T) {
+	lut := makeColorLUT(350, 10, 0.2, 0.3)
+	test.That(t, lut.valid(255, 0, 0), test.ShouldBeTrue)
+	test.That(t, lut.valid(0, 0, 255), test.ShouldBeFalse)
+	test.That(t, lut.valid(40, 0, 0), test.ShouldBeFalse)      // too dark
+	test.That(t, lut.valid(255, 230, 230), test.ShouldBeFalse) // too washed out
+
+	// Every image type is classified the same way.
+	ycbcr := image.NewYCbCr(image.Rect(0, 0, 2, 1), image.YCbCrSubsampleRatio444)
+	yy, cb, cr := color.RGBToYCbCr(255, 0, 0)
+	ycbcr.Y[0], ycbcr.Cb[0], ycbcr.Cr[0] = yy, cb, cr
+	yy, cb, cr = color.RGBToYCbCr(0, 0, 255)
+	ycbcr.Y[1], ycbcr.Cb[1], ycbcr.Cr[1] = yy, cb, cr
+	valid := make([]bool, 2)
+	lut.validRow(ycbcr, 0, valid)
+	test.That(t, valid, test.ShouldResemble, []bool{true, false})
+
+	rimg := rimage.NewImage(2, 1)
+	rimg.Set(image.Point{0, 0}, rimage.Blue)
+	rimg.Set(image.Point{1, 0}, rimage.Red)
+	lut.validRow(rimg, 0, valid)
+	test.That(t, valid, test.ShouldResemble, []bool{false, true})
+}
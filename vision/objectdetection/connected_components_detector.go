@@ -5,75 +5,134 @@ import (
 	"image"
 )
 
-// validPixelFunc is a function that returns true if a pixel in an image.Image passes a certain criteria.
-type validPixelFunc func(image.Image, image.Point) bool
+// validRowFunc marks in valid which pixels of row y of an image.Image pass a certain criteria.
+type validRowFunc func(img image.Image, y int, valid []bool)
 
 // connectedComponentDetector identifies objects in an image by merging neighbors that share similar properties.
 // Based on some valid criteria, it will group the pixel into the current segment.
 type connectedComponentDetector struct {
-	valid validPixelFunc
+	valid validRowFunc
 	label string
 }
 
+// pixelRun is a horizontal run of valid pixels [start, end) in a row, belonging to a segment.
+type pixelRun struct {
+	start, end int
+	segment    int
+}
+
 // Inference takes in an image frame and returns the Detections found in the image.
+// Each row is split into runs of valid pixels, and each run joins the segments of the runs it
+// touches in the row above, so every pixel is classified exactly once and the bounding boxes
+// are complete after a single pass over the image.
 func (ccd *connectedComponentDetector) Inference(ctx context.Context, img image.Image) ([]Detection, error) {
-	width, height := img.Bounds().Dx(), img.Bounds().Dy()
-	seen := make([]bool, width*height)
-	queue := []image.Point{}
-	detections := []Detection{}
-	for i := 0; i < width; i++ {
-		for j := 0; j < height; j++ {
-			pt := image.Point{i, j}
-			indx := pt.Y*width + pt.X
-			if seen[indx] {
+	bounds := img.Bounds()
+	width := bounds.Dx()
+	valid := make([]bool, width)
+	var segs segments
+	var runs, prevRuns []pixelRun
+	for y := bounds.Min.Y; y < bounds.Max.Y; y++ {
+		ccd.valid(img, y, valid)
+		runs = runs[:0]
+		prev := 0
+		for x := 0; x < width; {
+			if !valid[x] {
+				x++
 				continue
 			}
-			if !ccd.valid(img, pt) {
-				seen[indx] = true
-				continue
+			start := x
+			for x < width && valid[x] {
+				x++
 			}
-			queue = append(queue, pt)
-			x0, y0, x1, y1 := pt.X, pt.Y, pt.X, pt.Y // the bounding box of the segment
-			for len(queue) != 0 {
-				newPt := queue[0]
-				newIndx := newPt.Y*width + newPt.X
-				seen[newIndx] = true
-				queue = queue[1:]
-				if newPt.X < x0 {
-					x0 = newPt.X
-				}
-				if newPt.X > x1 {
-					x1 = newPt.X
-				}
-				if newPt.Y < y0 {
-					y0 = newPt.Y
-				}
-				if newPt.Y > y1 {
-					y1 = newPt.Y
+
+			segment := -1
+			for prev < len(prevRuns) && prevRuns[prev].end <= start {
+				prev++
+			}
+			for i := prev; i < len(prevRuns) && prevRuns[i].start < x; i++ {
+				if segment < 0 {
+					segment = segs.find(prevRuns[i].segment)
+				} else {
+					segment = segs.union(segment, prevRuns[i].segment)
 				}
-				neighbors := ccd.getNeighbors(newPt, img, seen)
-				queue = append(queue, neighbors...)
 			}
-			d := &detection2D{image.Rect(x0, y0, x1, y1), 1.0, ccd.label}
-			detections = append(detections, d)
+			x0, x1 := bounds.Min.X+start, bounds.Min.X+x-1
+			if segment < 0 {
+				segment = segs.add(x0, x1, y)
+			} else {
+				segs.extend(segment, x0, x1, y)
+			}
+			runs = append(runs, pixelRun{start, x, segment})
 		}
+		runs, prevRuns = prevRuns, runs
 	}
-	return detections, nil
-}
 
-func (ccd *connectedComponentDetector) getNeighbors(pt image.Point, img image.Image, seen []bool) []image.Point {
-	bounds := img.Bounds()
-	neighbors := make([]image.Point, 0, 4)
-	fourPoints := []image.Point{{pt.X, pt.Y - 1}, {pt.X, pt.Y + 1}, {pt.X - 1, pt.Y}, {pt.X + 1, pt.Y}}
-	for _, p := range fourPoints {
-		indx := p.Y*bounds.Dx() + p.X
-		if !p.In(bounds) || seen[indx] {
+	detections := []Detection{}
+	for i, box := range segs.boxes {
+		if segs.parent[i] != i {
 			continue
 		}
-		if ccd.valid(img, p) {
-			neighbors = append(neighbors, p)
-		}
-		seen[indx] = true
+		d := &detection2D{image.Rect(box.x0, box.y0, box.x1, box.y1), 1.0, ccd.label}
+		detections = append(detections, d)
+	}
+	return detections, nil
+}
+
+// segmentBox is the bounding box of a segment, inclusive of its max corner.
+type segmentBox struct {
+	x0, y0, x1, y1 int
+}
+
+// segments is a union-find forest of the segments found so far. Only the box of each root is
+// kept up to date.
+type segments struct {
+	parent []int
+	boxes  []segmentBox
+}
+
+func (s *segments) add(x0, x1, y int) int {
+	s.parent = append(s.parent, len(s.parent))
+	s.boxes = append(s.boxes, segmentBox{x0, y, x1, y})
+	return len(s.parent) - 1
+}
+
+func (s *segments) find(i int) int {
+	for s.parent[i] != i {
+		s.parent[i] = s.parent[s.parent[i]]
+		i = s.parent[i]
+	}
+	return i
+}
+
+// union merges the segments of a and b, and returns the root of the merged segment.
+func (s *segments) union(a, b int) int {
+	a, b = s.find(a), s.find(b)
+	if a == b {
+		return a
+	}
+	if b < a {
+		a, b = b, a
+	}
+	s.parent[b] = a
+	box := s.boxes[b]
+	s.extend(a, box.x0, box.x1, box.y0)
+	s.extend(a, box.x0, box.x1, box.y1)
+	return a
+}
+
+// extend grows the box of root i to include the pixels [x0, x1] of row y.
+func (s *segments) extend(i, x0, x1, y int) {
+	box := &s.boxes[i]
+	if x0 < box.x0 {
+		box.x0 = x0
+	}
+	if x1 > box.x1 {
+		box.x1 = x1
+	}
+	if y < box.y0 {
+		box.y0 = y
+	}
+	if y > box.y1 {
+		box.y1 = y
 	}
-	return neighbors
 }